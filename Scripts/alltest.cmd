@@ -7,6 +7,11 @@ call soup build
 call soup run
 popd
 
+pushd %SourceDir%\Build\Runtime.UnitTests\
+call soup build
+call soup run
+popd
+
 pushd %SourceDir%\Extensions\Compiler\Core.UnitTests\
 call soup build
 call soup run
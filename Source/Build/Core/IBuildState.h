@@ -17,6 +17,22 @@ namespace Soup::Build
 		Error = 5,
 	};
 
+	/// <summary>
+	/// The packed description of a single graph node used to create many nodes in one call
+	/// Note: Has strict ABI requirements to prevent version incompatible
+	/// </summary>
+	export struct GraphNodeDescription
+	{
+		const char* Title;
+		const char* Program;
+		const char* Arguments;
+		const char* WorkingDirectory;
+		uint64_t InputFileCount;
+		const char* const* InputFiles;
+		uint64_t OutputFileCount;
+		const char* const* OutputFiles;
+	};
+
 	/// <summary>
 	/// Build State Extension interface that is the core object granting
 	/// build extensions access to the shared build state.
@@ -47,4 +63,23 @@ namespace Soup::Build
 		/// </summary>
 		virtual OperationResult TryLogTrace(TraceLevel level, const char* message) noexcept = 0;
 	};
+
+	/// <summary>
+	/// The version 2 build state interface that adds bulk node creation
+	/// Note: Only implemented by hosts that report <see cref="BuildInterfaceVersion"/> 2 or newer,
+	/// the original interface is left unchanged so existing vtables stay compatible
+	/// </summary>
+	export class IBuildState2 : public IBuildState
+	{
+	public:
+		/// <summary>
+		/// Create a set of nodes from their packed descriptions in a single call
+		/// Note: Each created node is returned with a reference that the caller owns,
+		/// the same as TryCreateNode.
+		/// </summary>
+		virtual OperationResult TryCreateNodes(
+			uint64_t count,
+			const GraphNodeDescription* descriptions,
+			IGraphNode** result) noexcept = 0;
+	};
 }
@@ -7,6 +7,16 @@
 
 namespace Soup::Build
 {
+	/// <summary>
+	/// The version of the extension interfaces implemented by the host
+	/// Version 1 is the original set of interfaces, version 2 adds <see cref="IList2"/>,
+	/// <see cref="IValueList2"/> and <see cref="IBuildState2"/>.
+	/// Note: The host reports its version to an extension through the optional exported
+	/// SetBuildInterfaceVersion function before calling RegisterBuildExtension. An extension
+	/// that is never told the version must assume version 1.
+	/// </summary>
+	export constexpr uint32_t BuildInterfaceVersion = 2;
+
 	/// <summary>
 	/// The shared Build System Extension interface that is passed into a build extension 
 	/// registration method. This container allows for a build enxtension to register any number 
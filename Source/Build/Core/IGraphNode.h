@@ -7,6 +7,18 @@
 
 namespace Soup::Build
 {
+	/// <summary>
+	/// The class of machine resources a graph node consumes while it executes
+	/// </summary>
+	export enum class ResourceClass : uint64_t
+	{
+		Generic,
+		Compile,
+		Link,
+		Archive,
+		Copy,
+	};
+
 	/// <summary>
 	/// A graph node that represents a single operation in the build
 	/// </summary>
@@ -30,5 +42,19 @@ namespace Soup::Build
 		virtual IList<const char*>& GetInputFileList() noexcept = 0;
 		virtual IList<const char*>& GetOutputFileList() noexcept = 0;
 		virtual IList<IGraphNode*>& GetChildList() noexcept = 0;
+
+		/// <summary>
+		/// Resource usage hints that allow the runner to limit concurrent work
+		/// Note: The memory weight is the estimated peak memory usage in megabytes
+		/// and the thread count is the number of job slots the operation occupies
+		/// </summary>
+		virtual uint64_t GetResourceClass() const noexcept = 0;
+		virtual OperationResult TrySetResourceClass(uint64_t value) noexcept = 0;
+
+		virtual uint64_t GetMemoryWeight() const noexcept = 0;
+		virtual OperationResult TrySetMemoryWeight(uint64_t value) noexcept = 0;
+
+		virtual uint64_t GetThreadCount() const noexcept = 0;
+		virtual OperationResult TrySetThreadCount(uint64_t value) noexcept = 0;
 	};
 }
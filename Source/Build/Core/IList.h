@@ -29,4 +29,20 @@ namespace Soup::Build
 		virtual OperationResult TryGetValueAt(uint64_t index, T& result) noexcept = 0;
 		virtual OperationResult TrySetValueAt(uint64_t index, T result) noexcept = 0;
 	};
+
+	/// <summary>
+	/// The version 2 list interface that adds bulk accessors
+	/// Note: Only implemented by hosts that report <see cref="BuildInterfaceVersion"/> 2 or newer,
+	/// the original interface is left unchanged so existing vtables stay compatible
+	/// </summary>
+	export template<typename T>
+	class IList2 : public IList<T>
+	{
+	public:
+		/// <summary>
+		/// Bulk accessor methods that transfer a contiguous range in a single call
+		/// </summary>
+		virtual OperationResult TryGetValues(uint64_t index, uint64_t count, T* result) noexcept = 0;
+		virtual OperationResult TryAppendValues(uint64_t count, const T* values) noexcept = 0;
+	};
 }
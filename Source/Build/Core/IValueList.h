@@ -27,4 +27,24 @@ namespace Soup::Build
 		/// </summary>
 		virtual OperationResult TryGetValueAt(uint64_t index, IValue*& result) noexcept = 0;
 	};
+
+	/// <summary>
+	/// The version 2 value list interface that adds bulk string accessors
+	/// Note: Only implemented by hosts that report <see cref="BuildInterfaceVersion"/> 2 or newer,
+	/// the original interface is left unchanged so existing vtables stay compatible
+	/// </summary>
+	export class IValueList2 : public IValueList
+	{
+	public:
+		/// <summary>
+		/// Bulk string accessor methods that transfer a contiguous range in a single call
+		/// Note: The string pointers are only valid until the list is modified and the
+		/// input strings are not required to be null terminated.
+		/// </summary>
+		virtual OperationResult TryGetStringValues(uint64_t index, uint64_t count, const char** result) noexcept = 0;
+		virtual OperationResult TryAppendStringValues(
+			uint64_t count,
+			const char* const* values,
+			const uint64_t* lengths) noexcept = 0;
+	};
 }
@@ -0,0 +1,119 @@
+// <copyright file="BuiltInOperationTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Extensions::UnitTests
+{
+	class BuiltInOperationTests
+	{
+	public:
+		[[Theory]]
+		[[InlineData(Soup::BuiltInOperation::MakeDirectory, "mkdir")]]
+		[[InlineData(Soup::BuiltInOperation::Copy, "copy")]]
+		[[InlineData(Soup::BuiltInOperation::HardLink, "hardlink")]]
+		[[InlineData(Soup::BuiltInOperation::SymbolicLink, "symlink")]]
+		[[InlineData(Soup::BuiltInOperation::WriteFile, "write")]]
+		void ToStringValues(BuiltInOperation value, std::string expected)
+		{
+			auto actual = ToString(value);
+			Assert::AreEqual(expected, actual, "Verify matches expected.");
+		}
+
+		[[Theory]]
+		[[InlineData("mkdir", Soup::BuiltInOperation::MakeDirectory)]]
+		[[InlineData("copy", Soup::BuiltInOperation::Copy)]]
+		[[InlineData("hardlink", Soup::BuiltInOperation::HardLink)]]
+		[[InlineData("symlink", Soup::BuiltInOperation::SymbolicLink)]]
+		[[InlineData("write", Soup::BuiltInOperation::WriteFile)]]
+		void ParseValues(std::string value, BuiltInOperation expected)
+		{
+			auto actual = ParseBuiltInOperation(value);
+			Assert::AreEqual(expected, actual, "Verify matches expected.");
+		}
+
+		[[Fact]]
+		void ParseGarbageThrows()
+		{
+			Assert::ThrowsRuntimeError([]() {
+				auto actual = ParseBuiltInOperation("garbage");
+			});
+		}
+
+		[[Fact]]
+		void TryParseBuiltInProgram_BuiltIn()
+		{
+			auto operation = BuiltInOperation();
+			auto result = TryParseBuiltInProgram(GetBuiltInProgram(BuiltInOperation::Copy), operation);
+			Assert::IsTrue(result, "Verify result is true.");
+			Assert::AreEqual(BuiltInOperation::Copy, operation, "Verify operation matches expected.");
+		}
+
+		[[Fact]]
+		void TryParseBuiltInProgram_External()
+		{
+			auto operation = BuiltInOperation();
+			auto result = TryParseBuiltInProgram("C:/Clang/bin/clang++.exe", operation);
+			Assert::IsFalse(result, "Verify result is false.");
+		}
+
+		[[Fact]]
+		void FormatBuiltInArguments_RoundTrip()
+		{
+			auto values = std::vector<std::string>({
+				"C:/root/obj/Public.mock.bmi",
+				"C:/Program Files/bin/Library.mock.bmi",
+			});
+
+			auto arguments = FormatBuiltInArguments(values);
+			Assert::AreEqual(
+				std::string("\"C:/root/obj/Public.mock.bmi\" \"C:/Program Files/bin/Library.mock.bmi\""),
+				arguments,
+				"Verify arguments match expected.");
+
+			auto actual = ParseBuiltInArguments(arguments);
+			Assert::AreEqual(values, actual, "Verify values match expected.");
+		}
+
+		[[Fact]]
+		void FormatBuiltInArguments_EscapedRoundTrip()
+		{
+			auto values = std::vector<std::string>({
+				"C:/root/obj/Unity.cpp",
+				"#include \"C:/root/File1.cpp\"",
+				"C:\\root\\File2.cpp",
+			});
+
+			auto arguments = FormatBuiltInArguments(values);
+			Assert::AreEqual(
+				std::string("\"C:/root/obj/Unity.cpp\" \"#include \\\"C:/root/File1.cpp\\\"\" \"C:\\\\root\\\\File2.cpp\""),
+				arguments,
+				"Verify arguments match expected.");
+
+			auto actual = ParseBuiltInArguments(arguments);
+			Assert::AreEqual(values, actual, "Verify values match expected.");
+		}
+
+		[[Fact]]
+		void ParseBuiltInArguments_Unquoted()
+		{
+			auto actual = ParseBuiltInArguments("Source.txt  \"Target Folder/\"");
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Source.txt",
+					"Target Folder/",
+				}),
+				actual,
+				"Verify values match expected.");
+		}
+
+		[[Fact]]
+		void ParseBuiltInArguments_MissingQuoteThrows()
+		{
+			Assert::ThrowsRuntimeError([]() {
+				auto actual = ParseBuiltInArguments("\"Source.txt");
+			});
+		}
+	};
+}
@@ -0,0 +1,166 @@
+// <copyright file="GraphBuilderTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Extensions::UnitTests
+{
+	class GraphBuilderTests
+	{
+	public:
+		[[Fact]]
+		void Initialize()
+		{
+			auto uut = GraphBuilder();
+
+			Assert::IsTrue(uut.GetRoots().empty(), "Verify there are no roots.");
+			Assert::IsTrue(uut.GetLeaves().empty(), "Verify there are no leaves.");
+		}
+
+		[[Fact]]
+		void AddPhase_FirstPhase_BecomesRoots()
+		{
+			auto arena = Runtime::BuildGraphArena();
+			auto compileA = CreateNode(arena, "CompileA");
+			auto compileB = CreateNode(arena, "CompileB");
+			auto link = CreateNode(arena, "Link");
+
+			auto uut = GraphBuilder();
+			auto compileNodes = std::vector<GraphNodeWrapper>({ compileA, compileB });
+			uut.AddPhase(compileNodes);
+			uut.AddPhase(link);
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "CompileA", "CompileB" }),
+				GetTitles(uut.GetRoots()),
+				"Verify the first phase stays the roots.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "Link" }),
+				GetTitles(uut.GetLeaves()),
+				"Verify the last phase is the leaves.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "Link" }),
+				GetChildTitles(compileA),
+				"Verify the first compile runs before the link.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "Link" }),
+				GetChildTitles(compileB),
+				"Verify the second compile runs before the link.");
+		}
+
+		[[Fact]]
+		void AddPhase_NodesWithChildren_LeavesFromSubgraph()
+		{
+			auto arena = Runtime::BuildGraphArena();
+			auto precompile = CreateNode(arena, "Precompile");
+			auto compile = CreateNode(arena, "Compile");
+			auto link = CreateNode(arena, "Link");
+			precompile.GetChildList().Append(compile);
+
+			auto uut = GraphBuilder();
+			uut.AddPhase(precompile);
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "Compile" }),
+				GetTitles(uut.GetLeaves()),
+				"Verify the leaves were found through the subgraph.");
+
+			uut.AddPhase(link);
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "Compile" }),
+				GetChildTitles(precompile),
+				"Verify the existing children are unchanged.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "Link" }),
+				GetChildTitles(compile),
+				"Verify the next phase runs after the subgraph leaf.");
+		}
+
+		[[Fact]]
+		void AddPhase_Diamond_SharedLeafOnce()
+		{
+			auto arena = Runtime::BuildGraphArena();
+			auto generate = CreateNode(arena, "Generate");
+			auto compileA = CreateNode(arena, "CompileA");
+			auto compileB = CreateNode(arena, "CompileB");
+			auto archive = CreateNode(arena, "Archive");
+			auto link = CreateNode(arena, "Link");
+			auto compileNodes = std::vector<GraphNodeWrapper>({ compileA, compileB });
+			generate.GetChildList().Append(compileNodes);
+			compileA.GetChildList().Append(archive);
+			compileB.GetChildList().Append(archive);
+
+			auto uut = GraphBuilder();
+			uut.AddPhase(generate);
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "Archive" }),
+				GetTitles(uut.GetLeaves()),
+				"Verify the shared leaf is recorded once.");
+
+			uut.AddPhase(link);
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "Link" }),
+				GetChildTitles(archive),
+				"Verify the next phase is added to the shared leaf once.");
+		}
+
+		[[Fact]]
+		void AddPhase_Empty_NoChange()
+		{
+			auto arena = Runtime::BuildGraphArena();
+			auto compile = CreateNode(arena, "Compile");
+
+			auto uut = GraphBuilder();
+			auto emptyNodes = std::vector<GraphNodeWrapper>();
+			uut.AddPhase(emptyNodes);
+
+			Assert::IsTrue(uut.GetRoots().empty(), "Verify an empty first phase adds no roots.");
+			Assert::IsTrue(uut.GetLeaves().empty(), "Verify an empty first phase adds no leaves.");
+
+			uut.AddPhase(compile);
+			uut.AddPhase(emptyNodes);
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "Compile" }),
+				GetTitles(uut.GetRoots()),
+				"Verify the roots are unchanged.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "Compile" }),
+				GetTitles(uut.GetLeaves()),
+				"Verify the leaves are unchanged.");
+			Assert::IsTrue(GetChildTitles(compile).empty(), "Verify no children were added.");
+		}
+
+	private:
+		static GraphNodeWrapper CreateNode(Runtime::BuildGraphArena& arena, std::string_view title)
+		{
+			auto node = GraphNodeWrapper(arena.CreateNode());
+			node.SetTitle(title);
+			return node;
+		}
+
+		static std::vector<std::string> GetTitles(const std::vector<GraphNodeWrapper>& nodes)
+		{
+			auto result = std::vector<std::string>();
+			for (auto& node : nodes)
+				result.push_back(std::string(node.GetTitle()));
+
+			return result;
+		}
+
+		static std::vector<std::string> GetChildTitles(GraphNodeWrapper node)
+		{
+			auto result = std::vector<std::string>();
+			auto children = node.GetChildList();
+			auto size = children.GetSize();
+			for (uint64_t i = 0; i < size; i++)
+				result.push_back(std::string(children.GetValueAt(i).GetTitle()));
+
+			return result;
+		}
+	};
+}
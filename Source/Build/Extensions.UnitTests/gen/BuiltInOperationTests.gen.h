@@ -0,0 +1,28 @@
+#pragma once
+#include "BuiltInOperationTests.h"
+
+TestState RunBuiltInOperationTests() 
+ {
+	auto className = "BuiltInOperationTests";
+	auto testClass = std::make_shared<Soup::Build::Extensions::UnitTests::BuiltInOperationTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "ToStringValues(Soup::BuiltInOperation::MakeDirectory, \"mkdir\")", [&testClass]() { testClass->ToStringValues(Soup::Build::Extensions::BuiltInOperation::MakeDirectory, "mkdir"); });
+	state += SoupTest::RunTest(className, "ToStringValues(Soup::BuiltInOperation::Copy, \"copy\")", [&testClass]() { testClass->ToStringValues(Soup::Build::Extensions::BuiltInOperation::Copy, "copy"); });
+	state += SoupTest::RunTest(className, "ToStringValues(Soup::BuiltInOperation::HardLink, \"hardlink\")", [&testClass]() { testClass->ToStringValues(Soup::Build::Extensions::BuiltInOperation::HardLink, "hardlink"); });
+	state += SoupTest::RunTest(className, "ToStringValues(Soup::BuiltInOperation::SymbolicLink, \"symlink\")", [&testClass]() { testClass->ToStringValues(Soup::Build::Extensions::BuiltInOperation::SymbolicLink, "symlink"); });
+	state += SoupTest::RunTest(className, "ToStringValues(Soup::BuiltInOperation::WriteFile, \"write\")", [&testClass]() { testClass->ToStringValues(Soup::Build::Extensions::BuiltInOperation::WriteFile, "write"); });
+	state += SoupTest::RunTest(className, "ParseValues(\"mkdir\", Soup::BuiltInOperation::MakeDirectory)", [&testClass]() { testClass->ParseValues("mkdir", Soup::Build::Extensions::BuiltInOperation::MakeDirectory); });
+	state += SoupTest::RunTest(className, "ParseValues(\"copy\", Soup::BuiltInOperation::Copy)", [&testClass]() { testClass->ParseValues("copy", Soup::Build::Extensions::BuiltInOperation::Copy); });
+	state += SoupTest::RunTest(className, "ParseValues(\"hardlink\", Soup::BuiltInOperation::HardLink)", [&testClass]() { testClass->ParseValues("hardlink", Soup::Build::Extensions::BuiltInOperation::HardLink); });
+	state += SoupTest::RunTest(className, "ParseValues(\"symlink\", Soup::BuiltInOperation::SymbolicLink)", [&testClass]() { testClass->ParseValues("symlink", Soup::Build::Extensions::BuiltInOperation::SymbolicLink); });
+	state += SoupTest::RunTest(className, "ParseValues(\"write\", Soup::BuiltInOperation::WriteFile)", [&testClass]() { testClass->ParseValues("write", Soup::Build::Extensions::BuiltInOperation::WriteFile); });
+	state += SoupTest::RunTest(className, "ParseGarbageThrows", [&testClass]() { testClass->ParseGarbageThrows(); });
+	state += SoupTest::RunTest(className, "TryParseBuiltInProgram_BuiltIn", [&testClass]() { testClass->TryParseBuiltInProgram_BuiltIn(); });
+	state += SoupTest::RunTest(className, "TryParseBuiltInProgram_External", [&testClass]() { testClass->TryParseBuiltInProgram_External(); });
+	state += SoupTest::RunTest(className, "FormatBuiltInArguments_RoundTrip", [&testClass]() { testClass->FormatBuiltInArguments_RoundTrip(); });
+	state += SoupTest::RunTest(className, "FormatBuiltInArguments_EscapedRoundTrip", [&testClass]() { testClass->FormatBuiltInArguments_EscapedRoundTrip(); });
+	state += SoupTest::RunTest(className, "ParseBuiltInArguments_Unquoted", [&testClass]() { testClass->ParseBuiltInArguments_Unquoted(); });
+	state += SoupTest::RunTest(className, "ParseBuiltInArguments_MissingQuoteThrows", [&testClass]() { testClass->ParseBuiltInArguments_MissingQuoteThrows(); });
+
+	return state;
+}
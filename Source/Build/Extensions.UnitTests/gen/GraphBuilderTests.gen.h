@@ -0,0 +1,16 @@
+#pragma once
+#include "GraphBuilderTests.h"
+
+TestState RunGraphBuilderTests() 
+ {
+	auto className = "GraphBuilderTests";
+	auto testClass = std::make_shared<Soup::Build::Extensions::UnitTests::GraphBuilderTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += SoupTest::RunTest(className, "AddPhase_FirstPhase_BecomesRoots", [&testClass]() { testClass->AddPhase_FirstPhase_BecomesRoots(); });
+	state += SoupTest::RunTest(className, "AddPhase_NodesWithChildren_LeavesFromSubgraph", [&testClass]() { testClass->AddPhase_NodesWithChildren_LeavesFromSubgraph(); });
+	state += SoupTest::RunTest(className, "AddPhase_Diamond_SharedLeafOnce", [&testClass]() { testClass->AddPhase_Diamond_SharedLeafOnce(); });
+	state += SoupTest::RunTest(className, "AddPhase_Empty_NoChange", [&testClass]() { testClass->AddPhase_Empty_NoChange(); });
+
+	return state;
+}
\ No newline at end of file
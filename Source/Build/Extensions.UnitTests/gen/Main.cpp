@@ -8,6 +8,7 @@
 
 import Opal;
 import Soup.Build.Extensions;
+import Soup.Build.Runtime;
 import json11;
 import SoupTest;
 import SoupTestUtilities;
@@ -16,6 +17,8 @@ using namespace Opal;
 using namespace Opal::System;
 using namespace SoupTest;
 
+#include "BuiltInOperationTests.gen.h"
+#include "GraphBuilderTests.gen.h"
 #include "RecipeLanguageVersionTests.gen.h"
 #include "RecipeTypeTests.gen.h"
 
@@ -25,6 +28,8 @@ int main()
 
 	TestState state = { 0, 0 };
 
+	state += RunBuiltInOperationTests();
+	state += RunGraphBuilderTests();
 	state += RunRecipeLanguageVersionTests();
 	state += RunRecipeTypeTests();
 
@@ -4,6 +4,7 @@
 
 #pragma once
 #include "GraphNodeWrapper.h"
+#include "HostInterfaceVersion.h"
 #include "ValueTableWrapper.h"
 
 namespace Soup::Build::Extensions
@@ -54,16 +55,66 @@ namespace Soup::Build::Extensions
 			const std::vector<Path>& inputFiles,
 			const std::vector<Path>& outputFiles)
 		{
-			auto node = CreateNode();
+			auto programValue = program.ToString();
+			auto workingDirectoryValue = workingDirectory.ToString();
+			auto inputFileValues = ToStrings(inputFiles);
+			auto outputFileValues = ToStrings(outputFiles);
+			auto inputFilePointers = ToPointers(inputFileValues);
+			auto outputFilePointers = ToPointers(outputFileValues);
+
+			auto description = GraphNodeDescription({
+				title.c_str(),
+				programValue.c_str(),
+				arguments.c_str(),
+				workingDirectoryValue.c_str(),
+				inputFilePointers.size(),
+				inputFilePointers.data(),
+				outputFilePointers.size(),
+				outputFilePointers.data(),
+			});
+
+			auto nodes = CreateNodes(std::vector<GraphNodeDescription>({ description }));
+			return nodes.front();
+		}
 
-			node.SetTitle(title);
-			node.SetProgram(program.ToString());
-			node.SetArguments(arguments);
-			node.SetWorkingDirectory(workingDirectory.ToString());
-			node.GetInputFileList().SetAll(inputFiles);
-			node.GetOutputFileList().SetAll(outputFiles);
+		/// <summary>
+		/// Create a set of nodes from their packed descriptions with a single call across the boundary
+		/// Note: The strings referenced by the descriptions are copied into the nodes. Hosts without
+		/// the bulk entry point create and fill in each node separately.
+		/// </summary>
+		std::vector<GraphNodeWrapper> CreateNodes(const std::vector<GraphNodeDescription>& descriptions)
+		{
+			if (!HostInterfaceVersion::HasBulkTransfer())
+			{
+				auto nodes = std::vector<GraphNodeWrapper>();
+				nodes.reserve(descriptions.size());
+				for (auto& description : descriptions)
+				{
+					nodes.push_back(CreateNode(description));
+				}
+
+				return nodes;
+			}
+
+			auto result = std::vector<IGraphNode*>(descriptions.size(), nullptr);
+			auto status = static_cast<IBuildState2&>(_value).TryCreateNodes(
+				descriptions.size(),
+				descriptions.data(),
+				result.data());
+
+			// Store the out results to ensure we do not leak them by accident
+			auto nodes = std::vector<GraphNodeWrapper>();
+			nodes.reserve(result.size());
+			for (auto node : result)
+			{
+				if (node != nullptr)
+					nodes.push_back(GraphNodeWrapper(node));
+			}
 
-			return node;
+			if (status != 0)
+				throw std::runtime_error("TryCreateNodes Failed");
+
+			return nodes;
 		}
 
 		/// <summary>
@@ -121,6 +172,45 @@ namespace Soup::Build::Extensions
 				throw std::runtime_error("TryLogTrace Failed");
 		}
 
+	private:
+		GraphNodeWrapper CreateNode(const GraphNodeDescription& description)
+		{
+			auto node = CreateNode();
+
+			node.SetTitle(description.Title);
+			node.SetProgram(description.Program);
+			node.SetArguments(description.Arguments);
+			node.SetWorkingDirectory(description.WorkingDirectory);
+			node.GetInputFileList().SetAll(std::vector<std::string>(
+				description.InputFiles,
+				description.InputFiles + description.InputFileCount));
+			node.GetOutputFileList().SetAll(std::vector<std::string>(
+				description.OutputFiles,
+				description.OutputFiles + description.OutputFileCount));
+
+			return node;
+		}
+
+		static std::vector<std::string> ToStrings(const std::vector<Path>& values)
+		{
+			auto result = std::vector<std::string>();
+			result.reserve(values.size());
+			for (auto& value : values)
+				result.push_back(value.ToString());
+
+			return result;
+		}
+
+		static std::vector<const char*> ToPointers(const std::vector<std::string>& values)
+		{
+			auto result = std::vector<const char*>();
+			result.reserve(values.size());
+			for (auto& value : values)
+				result.push_back(value.c_str());
+
+			return result;
+		}
+
 	private:
 		IBuildState& _value;
 	};
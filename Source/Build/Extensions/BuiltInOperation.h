@@ -0,0 +1,183 @@
+// <copyright file="BuiltInOperation.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Extensions
+{
+	/// <summary>
+	/// The enumeration of operations the build runner executes in process
+	/// instead of spawning an external program
+	/// </summary>
+	export enum class BuiltInOperation
+	{
+		/// <summary>
+		/// Create a directory and all missing parents (mkdir -p)
+		/// </summary>
+		MakeDirectory,
+
+		/// <summary>
+		/// Copy a file, preferring a reflink when the file system supports it
+		/// </summary>
+		Copy,
+
+		/// <summary>
+		/// Create a hard link to a file, falling back to a copy
+		/// </summary>
+		HardLink,
+
+		/// <summary>
+		/// Create a symbolic link to a file
+		/// </summary>
+		SymbolicLink,
+
+		/// <summary>
+		/// Write a generated text file, the file is only touched when the content changes
+		/// </summary>
+		WriteFile,
+	};
+
+	/// <summary>
+	/// The program prefix that marks a graph node as a built in operation
+	/// </summary>
+	export constexpr std::string_view BuiltInProgramPrefix = "soup:";
+
+	export std::string ToString(BuiltInOperation value)
+	{
+		switch (value)
+		{
+			case BuiltInOperation::MakeDirectory:
+				return "mkdir";
+			case BuiltInOperation::Copy:
+				return "copy";
+			case BuiltInOperation::HardLink:
+				return "hardlink";
+			case BuiltInOperation::SymbolicLink:
+				return "symlink";
+			case BuiltInOperation::WriteFile:
+				return "write";
+			default:
+				throw std::runtime_error("Unknown built in operation.");
+		}
+	}
+
+	export BuiltInOperation ParseBuiltInOperation(std::string_view value)
+	{
+		if (value == "mkdir")
+			return BuiltInOperation::MakeDirectory;
+		else if (value == "copy")
+			return BuiltInOperation::Copy;
+		else if (value == "hardlink")
+			return BuiltInOperation::HardLink;
+		else if (value == "symlink")
+			return BuiltInOperation::SymbolicLink;
+		else if (value == "write")
+			return BuiltInOperation::WriteFile;
+		else
+			throw std::runtime_error("Unknown built in operation value.");
+	}
+
+	/// <summary>
+	/// Get the graph node program for a built in operation
+	/// </summary>
+	export std::string GetBuiltInProgram(BuiltInOperation value)
+	{
+		return std::string(BuiltInProgramPrefix) + ToString(value);
+	}
+
+	/// <summary>
+	/// Check if the graph node program is a built in operation
+	/// </summary>
+	export bool TryParseBuiltInProgram(std::string_view program, BuiltInOperation& result)
+	{
+		if (program.rfind(BuiltInProgramPrefix, 0) != 0)
+			return false;
+
+		result = ParseBuiltInOperation(program.substr(BuiltInProgramPrefix.size()));
+		return true;
+	}
+
+	/// <summary>
+	/// Format the built in operation arguments as a list of quoted values
+	/// Note: Quotes and backslashes inside a value are escaped with a backslash
+	/// </summary>
+	export std::string FormatBuiltInArguments(const std::vector<std::string>& values)
+	{
+		auto stream = std::stringstream();
+		bool isFirst = true;
+		for (auto& value : values)
+		{
+			if (!isFirst)
+				stream << " ";
+
+			stream << "\"";
+			for (auto character : value)
+			{
+				if (character == '"' || character == '\\')
+					stream << '\\';
+				stream << character;
+			}
+
+			stream << "\"";
+			isFirst = false;
+		}
+
+		return stream.str();
+	}
+
+	/// <summary>
+	/// Parse the list of quoted values from the built in operation arguments
+	/// </summary>
+	export std::vector<std::string> ParseBuiltInArguments(std::string_view value)
+	{
+		auto result = std::vector<std::string>();
+		size_t offset = 0;
+		while (offset < value.size())
+		{
+			if (value[offset] == ' ')
+			{
+				offset++;
+			}
+			else if (value[offset] == '"')
+			{
+				auto current = std::string();
+				bool isClosed = false;
+				offset++;
+				while (offset < value.size())
+				{
+					auto character = value[offset++];
+					if (character == '\\' && offset < value.size())
+					{
+						current.push_back(value[offset++]);
+					}
+					else if (character == '"')
+					{
+						isClosed = true;
+						break;
+					}
+					else
+					{
+						current.push_back(character);
+					}
+				}
+
+				if (!isClosed)
+					throw std::runtime_error("Missing closing quote in built in operation arguments.");
+
+				result.push_back(std::move(current));
+			}
+			else
+			{
+				auto end = value.find(' ', offset);
+				if (end == std::string_view::npos)
+					end = value.size();
+
+				result.push_back(std::string(value.substr(offset, end - offset)));
+				offset = end;
+			}
+		}
+
+		return result;
+	}
+}
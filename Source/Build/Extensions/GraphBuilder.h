@@ -0,0 +1,120 @@
+// <copyright file="GraphBuilder.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "GraphNodeWrapper.h"
+
+namespace Soup::Build::Extensions
+{
+	/// <summary>
+	/// Assembles a build graph one phase at a time, every node in a phase runs after all of the
+	/// nodes in the previous phase.
+	/// The current leaves are tracked so adding a phase only creates the new edges instead of
+	/// walking the existing graph from the roots.
+	/// </summary>
+	export class GraphBuilder
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the GraphBuilder class
+		/// </summary>
+		GraphBuilder() :
+			_roots(),
+			_leaves()
+		{
+		}
+
+		/// <summary>
+		/// Add a single node that runs after the current leaves
+		/// </summary>
+		void AddPhase(GraphNodeWrapper node)
+		{
+			auto nodes = std::vector<GraphNodeWrapper>({ node });
+			AddPhase(nodes);
+		}
+
+		/// <summary>
+		/// Add a set of independent nodes that run after the current leaves
+		/// Note: The nodes may already have their own children, the leaves of those subgraphs
+		/// become the new leaves
+		/// </summary>
+		void AddPhase(std::vector<GraphNodeWrapper>& nodes)
+		{
+			if (nodes.empty())
+				return;
+
+			// Find the new leaves before the phase is connected to the existing graph
+			auto leaves = FindLeaves(nodes);
+
+			if (_roots.empty())
+			{
+				_roots = nodes;
+			}
+			else
+			{
+				for (auto& leaf : _leaves)
+				{
+					leaf.GetChildList().Append(nodes);
+				}
+			}
+
+			_leaves = std::move(leaves);
+		}
+
+		/// <summary>
+		/// Get the root nodes of the graph
+		/// </summary>
+		const std::vector<GraphNodeWrapper>& GetRoots() const
+		{
+			return _roots;
+		}
+
+		/// <summary>
+		/// Get the leaf nodes that the next phase will run after
+		/// </summary>
+		const std::vector<GraphNodeWrapper>& GetLeaves() const
+		{
+			return _leaves;
+		}
+
+	private:
+		/// <summary>
+		/// Find the unique leaf nodes reachable from the provided nodes
+		/// </summary>
+		static std::vector<GraphNodeWrapper> FindLeaves(const std::vector<GraphNodeWrapper>& nodes)
+		{
+			auto result = std::vector<GraphNodeWrapper>();
+			auto visited = std::unordered_set<int64_t>();
+			auto pending = std::vector<GraphNodeWrapper>(nodes.rbegin(), nodes.rend());
+			while (!pending.empty())
+			{
+				auto node = pending.back();
+				pending.pop_back();
+				if (!visited.insert(node.GetId()).second)
+					continue;
+
+				auto children = node.GetChildList();
+				auto size = children.GetSize();
+				if (size == 0)
+				{
+					result.push_back(node);
+				}
+				else
+				{
+					// Keep the leaves in the order they are reached from the first node
+					for (auto i = size; i > 0; i--)
+					{
+						pending.push_back(children.GetValueAt(i - 1));
+					}
+				}
+			}
+
+			return result;
+		}
+
+	private:
+		std::vector<GraphNodeWrapper> _roots;
+		std::vector<GraphNodeWrapper> _leaves;
+	};
+}
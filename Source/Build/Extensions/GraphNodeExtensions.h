@@ -3,137 +3,99 @@
 // </copyright>
 
 #pragma once
+#include "GraphBuilder.h"
 
 namespace Soup::Build::Extensions
 {
 	/// <summary>
 	/// Build graph node extension methods
+	/// Note: Kept for one release so existing extensions still compile, each call now builds a
+	/// GraphBuilder for the parents and adds the children as the next phase. New code should
+	/// keep a single GraphBuilder for the whole graph instead.
 	/// </summary>
-	export class GraphNodeExtensions
+	export class [[deprecated("Use GraphBuilder")]] GraphNodeExtensions
 	{
 	public:
 		static void AddLeafChild(
 			GraphNodeWrapper parent,
 			GraphNodeWrapper child)
 		{
-			auto parentChildrenSize = parent.GetChildList().GetSize();
-			if (parentChildrenSize == 0)
-			{
-				// Check if this child was added through a different path
-				if (parent.GetId() == child.GetId())
-				{
-					// The node has been added through a different path
-					return;
-				}
-				else
-				{
-					// Add the new leaf node
-					parent.GetChildList().Append(child);
-				}
-			}
-			else
-			{
-				// Continue on to the current parents children
-				AddLeafChild(parent.GetChildList(), child);
-			}
+			auto parents = std::vector<GraphNodeWrapper>({ parent });
+			auto children = std::vector<GraphNodeWrapper>({ child });
+			AddLeafChildren(parents, children);
 		}
 
 		static void AddLeafChild(
 			GraphNodeListWrapper parents,
 			GraphNodeWrapper child)
 		{
-			auto size = parents.GetSize();
-			for (size_t i = 0; i < size; i++)
-			{
-				AddLeafChild(parents.GetValueAt(i), child);
-			}
+			auto parentValues = ToVector(parents);
+			auto children = std::vector<GraphNodeWrapper>({ child });
+			AddLeafChildren(parentValues, children);
 		}
 
 		static void AddLeafChild(
 			std::vector<GraphNodeWrapper>& parents,
 			GraphNodeWrapper child)
 		{
-			for (auto& parent : parents)
-			{
-				AddLeafChild(parent, child);
-			}
+			auto children = std::vector<GraphNodeWrapper>({ child });
+			AddLeafChildren(parents, children);
 		}
 
 		static void AddLeafChildren(
 			GraphNodeWrapper parent,
 			GraphNodeListWrapper children)
 		{
-			auto parentChildrenSize = parent.GetChildList().GetSize();
-			if (parentChildrenSize == 0)
-			{
-				// Add the new leaf nodes
-				parent.GetChildList().Append(children);
-			}
-			else
-			{
-				// Continue on to the current parents children
-				AddLeafChildren(parent.GetChildList(), children);
-			}
+			auto parents = std::vector<GraphNodeWrapper>({ parent });
+			auto childValues = ToVector(children);
+			AddLeafChildren(parents, childValues);
 		}
 
 		static void AddLeafChildren(
 			GraphNodeWrapper parent,
 			std::vector<GraphNodeWrapper>& children)
 		{
-			auto parentChildrenSize = parent.GetChildList().GetSize();
-			if (parentChildrenSize == 0)
-			{
-				// Add the new leaf nodes
-				parent.GetChildList().Append(children);
-			}
-			else
-			{
-				// Continue on to the current parents children
-				AddLeafChildren(parent.GetChildList(), children);
-			}
+			auto parents = std::vector<GraphNodeWrapper>({ parent });
+			AddLeafChildren(parents, children);
 		}
 
 		static void AddLeafChildren(
 			GraphNodeListWrapper parents,
 			GraphNodeListWrapper children)
 		{
-			auto size = parents.GetSize();
-			for (size_t i = 0; i < size; i++)
-			{
-				AddLeafChildren(parents.GetValueAt(i), children);
-			}
+			auto parentValues = ToVector(parents);
+			auto childValues = ToVector(children);
+			AddLeafChildren(parentValues, childValues);
 		}
 
 		static void AddLeafChildren(
 			GraphNodeListWrapper parents,
 			std::vector<GraphNodeWrapper>& children)
 		{
-			auto size = parents.GetSize();
-			
-			// Check if this is the same set we trying to add, from a different path
-			if (size > 0 && size == children.size())
-			{
-				if (parents.GetValueAt(0).GetId() == children[0].GetId())
-				{
-					// The children match the parent set
-					return;
-				}
-			}
-
-			for (size_t i = 0; i < size; i++)
-			{
-				AddLeafChildren(parents.GetValueAt(i), children);
-			}
+			auto parentValues = ToVector(parents);
+			AddLeafChildren(parentValues, children);
 		}
 
 		static void AddLeafChildren(
 			std::vector<GraphNodeWrapper>& parents,
 			std::vector<GraphNodeWrapper>& children)
 		{
-			for (auto& parent : parents)
+			auto builder = GraphBuilder();
+			builder.AddPhase(parents);
+			builder.AddPhase(children);
+		}
+
+	private:
+		static std::vector<GraphNodeWrapper> ToVector(const GraphNodeListWrapper& values)
+		{
+			auto result = std::vector<GraphNodeWrapper>();
+			auto size = values.GetSize();
+			for (uint64_t i = 0; i < size; i++)
 			{
-				AddLeafChildren(parent, children);
+				result.push_back(values.GetValueAt(i));
 			}
+
+			return result;
 		}
 	};
-}
+}
\ No newline at end of file
@@ -118,6 +118,48 @@ namespace Soup::Build::Extensions
 			return GraphNodeListWrapper(_value->GetChildList());
 		}
 
+		ResourceClass GetResourceClass() const
+		{
+			ThrowIfInvalid();
+			return static_cast<ResourceClass>(_value->GetResourceClass());
+		}
+
+		void SetResourceClass(ResourceClass value)
+		{
+			ThrowIfInvalid();
+			auto status = _value->TrySetResourceClass(static_cast<uint64_t>(value));
+			if (status != 0)
+				throw std::runtime_error("TrySetResourceClass Failed");
+		}
+
+		uint64_t GetMemoryWeight() const
+		{
+			ThrowIfInvalid();
+			return _value->GetMemoryWeight();
+		}
+
+		void SetMemoryWeight(uint64_t value)
+		{
+			ThrowIfInvalid();
+			auto status = _value->TrySetMemoryWeight(value);
+			if (status != 0)
+				throw std::runtime_error("TrySetMemoryWeight Failed");
+		}
+
+		uint64_t GetThreadCount() const
+		{
+			ThrowIfInvalid();
+			return _value->GetThreadCount();
+		}
+
+		void SetThreadCount(uint64_t value)
+		{
+			ThrowIfInvalid();
+			auto status = _value->TrySetThreadCount(value);
+			if (status != 0)
+				throw std::runtime_error("TrySetThreadCount Failed");
+		}
+
 		/// <summary>
 		/// Get raw access to the internal interface
 		/// </summary>
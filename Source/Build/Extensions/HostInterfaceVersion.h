@@ -0,0 +1,44 @@
+// <copyright file="HostInterfaceVersion.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Extensions
+{
+	/// <summary>
+	/// The version of the extension interfaces implemented by the host that owns the wrapped objects
+	/// Note: Defaults to version 1 so the wrappers only use the original entry points until the
+	/// host reports a newer version. Each extension library keeps its own copy of this value.
+	/// </summary>
+	export class HostInterfaceVersion
+	{
+	public:
+		/// <summary>
+		/// Get the reported host version
+		/// </summary>
+		static uint32_t Get() noexcept
+		{
+			return _version;
+		}
+
+		/// <summary>
+		/// Set the reported host version
+		/// </summary>
+		static void Set(uint32_t version) noexcept
+		{
+			_version = version;
+		}
+
+		/// <summary>
+		/// Check if the host implements the version 2 bulk transfer interfaces
+		/// </summary>
+		static bool HasBulkTransfer() noexcept
+		{
+			return _version >= 2;
+		}
+
+	private:
+		static inline uint32_t _version = 1;
+	};
+}
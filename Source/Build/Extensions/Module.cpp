@@ -2,8 +2,11 @@
 
 #include <any>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
 
 export module Soup.Build.Extensions;
@@ -13,6 +16,8 @@ import Soup.Build;
 using namespace Opal;
 
 #include "BuildStateWrapper.h"
+#include "BuiltInOperation.h"
+#include "GraphBuilder.h"
 #include "GraphNodeExtensions.h"
 #include "ValueListWrapper.h"
 #include "ValuePrimitiveWrapper.h"
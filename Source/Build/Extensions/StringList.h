@@ -6,7 +6,7 @@
 
 namespace Soup::Build::Extensions
 {
-	export class StringList : public IList<const char*>
+	export class StringList : public IList2<const char*>
 	{
 	public:
 		/// <summary>
@@ -92,6 +92,45 @@ namespace Soup::Build::Extensions
 			}
 		}
 		
+		/// <summary>
+		/// Bulk accessor methods
+		/// </summary>
+		OperationResult TryGetValues(uint64_t index, uint64_t count, const char** result) noexcept override final
+		{
+			try
+			{
+				if (index > _values.size() || count > _values.size() - index)
+					return -2;
+
+				for (uint64_t i = 0; i < count; i++)
+					result[i] = _values[index + i].c_str();
+
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		OperationResult TryAppendValues(uint64_t count, const char* const* values) noexcept override final
+		{
+			try
+			{
+				_values.reserve(_values.size() + count);
+				for (uint64_t i = 0; i < count; i++)
+					_values.push_back(values[i]);
+
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
 		/// <summary>
 		/// Internal accessor
 		/// </summary>
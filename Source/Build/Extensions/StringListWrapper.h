@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "HostInterfaceVersion.h"
 
 namespace Soup::Build::Extensions
 {
@@ -60,26 +61,23 @@ namespace Soup::Build::Extensions
 
 		/// <summary>
 		/// Extended helpers for easy updating of entire contents
+		/// Note: Uses the bulk entry points when the host has them to avoid a call across the
+		/// boundary per element
 		/// </summary>
 		std::vector<std::string> CopyAsStringVector() const
 		{
-			auto size = static_cast<size_t>(GetSize());
-			auto result = std::vector<std::string>(size);
-			for (size_t i = 0; i < size; i++)
-			{
-				result[i] = GetValueAt(i);
-			}
-
-			return result;
+			auto values = GetValues();
+			return std::vector<std::string>(values.begin(), values.end());
 		}
 
 		std::vector<Path> CopyAsPathVector() const
 		{
-			auto size = static_cast<size_t>(GetSize());
-			auto result = std::vector<Path>(size);
-			for (size_t i = 0; i < size; i++)
+			auto values = GetValues();
+			auto result = std::vector<Path>();
+			result.reserve(values.size());
+			for (auto value : values)
 			{
-				result[i] = Path(GetValueAt(i));
+				result.push_back(Path(value));
 			}
 
 			return result;
@@ -87,41 +85,79 @@ namespace Soup::Build::Extensions
 
 		void SetAll(const std::vector<std::string>& values)
 		{
-			Resize(static_cast<uint64_t>(values.size()));
-			for (size_t i = 0; i < values.size(); i++)
+			Resize(0);
+			Append(values);
+		}
+
+		void SetAll(const std::vector<Path>& values)
+		{
+			Resize(0);
+			Append(values);
+		}
+
+		void Append(const std::vector<std::string>& values)
+		{
+			auto pointers = std::vector<const char*>();
+			pointers.reserve(values.size());
+			for (auto& value : values)
 			{
-				SetValueAt(i, values[i]);
+				pointers.push_back(value.c_str());
 			}
+
+			AppendValues(pointers);
 		}
 
-		void SetAll(const std::vector<Path>& values)
+		void Append(const std::vector<Path>& values)
 		{
-			Resize(static_cast<uint64_t>(values.size()));
-			for (size_t i = 0; i < values.size(); i++)
+			auto strings = std::vector<std::string>();
+			strings.reserve(values.size());
+			for (auto& value : values)
 			{
-				SetValueAt(i, values[i].ToString());
+				strings.push_back(value.ToString());
 			}
+
+			Append(strings);
 		}
 
-		void Append(const std::vector<std::string>& values)
+	private:
+		std::vector<const char*> GetValues() const
 		{
-			auto currentSize = static_cast<size_t>(GetSize());
-			auto finalSize = currentSize + values.size();
-			Resize(static_cast<uint64_t>(finalSize));
-			for (size_t i = currentSize; i < finalSize; i++)
+			auto result = std::vector<const char*>(static_cast<size_t>(GetSize()));
+			if (HostInterfaceVersion::HasBulkTransfer())
+			{
+				auto status = static_cast<IList2<const char*>&>(_value).TryGetValues(0, result.size(), result.data());
+				if (status != 0)
+					throw std::runtime_error("TryGetValues Failed");
+			}
+			else
 			{
-				SetValueAt(i, values[i - currentSize]);
+				for (size_t i = 0; i < result.size(); i++)
+				{
+					auto status = _value.TryGetValueAt(i, result[i]);
+					if (status != 0)
+						throw std::runtime_error("TryGetValueAt Failed");
+				}
 			}
+
+			return result;
 		}
 
-		void Append(const std::vector<Path>& values)
+		void AppendValues(const std::vector<const char*>& values)
 		{
-			auto currentSize = static_cast<size_t>(GetSize());
-			auto finalSize = currentSize + values.size();
-			Resize(static_cast<uint64_t>(finalSize));
-			for (size_t i = currentSize; i < finalSize; i++)
+			if (HostInterfaceVersion::HasBulkTransfer())
+			{
+				auto status = static_cast<IList2<const char*>&>(_value).TryAppendValues(values.size(), values.data());
+				if (status != 0)
+					throw std::runtime_error("TryAppendValues Failed");
+			}
+			else
 			{
-				SetValueAt(i, values[i - currentSize].ToString());
+				auto currentSize = GetSize();
+				Resize(currentSize + values.size());
+				for (size_t i = 0; i < values.size(); i++)
+				{
+					SetValueAt(currentSize + i, values[i]);
+				}
 			}
 		}
 
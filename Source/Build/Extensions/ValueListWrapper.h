@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "HostInterfaceVersion.h"
 #include "ValueWrapper.h"
 
 namespace Soup::Build::Extensions
@@ -53,28 +54,23 @@ namespace Soup::Build::Extensions
 
 		/// <summary>
 		/// Extended helpers for easy updating of entire contents
+		/// Note: The string helpers use the bulk entry points when the host has them to avoid
+		/// a call across the boundary per element
 		/// </summary>
 		std::vector<std::string> CopyAsStringVector() const
 		{
-			auto size = static_cast<size_t>(GetSize());
-			auto result = std::vector<std::string>(size);
-			for (size_t i = 0; i < size; i++)
-			{
-				auto value = GetValueAt(i);
-				result[i] = value.AsString().GetValue();
-			}
-
-			return result;
+			auto values = GetStringValues();
+			return std::vector<std::string>(values.begin(), values.end());
 		}
 
 		std::vector<Path> CopyAsPathVector() const
 		{
-			auto size = static_cast<size_t>(GetSize());
-			auto result = std::vector<Path>(size);
-			for (size_t i = 0; i < size; i++)
+			auto values = GetStringValues();
+			auto result = std::vector<Path>();
+			result.reserve(values.size());
+			for (auto value : values)
 			{
-				auto value = GetValueAt(i);
-				result[i] = Path(value.AsString().GetValue());
+				result.push_back(Path(value));
 			}
 
 			return result;
@@ -82,20 +78,14 @@ namespace Soup::Build::Extensions
 
 		void SetAll(const std::vector<std::string>& values)
 		{
-			Resize(static_cast<uint64_t>(values.size()));
-			for (size_t i = 0; i < values.size(); i++)
-			{
-				GetValueAt(i).SetValueString(values[i]);
-			}
+			Resize(0);
+			Append(values);
 		}
 
 		void SetAll(const std::vector<Path>& values)
 		{
-			Resize(static_cast<uint64_t>(values.size()));
-			for (size_t i = 0; i < values.size(); i++)
-			{
-				GetValueAt(i).SetValueString(values[i].ToString());
-			}
+			Resize(0);
+			Append(values);
 		}
 
 		void SetAll(ValueListWrapper values)
@@ -111,26 +101,43 @@ namespace Soup::Build::Extensions
 
 		void Append(const std::vector<std::string>& values)
 		{
-			auto currentSize = static_cast<size_t>(GetSize());
-			auto finalSize = currentSize + values.size();
-			Resize(static_cast<uint64_t>(finalSize));
-			for (size_t i = currentSize; i < finalSize; i++)
+			if (!HostInterfaceVersion::HasBulkTransfer())
+			{
+				auto currentSize = GetSize();
+				Resize(currentSize + values.size());
+				for (size_t i = 0; i < values.size(); i++)
+				{
+					GetValueAt(currentSize + i).SetValueString(values[i]);
+				}
+
+				return;
+			}
+
+			auto pointers = std::vector<const char*>();
+			auto lengths = std::vector<uint64_t>();
+			pointers.reserve(values.size());
+			lengths.reserve(values.size());
+			for (auto& value : values)
 			{
-				auto& currentValue = values[i - currentSize];
-				GetValueAt(i).SetValueString(currentValue);
+				pointers.push_back(value.data());
+				lengths.push_back(value.size());
 			}
+
+			auto status = static_cast<IValueList2&>(_value).TryAppendStringValues(values.size(), pointers.data(), lengths.data());
+			if (status != 0)
+				throw std::runtime_error("TryAppendStringValues Failed");
 		}
 
 		void Append(const std::vector<Path>& values)
 		{
-			auto currentSize = static_cast<size_t>(GetSize());
-			auto finalSize = currentSize + values.size();
-			Resize(static_cast<uint64_t>(finalSize));
-			for (size_t i = currentSize; i < finalSize; i++)
+			auto strings = std::vector<std::string>();
+			strings.reserve(values.size());
+			for (auto& value : values)
 			{
-				auto& currentValue = values[i - currentSize];
-				GetValueAt(i).SetValueString(currentValue.ToString());
+				strings.push_back(value.ToString());
 			}
+
+			Append(strings);
 		}
 
 		void Append(ValueListWrapper values)
@@ -146,6 +153,28 @@ namespace Soup::Build::Extensions
 			}
 		}
 
+	private:
+		std::vector<const char*> GetStringValues() const
+		{
+			auto result = std::vector<const char*>(static_cast<size_t>(GetSize()));
+			if (HostInterfaceVersion::HasBulkTransfer())
+			{
+				auto status = static_cast<IValueList2&>(_value).TryGetStringValues(0, result.size(), result.data());
+				if (status != 0)
+					throw std::runtime_error("TryGetStringValues Failed");
+			}
+			else
+			{
+				for (size_t i = 0; i < result.size(); i++)
+				{
+					auto value = GetValueAt(i);
+					result[i] = value.AsString().GetValue();
+				}
+			}
+
+			return result;
+		}
+
 	private:
 		IValueList& _value;
 	};
@@ -0,0 +1,64 @@
+// <copyright file="BuildGraphArenaTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class BuildGraphArenaTests
+	{
+	public:
+		[[Fact]]
+		void CreateNode_Empty()
+		{
+			auto uut = BuildGraphArena();
+			auto node = uut.CreateNode();
+
+			Assert::AreEqual(std::string(""), std::string(node->GetTitle()), "Verify title is empty.");
+			Assert::IsTrue(node->GetInputFiles().empty(), "Verify no input files.");
+			Assert::AreEqual<size_t>(1, uut.GetNodeCount(), "Verify node count.");
+		}
+
+		[[Fact]]
+		void CreateNode_Properties()
+		{
+			auto uut = BuildGraphArena();
+			auto node = uut.CreateNode(
+				"Compile",
+				"compiler.exe",
+				"File.cpp",
+				"C:/Root/",
+				std::vector<std::string>({ "File.cpp" }),
+				std::vector<std::string>({ "File.obj" }));
+
+			Assert::AreEqual(std::string("Compile"), std::string(node->GetTitle()), "Verify title matches.");
+			Assert::AreEqual(std::string("compiler.exe"), std::string(node->GetProgram()), "Verify program matches.");
+			Assert::AreEqual(std::string("File.cpp"), std::string(node->GetArguments()), "Verify arguments match.");
+			Assert::AreEqual(std::string("C:/Root/"), std::string(node->GetWorkingDirectory()), "Verify working directory matches.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "File.cpp" }),
+				node->GetInputFiles(),
+				"Verify input files match.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "File.obj" }),
+				node->GetOutputFiles(),
+				"Verify output files match.");
+		}
+
+		[[Fact]]
+		void CreateNode_OwnedByArena()
+		{
+			auto uut = BuildGraphArena();
+			auto node = uut.CreateNode();
+
+			// Releasing the last external reference must not release the node
+			{
+				auto reference = Memory::Reference<IGraphNode>(node);
+				Assert::AreEqual<OperationResult>(0, reference->TrySetTitle("Link"), "Verify set title succeeded.");
+			}
+
+			Assert::AreEqual(std::string("Link"), std::string(node->GetTitle()), "Verify title matches.");
+		}
+	};
+}
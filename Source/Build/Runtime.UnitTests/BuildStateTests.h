@@ -0,0 +1,90 @@
+// <copyright file="BuildStateTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class BuildStateTests
+	{
+	public:
+		[[Fact]]
+		void TryCreateNodes_Multiple()
+		{
+			auto uut = BuildState();
+			auto inputFiles = std::vector<const char*>({ "File.cpp" });
+			auto outputFiles = std::vector<const char*>({ "File.obj", "File.pcm" });
+			auto descriptions = std::vector<GraphNodeDescription>({
+				GraphNodeDescription({
+					"Compile", "compiler.exe", "File.cpp", "C:/Root/",
+					inputFiles.size(), inputFiles.data(),
+					outputFiles.size(), outputFiles.data(),
+				}),
+				GraphNodeDescription({
+					"Link", "linker.exe", "File.obj", "C:/Root/",
+					0, nullptr,
+					0, nullptr,
+				}),
+			});
+
+			auto result = std::vector<IGraphNode*>(2, nullptr);
+			Assert::AreEqual<OperationResult>(
+				0,
+				uut.TryCreateNodes(descriptions.size(), descriptions.data(), result.data()),
+				"Verify create succeeded.");
+
+			auto compileNode = Memory::Reference<BuildGraphNode>(dynamic_cast<BuildGraphNode*>(result[0]));
+			auto linkNode = Memory::Reference<BuildGraphNode>(dynamic_cast<BuildGraphNode*>(result[1]));
+
+			Assert::AreEqual(std::string("Compile"), std::string(compileNode->GetTitle()), "Verify title matches.");
+			Assert::AreEqual(std::string("compiler.exe"), std::string(compileNode->GetProgram()), "Verify program matches.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "File.cpp" }),
+				compileNode->GetInputFiles(),
+				"Verify input files match.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "File.obj", "File.pcm" }),
+				compileNode->GetOutputFiles(),
+				"Verify output files match.");
+
+			Assert::AreEqual(std::string("Link"), std::string(linkNode->GetTitle()), "Verify title matches.");
+			Assert::IsTrue(linkNode->GetInputFiles().empty(), "Verify no input files.");
+			Assert::IsTrue(compileNode->GetId() != linkNode->GetId(), "Verify unique ids.");
+		}
+
+		[[Fact]]
+		void CreateNode_Wrapper_AllHostVersions()
+		{
+			// Version 1 hosts only have the per node setters
+			for (uint32_t version : { 1u, 2u })
+			{
+				Extensions::HostInterfaceVersion::Set(version);
+				auto state = BuildState();
+				auto uut = Extensions::BuildStateWrapper(state);
+				auto node = uut.CreateNode(
+					"Compile",
+					Path("compiler.exe"),
+					"File.cpp",
+					Path("C:/Root/"),
+					std::vector<Path>({ Path("File.cpp") }),
+					std::vector<Path>({ Path("File.obj"), Path("File.pcm") }));
+				Extensions::HostInterfaceVersion::Set(1);
+
+				auto rawNode = dynamic_cast<BuildGraphNode*>(node.GetRaw());
+				Assert::AreEqual(std::string("Compile"), std::string(rawNode->GetTitle()), "Verify title matches.");
+				Assert::AreEqual(std::string("compiler.exe"), std::string(rawNode->GetProgram()), "Verify program matches.");
+				Assert::AreEqual(std::string("File.cpp"), std::string(rawNode->GetArguments()), "Verify arguments match.");
+				Assert::AreEqual(std::string("C:/Root/"), std::string(rawNode->GetWorkingDirectory()), "Verify working directory matches.");
+				Assert::AreEqual(
+					std::vector<std::string>({ "File.cpp" }),
+					rawNode->GetInputFiles(),
+					"Verify input files match.");
+				Assert::AreEqual(
+					std::vector<std::string>({ "File.obj", "File.pcm" }),
+					rawNode->GetOutputFiles(),
+					"Verify output files match.");
+			}
+		}
+	};
+}
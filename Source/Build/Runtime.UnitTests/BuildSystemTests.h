@@ -0,0 +1,141 @@
+// <copyright file="BuildSystemTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	/// <summary>
+	/// A build task that records when it is executed
+	/// </summary>
+	class MockBuildTask : public Memory::ReferenceCounted<IBuildTask>
+	{
+	public:
+		MockBuildTask(
+			std::string name,
+			std::vector<std::string> runBeforeList,
+			std::vector<std::string> runAfterList,
+			std::vector<std::string>& executed) :
+			_name(std::move(name)),
+			_runBeforeList(std::move(runBeforeList)),
+			_runAfterList(std::move(runAfterList)),
+			_executed(executed)
+		{
+		}
+
+		const char* GetName() const noexcept override final
+		{
+			return _name.c_str();
+		}
+
+		IList<const char*>& GetRunBeforeList() noexcept override final
+		{
+			return _runBeforeList;
+		}
+
+		IList<const char*>& GetRunAfterList() noexcept override final
+		{
+			return _runAfterList;
+		}
+
+		OperationResult Execute(IBuildState& state) noexcept override final
+		{
+			_executed.push_back(_name);
+			return 0;
+		}
+
+	private:
+		std::string _name;
+		Extensions::StringList _runBeforeList;
+		Extensions::StringList _runAfterList;
+		std::vector<std::string>& _executed;
+	};
+
+	class BuildSystemTests
+	{
+	public:
+		[[Fact]]
+		void RegisterTask_Duplicate_Fails()
+		{
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			auto executed = std::vector<std::string>();
+			auto task1 = Memory::Reference<MockBuildTask>(new MockBuildTask("Task", {}, {}, executed));
+			auto task2 = Memory::Reference<MockBuildTask>(new MockBuildTask("Task", {}, {}, executed));
+
+			auto uut = BuildSystem();
+			Assert::AreEqual<OperationResult>(0, uut.RegisterTask(task1.GetRaw()), "Verify register succeeded.");
+			Assert::AreEqual<OperationResult>(-2, uut.RegisterTask(task2.GetRaw()), "Verify register duplicate failed.");
+		}
+
+		[[Fact]]
+		void Execute_DependencyOrder_Deterministic()
+		{
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			auto executed = std::vector<std::string>();
+			auto tasks = std::vector<Memory::Reference<MockBuildTask>>({
+				new MockBuildTask("Link", {}, { "Compile" }, executed),
+				new MockBuildTask("Compile", {}, { "Resolve" }, executed),
+				new MockBuildTask("Custom", {}, {}, executed),
+				new MockBuildTask("Resolve", { "Compile", "Link" }, {}, executed),
+				new MockBuildTask("Unknown", {}, { "Missing" }, executed),
+			});
+
+			auto uut = BuildSystem();
+			for (auto& task : tasks)
+				uut.RegisterTask(task.GetRaw());
+
+			auto state = BuildState();
+			uut.Execute(state);
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Custom",
+					"Resolve",
+					"Compile",
+					"Link",
+					"Unknown",
+				}),
+				executed,
+				"Verify the tasks ran in dependency and then registration order.");
+		}
+
+		[[Fact]]
+		void ResolveExecutionOrder_Cycle_Throws()
+		{
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			auto executed = std::vector<std::string>();
+			auto tasks = std::vector<Memory::Reference<MockBuildTask>>({
+				new MockBuildTask("First", {}, {}, executed),
+				new MockBuildTask("Second", { "Third" }, { "First", "Fourth" }, executed),
+				new MockBuildTask("Third", {}, {}, executed),
+				new MockBuildTask("Fourth", {}, { "Third" }, executed),
+			});
+
+			auto uut = BuildSystem();
+			for (auto& task : tasks)
+				uut.RegisterTask(task.GetRaw());
+
+			auto message = std::string();
+			try
+			{
+				uut.ResolveExecutionOrder();
+			}
+			catch (const std::runtime_error& error)
+			{
+				message = error.what();
+			}
+
+			Assert::AreEqual(
+				std::string("Build task dependency cycle: Third -> Fourth -> Second -> Third"),
+				message,
+				"Verify the cycle names the tasks involved.");
+		}
+	};
+}
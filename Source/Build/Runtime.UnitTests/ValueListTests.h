@@ -0,0 +1,127 @@
+// <copyright file="ValueListTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class ValueListTests
+	{
+	public:
+		[[Fact]]
+		void TryAppendStringValues_TryGetStringValues()
+		{
+			auto uut = ValueList();
+			auto values = std::vector<const char*>({ "Value1Ignored", "Value2" });
+			auto lengths = std::vector<uint64_t>({ 6, 6 });
+			Assert::AreEqual<OperationResult>(
+				0,
+				uut.TryAppendStringValues(values.size(), values.data(), lengths.data()),
+				"Verify append succeeded.");
+
+			Assert::AreEqual<uint64_t>(2, uut.GetSize(), "Verify size matches.");
+
+			auto result = std::vector<const char*>(2);
+			Assert::AreEqual<OperationResult>(0, uut.TryGetStringValues(0, 2, result.data()), "Verify get succeeded.");
+			Assert::AreEqual(std::string("Value1"), std::string(result[0]), "Verify first value matches.");
+			Assert::AreEqual(std::string("Value2"), std::string(result[1]), "Verify second value matches.");
+
+			Assert::AreEqual<OperationResult>(-2, uut.TryGetStringValues(1, 2, result.data()), "Verify out of range.");
+		}
+
+		[[Fact]]
+		void TryGetStringValues_WrongType()
+		{
+			auto uut = ValueList();
+			uut.GetValues().push_back(Value(int64_t(1)));
+
+			auto result = std::vector<const char*>(1);
+			Assert::AreEqual<OperationResult>(-2, uut.TryGetStringValues(0, 1, result.data()), "Verify wrong type.");
+		}
+
+		[[Fact]]
+		void Wrapper_SetAll_CopyAsStringVector_AllHostVersions()
+		{
+			// Version 1 hosts only have the per element accessors
+			for (uint32_t version : { 1u, 2u })
+			{
+				Extensions::HostInterfaceVersion::Set(version);
+				auto list = ValueList();
+				auto uut = Extensions::ValueListWrapper(list);
+				uut.SetAll(std::vector<std::string>({ "Value1", "Value2" }));
+				uut.Append(std::vector<std::string>({ "Value3" }));
+				auto actual = uut.CopyAsStringVector();
+				Extensions::HostInterfaceVersion::Set(1);
+
+				Assert::AreEqual(
+					std::vector<std::string>({ "Value1", "Value2", "Value3" }),
+					actual,
+					"Verify values match.");
+			}
+		}
+
+		[[Fact]]
+		void Append_SharesValues()
+		{
+			auto source = ValueList();
+			source.GetValues().push_back(Value(std::string("Value1")));
+
+			auto uut = ValueList();
+			uut.GetValues().push_back(Value(std::string("Value0")));
+			uut.Append(source);
+			uut.Append(source);
+
+			Assert::AreEqual<uint64_t>(3, uut.GetSize(), "Verify size matches.");
+
+			auto result = std::vector<const char*>(3);
+			Assert::AreEqual<OperationResult>(0, uut.TryGetStringValues(0, 3, result.data()), "Verify get succeeded.");
+			Assert::AreEqual(std::string("Value0"), std::string(result[0]), "Verify value matches.");
+			Assert::AreEqual(std::string("Value1"), std::string(result[1]), "Verify value matches.");
+			Assert::AreEqual(std::string("Value1"), std::string(result[2]), "Verify value matches.");
+
+			// Reading in place must not copy the shared values
+			const char* sourceResult = nullptr;
+			Assert::AreEqual<OperationResult>(0, source.TryGetStringValues(0, 1, &sourceResult), "Verify get succeeded.");
+			Assert::IsTrue(sourceResult == result[1], "Verify the values are shared.");
+		}
+
+		[[Fact]]
+		void Append_ModifyCopy_SourceUnchanged()
+		{
+			auto source = ValueList();
+			source.GetValues().push_back(Value(std::string("Value1")));
+
+			auto uut = ValueList();
+			uut.Append(source);
+
+			IValue* value = nullptr;
+			Assert::AreEqual<OperationResult>(0, uut.TryGetValueAt(0, value), "Verify get succeeded.");
+			IValuePrimitive<const char*>* stringValue = nullptr;
+			Assert::AreEqual<OperationResult>(0, value->TryGetAsString(stringValue), "Verify get string succeeded.");
+			Assert::AreEqual<OperationResult>(0, stringValue->TrySetValue("Updated"), "Verify set succeeded.");
+
+			Assert::AreEqual(std::string("[\"Updated\"]"), uut.ToString(), "Verify target updated.");
+			Assert::AreEqual(std::string("[\"Value1\"]"), source.ToString(), "Verify source unchanged.");
+		}
+
+		[[Fact]]
+		void Equality_AcrossSegments()
+		{
+			auto first = ValueList();
+			first.GetValues().push_back(Value(int64_t(1)));
+			auto second = ValueList();
+			second.GetValues().push_back(Value(int64_t(2)));
+
+			auto uut = ValueList();
+			uut.Append(first);
+			uut.Append(second);
+
+			auto expected = ValueList();
+			expected.GetValues().push_back(Value(int64_t(1)));
+			expected.GetValues().push_back(Value(int64_t(2)));
+
+			Assert::IsTrue(expected == uut, "Verify lists are equal.");
+		}
+	};
+}
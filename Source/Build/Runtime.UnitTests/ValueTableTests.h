@@ -0,0 +1,91 @@
+// <copyright file="ValueTableTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class ValueTableTests
+	{
+	public:
+		[[Fact]]
+		void Initialize()
+		{
+			auto uut = ValueTable();
+			Assert::IsTrue(uut.GetValues().empty(), "Verify the table is empty.");
+			Assert::IsTrue(uut.TryGetValue(ValueKeys::Build) == nullptr, "Verify missing value.");
+		}
+
+		[[Fact]]
+		void SetValue_TryGetValue()
+		{
+			auto uut = ValueTable();
+			uut.SetValue("Name", Value(std::string("Value1")));
+			uut.SetValue(ValueKeys::Build, Value(int64_t(123)));
+
+			IValue* result = nullptr;
+			Assert::AreEqual<OperationResult>(0, uut.TryGetValue("Name", result), "Verify get succeeded.");
+			Assert::AreEqual(std::string("Value1"), static_cast<Value*>(result)->ToString(), "Verify value matches.");
+
+			auto buildValue = uut.TryGetValue(ValueKeys::Build);
+			Assert::IsTrue(buildValue != nullptr, "Verify well known value found.");
+			Assert::AreEqual(std::string("123"), buildValue->ToString(), "Verify value matches.");
+
+			Assert::AreEqual<OperationResult>(-3, uut.TryGetValue("Missing", result), "Verify missing value.");
+		}
+
+		[[Fact]]
+		void SetValue_DuplicateThrows()
+		{
+			auto uut = ValueTable();
+			uut.SetValue("Name", Value(true));
+
+			Assert::ThrowsRuntimeError([&uut]() {
+				uut.SetValue("Name", Value(false));
+			});
+		}
+
+		[[Fact]]
+		void SetValue_ManyValues_AddressesStable()
+		{
+			auto uut = ValueTable();
+			IValue* first = nullptr;
+			Assert::AreEqual<OperationResult>(0, uut.TryCreateValue("Value0", first), "Verify create succeeded.");
+
+			for (int64_t i = 1; i < 1000; i++)
+			{
+				uut.SetValue("Value" + std::to_string(i), Value(i));
+			}
+
+			Assert::AreEqual<size_t>(1000, uut.GetValues().size(), "Verify value count.");
+			for (int64_t i = 1; i < 1000; i++)
+			{
+				auto value = uut.TryGetValue(ValueKey("Value" + std::to_string(i)));
+				Assert::IsTrue(value != nullptr, "Verify value found.");
+				Assert::AreEqual(std::to_string(i), value->ToString(), "Verify value matches.");
+			}
+
+			IValue* result = nullptr;
+			Assert::AreEqual<OperationResult>(0, uut.TryGetValue("Value0", result), "Verify get succeeded.");
+			Assert::IsTrue(first == result, "Verify the first value did not move.");
+		}
+
+		[[Fact]]
+		void Equality_IgnoresInsertionOrder()
+		{
+			auto lhs = ValueTable();
+			lhs.SetValue("A", Value(int64_t(1)));
+			lhs.SetValue("B", Value(std::string("Two")));
+
+			auto rhs = ValueTable();
+			rhs.SetValue("B", Value(std::string("Two")));
+			rhs.SetValue("A", Value(int64_t(1)));
+
+			Assert::IsTrue(lhs == rhs, "Verify tables are equal.");
+
+			rhs.SetValue("C", Value(3.0));
+			Assert::IsTrue(lhs != rhs, "Verify tables are not equal.");
+		}
+	};
+}
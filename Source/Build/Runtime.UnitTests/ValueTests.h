@@ -0,0 +1,60 @@
+// <copyright file="ValueTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class ValueTests
+	{
+	public:
+		[[Fact]]
+		void Initialize_Empty()
+		{
+			auto uut = Value();
+			Assert::IsTrue(ValueType::Empty == uut.GetType(), "Verify type matches.");
+		}
+
+		[[Fact]]
+		void TrySetType_String()
+		{
+			auto uut = Value();
+			Assert::AreEqual<OperationResult>(0, uut.TrySetType(static_cast<uint64_t>(ValueType::String)), "Verify set type succeeded.");
+			Assert::IsTrue(ValueType::String == uut.GetType(), "Verify type matches.");
+
+			IValuePrimitive<const char*>* result = nullptr;
+			Assert::AreEqual<OperationResult>(0, uut.TryGetAsString(result), "Verify get succeeded.");
+			Assert::AreEqual<OperationResult>(0, result->TrySetValue("Value"), "Verify set succeeded.");
+			Assert::AreEqual(std::string("Value"), uut.ToString(), "Verify value matches.");
+
+			IValuePrimitive<int64_t>* wrongResult = nullptr;
+			Assert::AreEqual<OperationResult>(-2, uut.TryGetAsInteger(wrongResult), "Verify wrong type.");
+		}
+
+		[[Fact]]
+		void Copy_Table_IsDeep()
+		{
+			auto table = ValueTable();
+			table.SetValue("Name", Value(std::string("Value1")));
+			auto uut = Value(std::move(table));
+
+			auto copy = uut;
+			Assert::IsTrue(uut == copy, "Verify copy is equal.");
+			Assert::IsTrue(&uut.AsTable() != &copy.AsTable(), "Verify copy owns its table.");
+
+			copy.AsTable().SetValue("Other", Value(false));
+			Assert::IsTrue(uut != copy, "Verify copy is independent.");
+		}
+
+		[[Fact]]
+		void Move_Table_AddressStable()
+		{
+			auto uut = Value(ValueTable());
+			auto table = &uut.AsTable();
+
+			auto moved = std::move(uut);
+			Assert::IsTrue(table == &moved.AsTable(), "Verify the table did not move.");
+		}
+	};
+}
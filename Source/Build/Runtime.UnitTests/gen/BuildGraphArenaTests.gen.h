@@ -0,0 +1,14 @@
+#pragma once
+#include "BuildGraphArenaTests.h"
+
+TestState RunBuildGraphArenaTests() 
+ {
+	auto className = "BuildGraphArenaTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::BuildGraphArenaTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "CreateNode_Empty", [&testClass]() { testClass->CreateNode_Empty(); });
+	state += SoupTest::RunTest(className, "CreateNode_Properties", [&testClass]() { testClass->CreateNode_Properties(); });
+	state += SoupTest::RunTest(className, "CreateNode_OwnedByArena", [&testClass]() { testClass->CreateNode_OwnedByArena(); });
+
+	return state;
+}
\ No newline at end of file
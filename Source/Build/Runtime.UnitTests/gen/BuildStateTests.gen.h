@@ -0,0 +1,13 @@
+#pragma once
+#include "BuildStateTests.h"
+
+TestState RunBuildStateTests() 
+ {
+	auto className = "BuildStateTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::BuildStateTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "TryCreateNodes_Multiple", [&testClass]() { testClass->TryCreateNodes_Multiple(); });
+	state += SoupTest::RunTest(className, "CreateNode_Wrapper_AllHostVersions", [&testClass]() { testClass->CreateNode_Wrapper_AllHostVersions(); });
+
+	return state;
+}
\ No newline at end of file
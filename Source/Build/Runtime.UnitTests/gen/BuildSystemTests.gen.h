@@ -0,0 +1,14 @@
+#pragma once
+#include "BuildSystemTests.h"
+
+TestState RunBuildSystemTests() 
+ {
+	auto className = "BuildSystemTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::BuildSystemTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "RegisterTask_Duplicate_Fails", [&testClass]() { testClass->RegisterTask_Duplicate_Fails(); });
+	state += SoupTest::RunTest(className, "Execute_DependencyOrder_Deterministic", [&testClass]() { testClass->Execute_DependencyOrder_Deterministic(); });
+	state += SoupTest::RunTest(className, "ResolveExecutionOrder_Cycle_Throws", [&testClass]() { testClass->ResolveExecutionOrder_Cycle_Throws(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+import Opal;
+import Soup.Build;
+import Soup.Build.Extensions;
+import Soup.Build.Runtime;
+import SoupTest;
+import SoupTestUtilities;
+
+using namespace Opal;
+using namespace Opal::System;
+using namespace Soup::Build;
+using namespace Soup::Build::Runtime;
+using namespace SoupTest;
+
+#include "BuildGraphArenaTests.gen.h"
+#include "BuildStateTests.gen.h"
+#include "BuildSystemTests.gen.h"
+#include "ValueListTests.gen.h"
+#include "ValueTableTests.gen.h"
+#include "ValueTests.gen.h"
+
+int main()
+{
+	std::cout << "Running Tests..." << std::endl;
+
+	TestState state = { 0, 0 };
+
+	state += RunBuildGraphArenaTests();
+	state += RunBuildStateTests();
+	state += RunBuildSystemTests();
+	state += RunValueListTests();
+	state += RunValueTableTests();
+	state += RunValueTests();
+
+	std::cout << state.PassCount << " PASSED." << std::endl;
+	std::cout << state.FailCount << " FAILED." << std::endl;
+
+	return 0;
+}
\ No newline at end of file
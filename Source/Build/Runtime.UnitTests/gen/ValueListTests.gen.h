@@ -0,0 +1,17 @@
+#pragma once
+#include "ValueListTests.h"
+
+TestState RunValueListTests() 
+ {
+	auto className = "ValueListTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::ValueListTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "TryAppendStringValues_TryGetStringValues", [&testClass]() { testClass->TryAppendStringValues_TryGetStringValues(); });
+	state += SoupTest::RunTest(className, "TryGetStringValues_WrongType", [&testClass]() { testClass->TryGetStringValues_WrongType(); });
+	state += SoupTest::RunTest(className, "Wrapper_SetAll_CopyAsStringVector_AllHostVersions", [&testClass]() { testClass->Wrapper_SetAll_CopyAsStringVector_AllHostVersions(); });
+	state += SoupTest::RunTest(className, "Append_SharesValues", [&testClass]() { testClass->Append_SharesValues(); });
+	state += SoupTest::RunTest(className, "Append_ModifyCopy_SourceUnchanged", [&testClass]() { testClass->Append_ModifyCopy_SourceUnchanged(); });
+	state += SoupTest::RunTest(className, "Equality_AcrossSegments", [&testClass]() { testClass->Equality_AcrossSegments(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "ValueTableTests.h"
+
+TestState RunValueTableTests() 
+ {
+	auto className = "ValueTableTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::ValueTableTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += SoupTest::RunTest(className, "SetValue_TryGetValue", [&testClass]() { testClass->SetValue_TryGetValue(); });
+	state += SoupTest::RunTest(className, "SetValue_DuplicateThrows", [&testClass]() { testClass->SetValue_DuplicateThrows(); });
+	state += SoupTest::RunTest(className, "SetValue_ManyValues_AddressesStable", [&testClass]() { testClass->SetValue_ManyValues_AddressesStable(); });
+	state += SoupTest::RunTest(className, "Equality_IgnoresInsertionOrder", [&testClass]() { testClass->Equality_IgnoresInsertionOrder(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include "ValueTests.h"
+
+TestState RunValueTests() 
+ {
+	auto className = "ValueTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::ValueTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Initialize_Empty", [&testClass]() { testClass->Initialize_Empty(); });
+	state += SoupTest::RunTest(className, "TrySetType_String", [&testClass]() { testClass->TrySetType_String(); });
+	state += SoupTest::RunTest(className, "Copy_Table_IsDeep", [&testClass]() { testClass->Copy_Table_IsDeep(); });
+	state += SoupTest::RunTest(className, "Move_Table_AddressStable", [&testClass]() { testClass->Move_Table_AddressStable(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+// <copyright file="BuildGraphArena.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "BuildGraphNode.h"
+
+namespace Soup::Build::Runtime
+{
+	/// <summary>
+	/// The arena that owns all of the graph nodes created for a single package build
+	/// Note: The nodes and their strings are carved out of a monotonic buffer and the whole
+	/// graph is released in one shot when the arena is destroyed. References to the nodes
+	/// must not outlive the arena.
+	/// </summary>
+	export class BuildGraphArena
+	{
+	private:
+		static constexpr size_t InitialBufferSize = 64 * 1024;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the BuildGraphArena class
+		/// </summary>
+		BuildGraphArena() :
+			_resource(InitialBufferSize),
+			_nodes()
+		{
+		}
+
+		BuildGraphArena(const BuildGraphArena&) = delete;
+		BuildGraphArena& operator =(const BuildGraphArena&) = delete;
+
+		~BuildGraphArena()
+		{
+			// Run the node destructors before the buffer they live in is released
+			_nodes.clear();
+		}
+
+		/// <summary>
+		/// Create a new node that is owned by the arena
+		/// </summary>
+		template<typename... TArgs>
+		BuildGraphNode* CreateNode(TArgs&&... args)
+		{
+			auto node = new (_resource) BuildGraphNode(&_resource, std::forward<TArgs>(args)...);
+			_nodes.push_back(node);
+			return node;
+		}
+
+		/// <summary>
+		/// Gets the number of nodes owned by the arena
+		/// </summary>
+		size_t GetNodeCount() const
+		{
+			return _nodes.size();
+		}
+
+	private:
+		std::pmr::monotonic_buffer_resource _resource;
+		std::vector<Memory::Reference<BuildGraphNode>> _nodes;
+	};
+}
@@ -9,15 +9,70 @@ namespace Soup::Build::Runtime
 {
 	/// <summary>
 	/// A graph node that represents a single operation in the build
+	/// Note: A node created in a build graph arena keeps its strings in the arena and its
+	/// memory is only released with the arena, the reference count just runs the destructor
 	/// </summary>
 	export class BuildGraphNode : public Memory::ReferenceCounted<IGraphNode>
 	{
 	private:
 		inline static std::atomic<int> UniqueId = 0;
 
+		/// <summary>
+		/// The header in front of every node that records where the node was allocated
+		/// </summary>
+		struct alignas(std::max_align_t) AllocationHeader
+		{
+			std::pmr::memory_resource* Arena;
+		};
+
 	public:
+		/// <summary>
+		/// Allocate a node on the heap
+		/// </summary>
+		static void* operator new(size_t size)
+		{
+			return Allocate(size, nullptr);
+		}
+
+		/// <summary>
+		/// Allocate a node in a build graph arena
+		/// </summary>
+		static void* operator new(size_t size, std::pmr::memory_resource& arena)
+		{
+			return Allocate(size, &arena);
+		}
+
+		/// <summary>
+		/// Release a node, arena memory is left for the arena to release in one shot
+		/// </summary>
+		static void operator delete(void* memory) noexcept
+		{
+			auto header = static_cast<AllocationHeader*>(memory) - 1;
+			if (header->Arena == nullptr)
+				::operator delete(header);
+		}
+
+		static void operator delete(void*, std::pmr::memory_resource&) noexcept
+		{
+		}
+
 		BuildGraphNode() :
-			_id(++UniqueId)
+			BuildGraphNode(std::pmr::get_default_resource())
+		{
+		}
+
+		BuildGraphNode(std::pmr::memory_resource* resource) :
+			_id(++UniqueId),
+			_title(resource),
+			_program(resource),
+			_arguments(resource),
+			_workingDirectory(resource),
+			_inputFiles(),
+			_outputFiles(),
+			_children(),
+			_resourceClass(ResourceClass::Generic),
+			_memoryWeight(0),
+			_threadCount(1)
 		{
 		}
 
@@ -28,14 +83,36 @@ namespace Soup::Build::Runtime
 			std::string workingDirectory,
 			std::vector<std::string> inputFiles,
 			std::vector<std::string> outputFiles) :
-			_id(UniqueId++),
-			_title(std::move(title)),
-			_program(std::move(program)),
-			_arguments(std::move(arguments)),
-			_workingDirectory(std::move(workingDirectory)),
+			BuildGraphNode(
+				std::pmr::get_default_resource(),
+				title,
+				program,
+				arguments,
+				workingDirectory,
+				std::move(inputFiles),
+				std::move(outputFiles))
+		{
+		}
+
+		BuildGraphNode(
+			std::pmr::memory_resource* resource,
+			std::string_view title,
+			std::string_view program,
+			std::string_view arguments,
+			std::string_view workingDirectory,
+			std::vector<std::string> inputFiles,
+			std::vector<std::string> outputFiles) :
+			_id(++UniqueId),
+			_title(title, resource),
+			_program(program, resource),
+			_arguments(arguments, resource),
+			_workingDirectory(workingDirectory, resource),
 			_inputFiles(std::move(inputFiles)),
 			_outputFiles(std::move(outputFiles)),
-			_children()
+			_children(),
+			_resourceClass(ResourceClass::Generic),
+			_memoryWeight(0),
+			_threadCount(1)
 		{
 		}
 
@@ -47,14 +124,17 @@ namespace Soup::Build::Runtime
 			std::vector<std::string> inputFiles,
 			std::vector<std::string> outputFiles,
 			std::vector<Memory::Reference<BuildGraphNode>> children) :
-			_id(UniqueId++),
-			_title(std::move(title)),
-			_program(std::move(program)),
-			_arguments(std::move(arguments)),
-			_workingDirectory(std::move(workingDirectory)),
+			_id(++UniqueId),
+			_title(title),
+			_program(program),
+			_arguments(arguments),
+			_workingDirectory(workingDirectory),
 			_inputFiles(std::move(inputFiles)),
 			_outputFiles(std::move(outputFiles)),
-			_children(std::move(children))
+			_children(std::move(children)),
+			_resourceClass(ResourceClass::Generic),
+			_memoryWeight(0),
+			_threadCount(1)
 		{
 			// TODO: Verify circular references in debug build
 		}
@@ -158,6 +238,54 @@ namespace Soup::Build::Runtime
 			return _children;
 		}
 
+		uint64_t GetResourceClass() const noexcept override final
+		{
+			return static_cast<uint64_t>(_resourceClass);
+		}
+
+		OperationResult TrySetResourceClass(uint64_t value) noexcept override final
+		{
+			switch (static_cast<ResourceClass>(value))
+			{
+				case ResourceClass::Generic:
+				case ResourceClass::Compile:
+				case ResourceClass::Link:
+				case ResourceClass::Archive:
+				case ResourceClass::Copy:
+					_resourceClass = static_cast<ResourceClass>(value);
+					return 0;
+				default:
+					// Unknown resource class
+					return -2;
+			}
+		}
+
+		uint64_t GetMemoryWeight() const noexcept override final
+		{
+			return _memoryWeight;
+		}
+
+		OperationResult TrySetMemoryWeight(uint64_t value) noexcept override final
+		{
+			_memoryWeight = value;
+			return 0;
+		}
+
+		uint64_t GetThreadCount() const noexcept override final
+		{
+			return _threadCount;
+		}
+
+		OperationResult TrySetThreadCount(uint64_t value) noexcept override final
+		{
+			// Every operation occupies at least one job slot
+			if (value == 0)
+				return -2;
+
+			_threadCount = value;
+			return 0;
+		}
+
 		/// <summary>
 		/// Internal accessors
 		/// </summary>
@@ -176,14 +304,28 @@ namespace Soup::Build::Runtime
 			return _children.GetValues();
 		}
 
+	private:
+		static void* Allocate(size_t size, std::pmr::memory_resource* arena)
+		{
+			auto totalSize = sizeof(AllocationHeader) + size;
+			auto memory = arena == nullptr ?
+				::operator new(totalSize) :
+				arena->allocate(totalSize, alignof(AllocationHeader));
+			auto header = ::new (memory) AllocationHeader({ arena });
+			return header + 1;
+		}
+
 	private:
 		int64_t _id;
-		std::string _title;
-		std::string _program;
-		std::string _arguments;
-		std::string _workingDirectory;
+		std::pmr::string _title;
+		std::pmr::string _program;
+		std::pmr::string _arguments;
+		std::pmr::string _workingDirectory;
 		Extensions::StringList _inputFiles;
 		Extensions::StringList _outputFiles;
 		BuildGraphNodeList _children;
+		ResourceClass _resourceClass;
+		uint64_t _memoryWeight;
+		uint64_t _threadCount;
 	};
 }
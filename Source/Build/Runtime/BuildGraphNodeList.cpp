@@ -107,6 +107,52 @@ namespace Soup::Build::Runtime
 #endif
 	}
 
+	OperationResult BuildGraphNodeList::TryGetValues(uint64_t index, uint64_t count, IGraphNode** result) noexcept
+	{
+		try
+		{
+			if (index > _values.size() || count > _values.size() - index)
+				return -2;
+
+			for (uint64_t i = 0; i < count; i++)
+				result[i] = _values[index + i].GetRaw();
+
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	OperationResult BuildGraphNodeList::TryAppendValues(uint64_t count, IGraphNode* const* values) noexcept
+	{
+		try
+		{
+			// Verify all of the values before modifying the list
+			auto internalValues = std::vector<BuildGraphNode*>(count);
+			for (uint64_t i = 0; i < count; i++)
+			{
+				internalValues[i] = dynamic_cast<BuildGraphNode*>(values[i]);
+				if (internalValues[i] == nullptr)
+					return -2;
+			}
+
+			auto currentSize = _values.size();
+			_values.resize(currentSize + count);
+			for (uint64_t i = 0; i < count; i++)
+				SetValueAt(currentSize + i, internalValues[i]);
+
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
 	const std::vector<Memory::Reference<BuildGraphNode>>& BuildGraphNodeList::GetValues() const
 	{
 		return _values;
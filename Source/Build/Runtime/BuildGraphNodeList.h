@@ -11,7 +11,7 @@ namespace Soup::Build::Runtime
 	/// <summary>
 	/// Build list implementation for simple objects
 	/// </summary>
-	export class BuildGraphNodeList : public IList<IGraphNode*>
+	export class BuildGraphNodeList : public IList2<IGraphNode*>
 	{
 	public:
 		/// <summary>
@@ -39,6 +39,12 @@ namespace Soup::Build::Runtime
 
 		void SetValueAt(uint64_t index, BuildGraphNode* value);
 
+		/// <summary>
+		/// Bulk accessor methods
+		/// </summary>
+		OperationResult TryGetValues(uint64_t index, uint64_t count, IGraphNode** result) noexcept override final;
+		OperationResult TryAppendValues(uint64_t count, IGraphNode* const* values) noexcept override final;
+
 		/// <summary>
 		/// Internal access
 		/// </summary>
@@ -10,7 +10,7 @@ namespace Soup::Build::Runtime
 	/// Build list implementation for simple objects
 	/// </summary>
 	template<typename T>
-	class BuildSimpleList : public IList<T>
+	class BuildSimpleList : public IList2<T>
 	{
 	public:
 		/// <summary>
@@ -77,6 +77,40 @@ namespace Soup::Build::Runtime
 			}
 		}
 
+		/// <summary>
+		/// Bulk accessor methods
+		/// </summary>
+		OperationResult TryGetValues(uint64_t index, uint64_t count, T* result) noexcept override final
+		{
+			try
+			{
+				if (index > _value.size() || count > _value.size() - index)
+					return -2;
+
+				std::copy_n(_value.begin() + index, count, result);
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		OperationResult TryAppendValues(uint64_t count, const T* values) noexcept override final
+		{
+			try
+			{
+				_value.insert(_value.end(), values, values + count);
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
 	private:
 		std::vector<T> _value;
 	};
@@ -3,7 +3,7 @@
 // </copyright>
 
 #pragma once
-#include "BuildGraphNode.h"
+#include "BuildGraphArena.h"
 #include "ValueTable.h"
 
 namespace Soup::Build::Runtime
@@ -11,13 +11,14 @@ namespace Soup::Build::Runtime
 	/// <summary>
 	/// Build State Extension interface
 	/// </summary>
-	export class BuildState : public IBuildState
+	export class BuildState : public IBuildState2
 	{
 	public:
 		/// <summary>
 		/// Initializes a new instance of the BuildState class
 		/// </summary>
 		BuildState() :
+			_arena(std::make_shared<BuildGraphArena>()),
 			_nodes(),
 			_activeState(),
 			_parentState()
@@ -28,12 +29,26 @@ namespace Soup::Build::Runtime
 		/// Initializes a new instance of the BuildState class
 		/// </summary>
 		BuildState(ValueTable recipeState) :
+			_arena(std::make_shared<BuildGraphArena>()),
 			_nodes(),
 			_activeState(),
 			_parentState()
 		{
 			// Initialize the Recipe state
-			_activeState.SetValue("Recipe", Value(std::move(recipeState)));
+			_activeState.SetValue(ValueKeys::Recipe, Value(std::move(recipeState)));
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the BuildState class with an external recipe state
+		/// </summary>
+		BuildState(std::shared_ptr<IValue> recipeState) :
+			_arena(std::make_shared<BuildGraphArena>()),
+			_nodes(),
+			_activeState(),
+			_parentState()
+		{
+			// Initialize the Recipe state
+			_activeState.SetValue(ValueKeys::Recipe, Value(std::move(recipeState)));
 		}
 
 		/// <summary>
@@ -61,7 +76,7 @@ namespace Soup::Build::Runtime
 		{
 			try
 			{
-				node = new BuildGraphNode();
+				node = _arena->CreateNode();
 				return 0;
 			}
 			catch (...)
@@ -125,6 +140,45 @@ namespace Soup::Build::Runtime
 			}
 		}
 
+		OperationResult TryCreateNodes(
+			uint64_t count,
+			const GraphNodeDescription* descriptions,
+			IGraphNode** result) noexcept override final
+		{
+			try
+			{
+				// Do not hand out any nodes unless all of them were created
+				// Note: Nodes from a failed batch stay in the arena until it is released
+				auto nodes = std::vector<BuildGraphNode*>();
+				nodes.reserve(count);
+				for (uint64_t i = 0; i < count; i++)
+				{
+					auto& description = descriptions[i];
+					nodes.push_back(_arena->CreateNode(
+						description.Title,
+						description.Program,
+						description.Arguments,
+						description.WorkingDirectory,
+						std::vector<std::string>(
+							description.InputFiles,
+							description.InputFiles + description.InputFileCount),
+						std::vector<std::string>(
+							description.OutputFiles,
+							description.OutputFiles + description.OutputFileCount)));
+				}
+
+				for (uint64_t i = 0; i < count; i++)
+					result[i] = nodes[i];
+
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
 		/// <summary>
 		/// Internal access to build nodes
 		/// </summary>
@@ -144,7 +198,27 @@ namespace Soup::Build::Runtime
 		/// </summary>
 		void CombineChildState(BuildState& childState)
 		{
-			CombineListState(childState._parentState, Extensions::ValueTableWrapper(_activeState));
+			CombineListState(childState._parentState, _activeState);
+		}
+
+		/// <summary>
+		/// Release the active state once the build graph has been generated
+		/// Note: Only the parent state is needed by downstream packages
+		/// </summary>
+		void CompactActiveState()
+		{
+			_activeState = ValueTable();
+		}
+
+		/// <summary>
+		/// Release the build nodes once the build graph has been executed
+		/// Note: The root references are dropped before the arena that owns every node
+		/// </summary>
+		void CompactBuildNodes()
+		{
+			_nodes.clear();
+			_nodes.shrink_to_fit();
+			_arena = std::make_shared<BuildGraphArena>();
 		}
 
 		void LogActive()
@@ -155,9 +229,10 @@ namespace Soup::Build::Runtime
 	private:
 		/// <summary>
 		/// Combine the table and list structure from the input state into the target
-		/// Note: Ignores primitive value properties on a table
+		/// Note: Ignores primitive value properties on a table. The lists share the storage
+		/// of the input lists instead of copying every value.
 		/// </summary>
-		void CombineListState(ValueTable& input, Extensions::ValueTableWrapper target)
+		void CombineListState(ValueTable& input, ValueTable& target)
 		{
 			// Enumerate over all property values
 			// Recursively combine tables and concatenate lists
@@ -171,12 +246,11 @@ namespace Soup::Build::Runtime
 						// Attempt to create the table in the target and recurse the merge
 						CombineListState(
 							value.AsTable(),
-							target.EnsureValue(name).EnsureTable());
+							target.EnsureValue(ValueKey(name)).EnsureTable());
 						break;
 					case ValueType::List:
 						// Attempt to create the list on the target and concatenate the input
-						target.EnsureValue(name).EnsureList().Append(
-							Extensions::ValueListWrapper(value.AsList()));
+						target.EnsureValue(ValueKey(name)).EnsureList().Append(value.AsList());
 						break;
 					default:
 						// Ignore all other types
@@ -187,6 +261,8 @@ namespace Soup::Build::Runtime
 		}
 
 	private:
+		// Note: The arena must be declared first so it outlives the node references
+		std::shared_ptr<BuildGraphArena> _arena;
 		std::vector<Memory::Reference<BuildGraphNode>> _nodes;
 		ValueTable _activeState;
 		ValueTable _parentState;
@@ -1,4 +1,4 @@
-﻿// <copyright file="BuildSystem.h" company="Soup">
+// <copyright file="BuildSystem.h" company="Soup">
 // Copyright (c) Soup. All rights reserved.
 // </copyright>
 
@@ -11,21 +11,27 @@ namespace Soup::Build::Runtime
 	{
 	public:
 		BuildTaskContainer(
+			std::string name,
 			Memory::Reference<IBuildTask> task,
 			std::vector<std::string> runBeforeList,
 			std::vector<std::string> runAfterList) :
+			Name(std::move(name)),
 			Task(std::move(task)),
 			RunBeforeList(std::move(runBeforeList)),
 			RunAfterList(std::move(runAfterList)),
-			HasRun(false)
+			Dependencies(),
+			Dependents()
 		{
 		}
 
+		std::string Name;
 		Memory::Reference<IBuildTask> Task;
 		std::vector<std::string> RunBeforeList;
 		std::vector<std::string> RunAfterList;
-		std::vector<std::string> RunAfterClosureList;
-		bool HasRun;
+
+		// The resolved ids of the tasks that must run before and after this task
+		std::vector<size_t> Dependencies;
+		std::vector<size_t> Dependents;
 	};
 
 	/// <summary>
@@ -38,7 +44,8 @@ namespace Soup::Build::Runtime
 		/// Initializes a new instance of the <see cref="BuildSystem"/> class.
 		/// </summary>
 		BuildSystem() :
-			_tasks()
+			_tasks(),
+			_taskIds()
 		{
 		}
 
@@ -55,6 +62,7 @@ namespace Soup::Build::Runtime
 				Log::Diag("RegisterTask: " + taskName);
 
 				auto taskContainer = BuildTaskContainer(
+					taskName,
 					ourTask,
 					Extensions::StringListWrapper(ourTask->GetRunBeforeList()).CopyAsStringVector(),
 					Extensions::StringListWrapper(ourTask->GetRunAfterList()).CopyAsStringVector());
@@ -89,13 +97,15 @@ namespace Soup::Build::Runtime
 				runAfterMessage << "]";
 				Log::Diag(runAfterMessage.str());
 
-				auto insertResult = _tasks.try_emplace(taskName, std::move(taskContainer));
+				auto insertResult = _taskIds.try_emplace(taskName, _tasks.size());
 				if (!insertResult.second)
 				{
 					Log::HighPriority("A task with the provided name has already been registered: " + taskName);
 					return -2;
 				}
 
+				_tasks.push_back(std::move(taskContainer));
+
 				return 0;
 			}
 			catch (...)
@@ -106,43 +116,18 @@ namespace Soup::Build::Runtime
 		}
 
 		/// <summary>
-		/// Get the set of added include paths
+		/// Run all registered tasks in dependency order
+		/// Note: All tasks share the single active build state through the extension interface,
+		/// so the tasks run one at a time. Independent packages are already built concurrently.
 		/// </summary>
 		void Execute(BuildState& state)
 		{
-			// Setup each task to have a complete list of tasks that must run before itself
-			// Note: this is required to combine other tasks run before lists with the tasks
-			// own run after list
-			for (auto& task : _tasks)
-			{
-				auto& taskContainer = task.second;
-
-				// Copy their own run after list
-				std::copy(
-					taskContainer.RunAfterList.begin(),
-					taskContainer.RunAfterList.end(),
-					std::back_inserter(taskContainer.RunAfterClosureList));
-
-				// Add ourself to all tasks in our run before list
-				for (auto& runBefore : taskContainer.RunBeforeList)
-				{
-					// Try to find the other task
-					auto findResult = _tasks.find(runBefore);
-					if (findResult != _tasks.end())
-					{
-						auto& beforeTaskContainer = findResult->second;
-						beforeTaskContainer.RunAfterClosureList.push_back(task.first);
-					}
-				}
-			}
-
-			// Run all tasks in the order they were registered
-			// ensuring they are run in the correct dependency order
-			auto currentTask = FindNextTask();
-			while (currentTask != _tasks.end())
+			auto executionOrder = ResolveExecutionOrder();
+			for (auto taskId : executionOrder)
 			{
-				Log::Info("TaskStart: " + currentTask->first);
-				auto status = currentTask->second.Task->Execute(state);
+				auto& taskContainer = _tasks[taskId];
+				Log::Info("TaskStart: " + taskContainer.Name);
+				auto status = taskContainer.Task->Execute(state);
 				if (status != 0)
 				{
 					Log::Error("TaskFailed: " + std::to_string(status));
@@ -150,62 +135,129 @@ namespace Soup::Build::Runtime
 				}
 				else
 				{
-					Log::Info("TaskDone: " + currentTask->first);
+					Log::Info("TaskDone: " + taskContainer.Name);
 				}
 
 				state.LogActive();
-				currentTask->second.HasRun = true;
-				currentTask = FindNextTask(); 
 			}
 		}
 
-	private:
 		/// <summary>
-		/// Try to find the next task that has yet to be run and is ready
-		/// Returns false if all tasks have been run
-		/// Throws error if we hit a deadlock
+		/// Resolve the task dependencies once into a deterministic topological order
+		/// Note: Ready tasks run in the order they were registered
+		/// Throws error if the task dependencies contain a cycle
 		/// </summary>
-		std::unordered_map<std::string, BuildTaskContainer>::iterator FindNextTask()
+		std::vector<size_t> ResolveExecutionOrder()
 		{
-			// Find the next task that is ready to be run
-			bool hasAnyStillWaiting = false;
-			auto taskItr = _tasks.begin();
-			for (;taskItr != _tasks.end(); taskItr++)
+			// Combine each tasks run after list with the run before lists of the other tasks
+			// Note: Names that do not match a registered task are ignored
+			for (auto& taskContainer : _tasks)
+			{
+				taskContainer.Dependencies.clear();
+				taskContainer.Dependents.clear();
+			}
+
+			for (size_t taskId = 0; taskId < _tasks.size(); taskId++)
+			{
+				for (auto& runAfter : _tasks[taskId].RunAfterList)
+				{
+					auto findResult = _taskIds.find(runAfter);
+					if (findResult != _taskIds.end())
+						AddDependency(taskId, findResult->second);
+				}
+
+				for (auto& runBefore : _tasks[taskId].RunBeforeList)
+				{
+					auto findResult = _taskIds.find(runBefore);
+					if (findResult != _taskIds.end())
+						AddDependency(findResult->second, taskId);
+				}
+			}
+
+			// Count the remaining dependencies for each task
+			auto remainingCounts = std::vector<size_t>(_tasks.size());
+			auto readyTasks = std::set<size_t>();
+			for (size_t taskId = 0; taskId < _tasks.size(); taskId++)
+			{
+				remainingCounts[taskId] = _tasks[taskId].Dependencies.size();
+				if (remainingCounts[taskId] == 0)
+					readyTasks.insert(taskId);
+			}
+
+			auto result = std::vector<size_t>();
+			result.reserve(_tasks.size());
+			while (!readyTasks.empty())
 			{
-				// Check if this task has run already, 
-				// if not check if all if all upstream tasks have finished
-				auto& taskContainer = taskItr->second;
-				if (!taskContainer.HasRun)
+				auto taskId = *readyTasks.begin();
+				readyTasks.erase(readyTasks.begin());
+				result.push_back(taskId);
+
+				for (auto dependent : _tasks[taskId].Dependents)
 				{
-					hasAnyStillWaiting = true;
-
-					// Check if all of their run after dependencies have already finished
-					bool hasDependencyPending = false;
-					for (auto& runBefore : taskContainer.RunAfterClosureList)
-					{
-						auto findResult = _tasks.find(runBefore);
-						if (findResult != _tasks.end() && !findResult->second.HasRun)
-						{
-							// Found a dependency that hasn't run, keep trying
-							hasDependencyPending = true;
-							break;
-						}
-					}
-
-					// All dependencies have finished
-					// Let's run this one
-					if (!hasDependencyPending)
-						return taskItr;
+					if (--remainingCounts[dependent] == 0)
+						readyTasks.insert(dependent);
 				}
 			}
 
-			if (!hasAnyStillWaiting)
-				return _tasks.end();
-			else
-				throw std::runtime_error("Hit deadlock in build task dependencies.");
+			if (result.size() != _tasks.size())
+			{
+				auto message = "Build task dependency cycle: " + FindCycle(remainingCounts);
+				Log::Error(message);
+				throw std::runtime_error(message);
+			}
+
+			return result;
+		}
+
+	private:
+		/// <summary>
+		/// Register that a task must run after the dependency task
+		/// </summary>
+		void AddDependency(size_t taskId, size_t dependencyId)
+		{
+			_tasks[taskId].Dependencies.push_back(dependencyId);
+			_tasks[dependencyId].Dependents.push_back(taskId);
+		}
+
+		/// <summary>
+		/// Find a single cycle in the tasks that could not be scheduled and
+		/// format it in run order, "A -> B -> A"
+		/// </summary>
+		std::string FindCycle(const std::vector<size_t>& remainingCounts)
+		{
+			// Every unscheduled task waits on at least one other unscheduled task, so walking
+			// the pending dependencies must eventually visit a task for a second time
+			auto path = std::vector<size_t>();
+			auto pathIndex = std::unordered_map<size_t, size_t>();
+			auto taskId = static_cast<size_t>(std::distance(
+				remainingCounts.begin(),
+				std::find_if(remainingCounts.begin(), remainingCounts.end(), [](size_t count) { return count != 0; })));
+			while (!pathIndex.contains(taskId))
+			{
+				pathIndex.emplace(taskId, path.size());
+				path.push_back(taskId);
+
+				auto& dependencies = _tasks[taskId].Dependencies;
+				taskId = *std::find_if(
+					dependencies.begin(),
+					dependencies.end(),
+					[&remainingCounts](size_t dependency) { return remainingCounts[dependency] != 0; });
+			}
+
+			// The path follows dependencies, reverse the cycle to show the run order
+			std::stringstream message;
+			auto cycleStart = pathIndex[taskId];
+			for (auto index = path.size(); index > cycleStart; index--)
+			{
+				message << _tasks[path[index - 1]].Name << " -> ";
+			}
+
+			message << _tasks[path.back()].Name;
+			return message.str();
 		}
 
 	private:
-		std::unordered_map<std::string, BuildTaskContainer> _tasks;
+		std::vector<BuildTaskContainer> _tasks;
+		std::unordered_map<std::string, size_t> _taskIds;
 	};
 }
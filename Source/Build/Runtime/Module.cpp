@@ -1,11 +1,17 @@
 ﻿module;
 
-#include <any>
+#include <algorithm>
+#include <deque>
 #include <map>
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <set>
 #include <string>
 #include <sstream>
+#include <string_view>
+#include <variant>
 #include <vector>
 
 export module Soup.Build.Runtime;
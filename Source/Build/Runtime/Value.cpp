@@ -4,11 +4,12 @@
 
 module;
 
-#include <any>
+#include <deque>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <variant>
 #include <vector>
 
 module Soup.Build.Runtime;
@@ -44,15 +45,73 @@ Value::Value(std::string value) :
 }
 
 Value::Value(ValueList list) :
-	_value(std::move(list))
+	_value(std::make_unique<ValueList>(std::move(list)))
 {
 }
 
 Value::Value(ValueTable table) :
-	_value(std::move(table))
+	_value(std::make_unique<ValueTable>(std::move(table)))
 {
 }
 
+Value::Value(std::shared_ptr<IValue> external) :
+	_value(std::move(external))
+{
+}
+
+Value::Value(const Value& other) :
+	_value()
+{
+	*this = other;
+}
+
+Value::Value(Value&& other) noexcept = default;
+
+Value::~Value() = default;
+
+Value& Value::operator =(const Value& other)
+{
+	if (this == &other)
+		return *this;
+
+	// External values are shared
+	if (auto external = std::get_if<std::shared_ptr<IValue>>(&other._value))
+	{
+		_value = *external;
+		return *this;
+	}
+
+	// Tables and lists are deep copied
+	switch (other.GetType())
+	{
+		case ValueType::Table:
+			_value = std::make_unique<ValueTable>(*std::get<std::unique_ptr<ValueTable>>(other._value));
+			break;
+		case ValueType::List:
+			_value = std::make_unique<ValueList>(*std::get<std::unique_ptr<ValueList>>(other._value));
+			break;
+		case ValueType::String:
+			_value = std::get<ValuePrimitive<const char*>>(other._value);
+			break;
+		case ValueType::Integer:
+			_value = std::get<ValuePrimitive<int64_t>>(other._value);
+			break;
+		case ValueType::Float:
+			_value = std::get<ValuePrimitive<double>>(other._value);
+			break;
+		case ValueType::Boolean:
+			_value = std::get<ValuePrimitive<bool>>(other._value);
+			break;
+		default:
+			_value = std::monostate();
+			break;
+	}
+
+	return *this;
+}
+
+Value& Value::operator =(Value&& other) noexcept = default;
+
 OperationResult Value::TryGetType(uint64_t& type) const noexcept
 {
 	try
@@ -72,6 +131,9 @@ OperationResult Value::TrySetType(uint64_t type) noexcept
 
 	try
 	{
+		if (auto external = GetExternal())
+			return external->TrySetType(type);
+
 		auto updatedType = static_cast<ValueType>(type);
 		auto currentType = GetType();
 
@@ -81,10 +143,10 @@ OperationResult Value::TrySetType(uint64_t type) noexcept
 			switch (updatedType)
 			{
 				case ValueType::Table:
-					_value = ValueTable();
+					_value = std::make_unique<ValueTable>();
 					break;
 				case ValueType::List:
-					_value = ValueList();
+					_value = std::make_unique<ValueList>();
 					break;
 				case ValueType::String:
 					_value = ValuePrimitive<const char*>();
@@ -118,9 +180,12 @@ OperationResult Value::TryGetAsTable(IValueTable*& result) noexcept
 	try
 	{
 		result = nullptr;
-		if (_value.type() == typeid(ValueTable))
+		if (auto external = GetExternal())
+			return external->TryGetAsTable(result);
+
+		if (auto table = std::get_if<std::unique_ptr<ValueTable>>(&_value))
 		{
-			result = &std::any_cast<ValueTable&>(_value);
+			result = table->get();
 			return 0;
 		}
 		else
@@ -140,10 +205,13 @@ OperationResult Value::TryGetAsList(IValueList*& result) noexcept
 {
 	try
 	{
-		result = false;
-		if (_value.type() == typeid(ValueList))
+		result = nullptr;
+		if (auto external = GetExternal())
+			return external->TryGetAsList(result);
+
+		if (auto list = std::get_if<std::unique_ptr<ValueList>>(&_value))
 		{
-			result = &std::any_cast<ValueList&>(_value);
+			result = list->get();
 			return 0;
 		}
 		else
@@ -163,10 +231,13 @@ OperationResult Value::TryGetAsString(IValuePrimitive<const char*>*& result) noe
 {
 	try
 	{
-		result = false;
-		if (_value.type() == typeid(ValuePrimitive<const char*>))
+		result = nullptr;
+		if (auto external = GetExternal())
+			return external->TryGetAsString(result);
+
+		if (auto value = std::get_if<ValuePrimitive<const char*>>(&_value))
 		{
-			result = &std::any_cast<ValuePrimitive<const char*>&>(_value);
+			result = value;
 			return 0;
 		}
 		else
@@ -186,10 +257,13 @@ OperationResult Value::TryGetAsInteger(IValuePrimitive<int64_t>*& result) noexce
 {
 	try
 	{
-		result = false;
-		if (_value.type() == typeid(ValuePrimitive<int64_t>))
+		result = nullptr;
+		if (auto external = GetExternal())
+			return external->TryGetAsInteger(result);
+
+		if (auto value = std::get_if<ValuePrimitive<int64_t>>(&_value))
 		{
-			result = &std::any_cast<ValuePrimitive<int64_t>&>(_value);
+			result = value;
 			return 0;
 		}
 		else
@@ -209,10 +283,13 @@ OperationResult Value::TryGetAsFloat(IValuePrimitive<double>*& result) noexcept
 {
 	try
 	{
-		result = false;
-		if (_value.type() == typeid(ValuePrimitive<double>))
+		result = nullptr;
+		if (auto external = GetExternal())
+			return external->TryGetAsFloat(result);
+
+		if (auto value = std::get_if<ValuePrimitive<double>>(&_value))
 		{
-			result = &std::any_cast<ValuePrimitive<double>&>(_value);
+			result = value;
 			return 0;
 		}
 		else
@@ -232,10 +309,13 @@ OperationResult Value::TryGetAsBoolean(IValuePrimitive<bool>*& result) noexcept
 {
 	try
 	{
-		result = false;
-		if (_value.type() == typeid(ValuePrimitive<bool>))
+		result = nullptr;
+		if (auto external = GetExternal())
+			return external->TryGetAsBoolean(result);
+
+		if (auto value = std::get_if<ValuePrimitive<bool>>(&_value))
 		{
-			result = &std::any_cast<ValuePrimitive<bool>&>(_value);
+			result = value;
 			return 0;
 		}
 		else
@@ -253,48 +333,40 @@ OperationResult Value::TryGetAsBoolean(IValuePrimitive<bool>*& result) noexcept
 
 ValueType Value::GetType() const
 {
-	if (_value.has_value())
-	{
-		auto& valueType = _value.type();
-		if (valueType == typeid(ValueTable))
-			return ValueType::Table;
-		else if (valueType == typeid(ValueList))
-			return ValueType::List;
-		else if (valueType == typeid(ValuePrimitive<const char*>))
-			return ValueType::String;
-		else if (valueType == typeid(ValuePrimitive<int64_t>))
-			return ValueType::Integer;
-		else if (valueType == typeid(ValuePrimitive<double>))
-			return ValueType::Float;
-		else if (valueType == typeid(ValuePrimitive<bool>))
-			return ValueType::Boolean;
-		else
-			throw std::runtime_error("Unknown internal type.");
-	}
-	else
+	if (auto external = GetExternal())
 	{
-		return ValueType::Empty;
+		uint64_t type = 0;
+		if (external->TryGetType(type) != 0)
+			throw std::runtime_error("TryGetType Failed");
+
+		return static_cast<ValueType>(type);
 	}
+
+	// Note: The storage alternatives match the order of the type enumeration
+	return static_cast<ValueType>(_value.index());
 }
 
 std::string Value::ToString()
 {
+	if (GetExternal() != nullptr)
+		return "External";
+
 	switch (GetType())
 	{
 		case ValueType::Empty:
 			return "";
 		case ValueType::Table:
-			return std::any_cast<ValueTable&>(_value).ToString();
+			return std::get<std::unique_ptr<ValueTable>>(_value)->ToString();
 		case ValueType::List:
-			return std::any_cast<ValueList&>(_value).ToString();
+			return std::get<std::unique_ptr<ValueList>>(_value)->ToString();
 		case ValueType::String:
-			return std::any_cast<ValuePrimitive<const char*>&>(_value).ToString();
+			return std::get<ValuePrimitive<const char*>>(_value).ToString();
 		case ValueType::Integer:
-			return std::any_cast<ValuePrimitive<int64_t>&>(_value).ToString();
+			return std::get<ValuePrimitive<int64_t>>(_value).ToString();
 		case ValueType::Float:
-			return std::any_cast<ValuePrimitive<double>&>(_value).ToString();
+			return std::get<ValuePrimitive<double>>(_value).ToString();
 		case ValueType::Boolean:
-			return std::any_cast<ValuePrimitive<bool>&>(_value).ToString();
+			return std::get<ValuePrimitive<bool>>(_value).ToString();
 		default:
 			return "UnknownType";
 	}
@@ -302,9 +374,9 @@ std::string Value::ToString()
 
 ValueTable& Value::AsTable()
 {
-	if (_value.type() == typeid(ValueTable))
+	if (auto table = std::get_if<std::unique_ptr<ValueTable>>(&_value))
 	{
-		return std::any_cast<ValueTable&>(_value);
+		return **table;
 	}
 	else
 	{
@@ -315,9 +387,9 @@ ValueTable& Value::AsTable()
 
 ValueList& Value::AsList()
 {
-	if (_value.type() == typeid(ValueList))
+	if (auto list = std::get_if<std::unique_ptr<ValueList>>(&_value))
 	{
-		return std::any_cast<ValueList&>(_value);
+		return **list;
 	}
 	else
 	{
@@ -326,8 +398,34 @@ ValueList& Value::AsList()
 	}
 }
 
+ValueTable& Value::EnsureTable()
+{
+	// Auto convert empty values
+	if (GetType() == ValueType::Empty)
+	{
+		_value = std::make_unique<ValueTable>();
+	}
+
+	return AsTable();
+}
+
+ValueList& Value::EnsureList()
+{
+	// Auto convert empty values
+	if (GetType() == ValueType::Empty)
+	{
+		_value = std::make_unique<ValueList>();
+	}
+
+	return AsList();
+}
+
 bool Value::operator ==(const Value& rhs) const
 {
+	// External values are only equal to the same instance
+	if (GetExternal() != nullptr || rhs.GetExternal() != nullptr)
+		return GetExternal() == rhs.GetExternal();
+
 	if (GetType() == rhs.GetType())
 	{
 		switch (GetType())
@@ -335,17 +433,17 @@ bool Value::operator ==(const Value& rhs) const
 			case ValueType::Empty:
 				return true;
 			case ValueType::Table:
-				return std::any_cast<const ValueTable&>(_value) == std::any_cast<const ValueTable&>(rhs._value);
+				return *std::get<std::unique_ptr<ValueTable>>(_value) == *std::get<std::unique_ptr<ValueTable>>(rhs._value);
 			case ValueType::List:
-				return std::any_cast<const ValueList&>(_value) == std::any_cast<const ValueList&>(rhs._value);
+				return *std::get<std::unique_ptr<ValueList>>(_value) == *std::get<std::unique_ptr<ValueList>>(rhs._value);
 			case ValueType::String:
-				return std::any_cast<const ValuePrimitive<const char*>&>(_value) == std::any_cast<const ValuePrimitive<const char*>&>(rhs._value);
+				return std::get<ValuePrimitive<const char*>>(_value) == std::get<ValuePrimitive<const char*>>(rhs._value);
 			case ValueType::Integer:
-				return std::any_cast<const ValuePrimitive<int64_t>&>(_value) == std::any_cast<const ValuePrimitive<int64_t>&>(rhs._value);
+				return std::get<ValuePrimitive<int64_t>>(_value) == std::get<ValuePrimitive<int64_t>>(rhs._value);
 			case ValueType::Float:
-				return std::any_cast<const ValuePrimitive<double>&>(_value) == std::any_cast<const ValuePrimitive<double>&>(rhs._value);
+				return std::get<ValuePrimitive<double>>(_value) == std::get<ValuePrimitive<double>>(rhs._value);
 			case ValueType::Boolean:
-				return std::any_cast<const ValuePrimitive<bool>&>(_value) == std::any_cast<const ValuePrimitive<bool>&>(rhs._value);
+				return std::get<ValuePrimitive<bool>>(_value) == std::get<ValuePrimitive<bool>>(rhs._value);
 			default:
 				throw std::runtime_error("Unkown ValueType for comparison.");
 		}
@@ -361,4 +459,12 @@ bool Value::operator !=(const Value& rhs) const
 	return !(*this == rhs);
 }
 
+IValue* Value::GetExternal() const
+{
+	if (auto external = std::get_if<std::shared_ptr<IValue>>(&_value))
+		return external->get();
+	else
+		return nullptr;
+}
+
 }
@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "ValuePrimitive.h"
 
 namespace Soup::Build::Runtime
 {
@@ -11,6 +12,9 @@ namespace Soup::Build::Runtime
 
 	/// <summary>
 	/// Build State Extension interface
+	/// Note: Primitives are stored inline, tables and lists are owned on the heap so the
+	/// address of a nested table does not change when the value that holds it is moved.
+	/// An external value forwards all access to another implementation of the interface.
 	/// </summary>
 	export class Value : public IValue
 	{
@@ -25,6 +29,16 @@ namespace Soup::Build::Runtime
 		Value(std::string value);
 		Value(ValueList list);
 		Value(ValueTable table);
+		Value(std::shared_ptr<IValue> external);
+		Value(const Value& other);
+		Value(Value&& other) noexcept;
+		~Value();
+
+		/// <summary>
+		/// Assignment operators
+		/// </summary>
+		Value& operator =(const Value& other);
+		Value& operator =(Value&& other) noexcept;
 
 		/// <summary>
 		/// Type checker methods
@@ -51,6 +65,12 @@ namespace Soup::Build::Runtime
 		ValueTable& AsTable();
 		ValueList& AsList();
 
+		/// <summary>
+		/// Internal accessors that convert an empty value to the requested type
+		/// </summary>
+		ValueTable& EnsureTable();
+		ValueList& EnsureList();
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -62,6 +82,22 @@ namespace Soup::Build::Runtime
 		bool operator !=(const Value& rhs) const;
 
 	private:
-		std::any _value;
+		/// <summary>
+		/// The storage alternatives in the same order as the ValueType enumeration followed
+		/// by the external value
+		/// </summary>
+		using ValueStorage = std::variant<
+			std::monostate,
+			std::unique_ptr<ValueTable>,
+			std::unique_ptr<ValueList>,
+			ValuePrimitive<const char*>,
+			ValuePrimitive<int64_t>,
+			ValuePrimitive<double>,
+			ValuePrimitive<bool>,
+			std::shared_ptr<IValue>>;
+
+		IValue* GetExternal() const;
+
+		ValueStorage _value;
 	};
 }
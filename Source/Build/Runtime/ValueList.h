@@ -8,15 +8,26 @@ namespace Soup::Build::Runtime
 {
 	/// <summary>
 	/// Build list implementation for simple objects
+	/// Note: The values are stored in segments that are shared copy-on-write between lists, so
+	/// copying or appending a list only shares the segments. Read only access walks the segments
+	/// in place and any mutable access first takes a private copy of the shared values.
 	/// </summary>
-	export class ValueList : public IValueList
+	export class ValueList : public IValueList2
 	{
+	private:
+		using Segment = std::vector<Value>;
+
+		/// <summary>
+		/// Collapse the segments once a list has been built up from many appends
+		/// </summary>
+		static constexpr size_t MaxSegmentCount = 32;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the ValueList class
 		/// </summary>
 		ValueList() :
-			_values()
+			_segments()
 		{
 		}
 
@@ -25,14 +36,18 @@ namespace Soup::Build::Runtime
 		/// </summary>
 		uint64_t GetSize() const noexcept override final
 		{
-			return _values.size();
+			uint64_t result = 0;
+			for (auto& segment : _segments)
+				result += segment->size();
+
+			return result;
 		}
 
 		OperationResult Resize(uint64_t size) noexcept override final
 		{
 			try
 			{
-				_values.resize(size);
+				GetValues().resize(size);
 				return 0;
 			}
 			catch (...)
@@ -49,7 +64,74 @@ namespace Soup::Build::Runtime
 		{
 			try
 			{
-				result = &_values.at(index);
+				result = &GetValues().at(index);
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		/// <summary>
+		/// Bulk string accessor methods
+		/// Note: Reads the shared segments in place without taking a copy
+		/// </summary>
+		OperationResult TryGetStringValues(uint64_t index, uint64_t count, const char** result) noexcept override final
+		{
+			try
+			{
+				auto size = GetSize();
+				if (index > size || count > size - index)
+					return -2;
+
+				uint64_t resultIndex = 0;
+				for (auto& segment : _segments)
+				{
+					if (resultIndex == count)
+						break;
+
+					// Skip the segments before the requested range
+					if (index >= segment->size())
+					{
+						index -= segment->size();
+						continue;
+					}
+
+					for (; index < segment->size() && resultIndex < count; index++, resultIndex++)
+					{
+						IValuePrimitive<const char*>* value = nullptr;
+						if ((*segment)[index].TryGetAsString(value) != 0)
+							return -2;
+
+						value->TryGetValue(result[resultIndex]);
+					}
+
+					index = 0;
+				}
+
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		OperationResult TryAppendStringValues(
+			uint64_t count,
+			const char* const* values,
+			const uint64_t* lengths) noexcept override final
+		{
+			try
+			{
+				auto& segment = GetWritableTail();
+				segment.reserve(segment.size() + count);
+				for (uint64_t i = 0; i < count; i++)
+					segment.push_back(Value(std::string(values[i], lengths[i])));
+
 				return 0;
 			}
 			catch (...)
@@ -61,10 +143,43 @@ namespace Soup::Build::Runtime
 
 		/// <summary>
 		/// Internal access to the state
+		/// Note: Takes a private copy of any shared values
 		/// </summary>
 		std::vector<Value>& GetValues()
 		{
-			return _values;
+			if (_segments.size() == 1 && _segments.front().use_count() == 1)
+				return *_segments.front();
+
+			// Collapse all segments into a single private segment
+			auto values = std::make_shared<Segment>();
+			values->reserve(GetSize());
+			for (auto& segment : _segments)
+				values->insert(values->end(), segment->begin(), segment->end());
+
+			_segments.clear();
+			_segments.push_back(std::move(values));
+			return *_segments.front();
+		}
+
+		/// <summary>
+		/// Append the values from another list, sharing its storage
+		/// </summary>
+		void Append(const ValueList& other)
+		{
+			// Note: Take a reference to the other segments first in case the list is appended to itself
+			auto otherSegments = other._segments;
+			if (_segments.size() + otherSegments.size() > MaxSegmentCount)
+			{
+				// Copy the values to keep the number of segments bounded
+				auto& values = GetValues();
+				values.reserve(values.size() + other.GetSize());
+				for (auto& segment : otherSegments)
+					values.insert(values.end(), segment->begin(), segment->end());
+			}
+			else
+			{
+				_segments.insert(_segments.end(), otherSegments.begin(), otherSegments.end());
+			}
 		}
 
 		std::string ToString()
@@ -73,15 +188,18 @@ namespace Soup::Build::Runtime
 
 			stream << "[";
 			bool isFirst = true;
-			for (auto& value : _values)
+			for (auto& segment : _segments)
 			{
-				if (!isFirst)
+				for (auto& value : *segment)
 				{
-					stream << ", ";
+					if (!isFirst)
+					{
+						stream << ", ";
+					}
+
+					stream << "\"" << value.ToString() << "\"";
+					isFirst = false;
 				}
-				
-				stream << "\"" << value.ToString() << "\"";
-				isFirst = false;
 			}
 
 			stream << "]";
@@ -94,7 +212,29 @@ namespace Soup::Build::Runtime
 		/// </summary>
 		bool operator ==(const ValueList& rhs) const
 		{
-			return _values == rhs._values;
+			if (GetSize() != rhs.GetSize())
+				return false;
+
+			auto rhsSegment = rhs._segments.begin();
+			size_t rhsIndex = 0;
+			for (auto& segment : _segments)
+			{
+				for (auto& value : *segment)
+				{
+					while (rhsIndex == (*rhsSegment)->size())
+					{
+						++rhsSegment;
+						rhsIndex = 0;
+					}
+
+					if (value != (**rhsSegment)[rhsIndex])
+						return false;
+
+					rhsIndex++;
+				}
+			}
+
+			return true;
 		}
 
 		/// <summary>
@@ -106,6 +246,18 @@ namespace Soup::Build::Runtime
 		}
 
 	private:
-		std::vector<Value> _values;
+		/// <summary>
+		/// Get the last segment when it is not shared, otherwise start a new one
+		/// </summary>
+		Segment& GetWritableTail()
+		{
+			if (_segments.empty() || _segments.back().use_count() != 1)
+				_segments.push_back(std::make_shared<Segment>());
+
+			return *_segments.back();
+		}
+
+	private:
+		std::vector<std::shared_ptr<Segment>> _segments;
 	};
 }
@@ -8,17 +8,82 @@
 
 namespace Soup::Build::Runtime
 {
+	/// <summary>
+	/// A table key with the hash of the name computed up front
+	/// </summary>
+	export class ValueKey
+	{
+	public:
+		/// <summary>
+		/// Compute the FNV-1a hash for a key name
+		/// </summary>
+		static constexpr uint64_t Hash(std::string_view name) noexcept
+		{
+			uint64_t result = 14695981039346656037ull;
+			for (auto character : name)
+			{
+				result ^= static_cast<uint8_t>(character);
+				result *= 1099511628211ull;
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the ValueKey class
+		/// </summary>
+		constexpr ValueKey(std::string_view name) noexcept :
+			_name(name),
+			_hash(Hash(name))
+		{
+		}
+
+		constexpr std::string_view GetName() const noexcept
+		{
+			return _name;
+		}
+
+		constexpr uint64_t GetHash() const noexcept
+		{
+			return _hash;
+		}
+
+	private:
+		std::string_view _name;
+		uint64_t _hash;
+	};
+
+	/// <summary>
+	/// The well known keys that are accessed by every build task
+	/// </summary>
+	export class ValueKeys
+	{
+	public:
+		static constexpr ValueKey Build = ValueKey("Build");
+		static constexpr ValueKey Recipe = ValueKey("Recipe");
+		static constexpr ValueKey Source = ValueKey("Source");
+	};
+
 	/// <summary>
 	/// Build State Extension interface
+	/// Note: The entries are stored in insertion order in a deque so the address of a value
+	/// never changes after it is handed out over the ABI. The flat open addressed index holds
+	/// the precomputed key hashes so a lookup only compares names when the hashes match.
 	/// </summary>
 	export class ValueTable : public IValueTable
 	{
+	private:
+		static constexpr uint32_t EmptyBucket = 0;
+		static constexpr size_t InitialBucketCount = 8;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the BuildPropertyBag class
 		/// </summary>
 		ValueTable() :
-			_values()
+			_values(),
+			_hashes(),
+			_buckets()
 		{
 		}
 
@@ -30,7 +95,7 @@ namespace Soup::Build::Runtime
 			try
 			{
 				result = false;
-				result = _values.contains(name);
+				result = Find(ValueKey(name)) != nullptr;
 				return 0;
 			}
 			catch (...)
@@ -45,10 +110,10 @@ namespace Soup::Build::Runtime
 			try
 			{
 				result = nullptr;
-				auto findResult = _values.find(name);
-				if (findResult != _values.end())
+				auto value = Find(ValueKey(name));
+				if (value != nullptr)
 				{
-					result = &findResult->second;
+					result = value;
 					return 0;
 				}
 				else
@@ -82,20 +147,45 @@ namespace Soup::Build::Runtime
 		/// <summary>
 		/// Internal access to the state
 		/// </summary>
-		Value& SetValue(std::string_view name, Value value)
+		Value& SetValue(const ValueKey& key, Value value)
 		{
-			auto insertResult = _values.emplace(name, std::move(value));
-			if (insertResult.second)
-			{
-				return insertResult.first->second;
-			}
-			else
-			{
+			if (Find(key) != nullptr)
 				throw std::runtime_error("Failed to insert a value.");
-			}
+
+			// Keep the index at most half full
+			if ((_values.size() + 1) * 2 > _buckets.size())
+				Rehash(std::max(InitialBucketCount, _buckets.size() * 2));
+
+			auto& entry = _values.emplace_back(std::string(key.GetName()), std::move(value));
+			_hashes.push_back(key.GetHash());
+			InsertBucket(key.GetHash(), static_cast<uint32_t>(_values.size()));
+
+			return entry.second;
+		}
+
+		Value& SetValue(std::string_view name, Value value)
+		{
+			return SetValue(ValueKey(name), std::move(value));
+		}
+
+		Value* TryGetValue(const ValueKey& key)
+		{
+			return Find(key);
+		}
+
+		Value& EnsureValue(const ValueKey& key)
+		{
+			auto value = Find(key);
+			if (value != nullptr)
+				return *value;
+
+			return SetValue(key, Value());
 		}
 
-		std::map<std::string, Value>& GetValues()
+		/// <summary>
+		/// Note: The entries must not be renamed, the index refers to the original names
+		/// </summary>
+		std::deque<std::pair<std::string, Value>>& GetValues()
 		{
 			return _values;
 		}
@@ -140,10 +230,22 @@ namespace Soup::Build::Runtime
 
 		/// <summary>
 		/// Equality operator
+		/// Note: The insertion order does not affect equality
 		/// </summary>
 		bool operator ==(const ValueTable& rhs) const
 		{
-			return _values == rhs._values;
+			if (_values.size() != rhs._values.size())
+				return false;
+
+			for (size_t i = 0; i < _values.size(); i++)
+			{
+				auto& entry = _values[i];
+				auto rhsValue = rhs.Find(ValueKey(entry.first), _hashes[i]);
+				if (rhsValue == nullptr || *rhsValue != entry.second)
+					return false;
+			}
+
+			return true;
 		}
 
 		/// <summary>
@@ -155,6 +257,50 @@ namespace Soup::Build::Runtime
 		}
 
 	private:
-		std::map<std::string, Value> _values;
+		Value* Find(const ValueKey& key) const
+		{
+			return Find(key, key.GetHash());
+		}
+
+		/// <summary>
+		/// Probe the index for the key, only comparing names when the hashes match
+		/// </summary>
+		Value* Find(const ValueKey& key, uint64_t hash) const
+		{
+			if (_buckets.empty())
+				return nullptr;
+
+			auto mask = _buckets.size() - 1;
+			for (auto bucket = hash & mask; _buckets[bucket] != EmptyBucket; bucket = (bucket + 1) & mask)
+			{
+				auto index = _buckets[bucket] - 1;
+				if (_hashes[index] == hash && _values[index].first == key.GetName())
+					return const_cast<Value*>(&_values[index].second);
+			}
+
+			return nullptr;
+		}
+
+		void InsertBucket(uint64_t hash, uint32_t entry)
+		{
+			auto mask = _buckets.size() - 1;
+			auto bucket = hash & mask;
+			while (_buckets[bucket] != EmptyBucket)
+				bucket = (bucket + 1) & mask;
+
+			_buckets[bucket] = entry;
+		}
+
+		void Rehash(size_t bucketCount)
+		{
+			_buckets.assign(bucketCount, EmptyBucket);
+			for (size_t i = 0; i < _hashes.size(); i++)
+				InsertBucket(_hashes[i], static_cast<uint32_t>(i + 1));
+		}
+
+	private:
+		std::deque<std::pair<std::string, Value>> _values;
+		std::vector<uint64_t> _hashes;
+		std::vector<uint32_t> _buckets;
 	};
 }
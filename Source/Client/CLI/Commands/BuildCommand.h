@@ -62,7 +62,45 @@ namespace Soup::Client
 			// Setup the build arguments
 			auto arguments = RecipeBuildArguments();
 			arguments.ForceRebuild = _options.Force;
+			arguments.Explain = _options.Explain;
 			arguments.SkipRun = _options.SkipRun;
+			arguments.UseRecipeSnapshots = _options.RecipeSnapshot;
+
+			// Default to one job per hardware thread with a smaller pool for
+			// the memory hungry link operations
+			uint64_t jobs = _options.Jobs;
+			if (jobs == 0)
+				jobs = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+
+			// Honor the job server of a parent make (or CI scheduler) over our own job
+			// count, otherwise host one so that tools that parallelize internally share
+			// the same token budget as the build operations
+			auto jobServer = Build::JobServer::TryConnectFromEnvironment();
+			if (jobServer != nullptr)
+			{
+				Log::Info("Using job server from parent process");
+				jobs = jobServer->GetAuth().JobCount > 0 ?
+					jobServer->GetAuth().JobCount :
+					std::max<uint64_t>(1, std::thread::hardware_concurrency());
+			}
+			else
+			{
+				jobServer = Build::JobServer::TryCreate(static_cast<uint32_t>(jobs));
+			}
+
+			arguments.ResourceLimits.JobServer = jobServer;
+
+			uint64_t linkJobs = _options.LinkJobs;
+			if (linkJobs == 0)
+				linkJobs = std::max<uint64_t>(1, jobs / 4);
+
+			arguments.ResourceLimits.MaxParallelism = jobs;
+			arguments.ResourceLimits.ClassLimits.emplace(Build::ResourceClass::Link, linkJobs);
+			arguments.ResourceLimits.MemoryBudget = _options.MemoryBudget;
+			arguments.ResourceLimits.MemoryPressureThreshold = _options.MemoryPressure;
+
+			// Build independent packages concurrently within the same job budget
+			arguments.MaxPackageParallelism = jobs;
 
 			if (!_options.Flavor.empty())
 				arguments.Flavor = _options.Flavor;
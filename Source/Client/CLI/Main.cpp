@@ -4,11 +4,13 @@
 
 #include <chrono>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <map>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 import Opal;
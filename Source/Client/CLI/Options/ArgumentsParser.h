@@ -55,6 +55,7 @@ namespace Soup::Client
 
 				options->SkipRun = IsFlagSet("skipRun", unusedArgs);
 				options->Force = IsFlagSet("force", unusedArgs);
+				options->Explain = IsFlagSet("explain", unusedArgs);
 
 				auto flavorValue = std::string();
 				if (TryGetValueArgument("flavor", unusedArgs, flavorValue))
@@ -68,6 +69,42 @@ namespace Soup::Client
 					options->Platform = std::move(platformValue);
 				}
 
+				auto jobsValue = std::string();
+				if (TryGetValueArgument("jobs", unusedArgs, jobsValue))
+				{
+					options->Jobs = ParseNumericArgument<uint32_t>(
+						"jobs",
+						jobsValue,
+						[](const std::string& value, size_t* end) { return std::stoul(value, end); });
+				}
+
+				auto linkJobsValue = std::string();
+				if (TryGetValueArgument("linkJobs", unusedArgs, linkJobsValue))
+				{
+					options->LinkJobs = ParseNumericArgument<uint32_t>(
+						"linkJobs",
+						linkJobsValue,
+						[](const std::string& value, size_t* end) { return std::stoul(value, end); });
+				}
+
+				auto memoryBudgetValue = std::string();
+				if (TryGetValueArgument("memoryBudget", unusedArgs, memoryBudgetValue))
+				{
+					options->MemoryBudget = ParseNumericArgument<uint64_t>(
+						"memoryBudget",
+						memoryBudgetValue,
+						[](const std::string& value, size_t* end) { return std::stoull(value, end); });
+				}
+
+				auto memoryPressureValue = std::string();
+				if (TryGetValueArgument("memoryPressure", unusedArgs, memoryPressureValue))
+				{
+					options->MemoryPressure = ParseNumericArgument<double>(
+						"memoryPressure",
+						memoryPressureValue,
+						[](const std::string& value, size_t* end) { return std::stod(value, end); });
+				}
+
 				result = std::move(options);
 			}
 			else if (commandType == "initialize")
@@ -252,6 +289,35 @@ namespace Soup::Client
 			}
 		}
 
+		/// <summary>
+		/// Convert a numeric argument value, reporting malformed or out of range input
+		/// as a regular argument error instead of leaking the conversion exception
+		/// </summary>
+		template<typename T, typename TParse>
+		static T ParseNumericArgument(
+			const char* name,
+			const std::string& value,
+			TParse parse)
+		{
+			try
+			{
+				size_t end = 0;
+				auto result = parse(value, &end);
+				if (end != value.size() ||
+					static_cast<double>(result) < 0 ||
+					static_cast<double>(result) > static_cast<double>(std::numeric_limits<T>::max()))
+				{
+					throw std::out_of_range(value);
+				}
+
+				return static_cast<T>(result);
+			}
+			catch (const std::logic_error&)
+			{
+				throw std::runtime_error(std::string("Invalid value for argument -") + name + ": " + value);
+			}
+		}
+
 		static TraceEventFlag CheckVerbosity(std::vector<std::string>& unusedArgs)
 		{
 			auto level = 
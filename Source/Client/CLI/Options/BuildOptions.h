@@ -32,6 +32,12 @@ namespace Soup::Client
 		[[Args::Option("force", Default = false, HelpText = "Force a rebuild.")]]
 		bool Force;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to report why each build operation runs
+		/// </summary>
+		[[Args::Option("explain", Default = false, HelpText = "Explain why each operation is rebuilt.")]]
+		bool Explain;
+
 		/// <summary>
 		/// Gets or sets a value indicating what flavor to use
 		/// </summary>
@@ -43,5 +49,35 @@ namespace Soup::Client
 		/// </summary>
 		[[Args::Option('p', "platform", Default = false, HelpText = "Platform.")]]
 		std::string Platform;
+
+		/// <summary>
+		/// Gets or sets the maximum number of build operations to run in parallel
+		/// </summary>
+		[[Args::Option('j', "jobs", Default = 0, HelpText = "Maximum parallel jobs, defaults to one per hardware thread.")]]
+		uint32_t Jobs;
+
+		/// <summary>
+		/// Gets or sets the maximum number of link operations to run in parallel
+		/// </summary>
+		[[Args::Option("linkJobs", Default = 0, HelpText = "Maximum parallel link jobs.")]]
+		uint32_t LinkJobs;
+
+		/// <summary>
+		/// Gets or sets the memory budget in megabytes shared by all running jobs
+		/// </summary>
+		[[Args::Option("memoryBudget", Default = 0, HelpText = "Memory budget (MB).")]]
+		uint64_t MemoryBudget;
+
+		/// <summary>
+		/// Gets or sets the memory pressure percentage at which no new jobs are started
+		/// </summary>
+		[[Args::Option("memoryPressure", Default = 0, HelpText = "Memory pressure threshold (%).")]]
+		double MemoryPressure;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to reuse the compiled recipe snapshots
+		/// </summary>
+		[[Args::Option("recipeSnapshot", Default = false, HelpText = "Reuse compiled recipe snapshots.")]]
+		bool RecipeSnapshot;
 	};
 }
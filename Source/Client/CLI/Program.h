@@ -42,11 +42,12 @@ namespace Soup::Client
 						static_cast<TraceEventFlag>(defaultTypes));
 
 				// Setup the console listener
+				// Note: Packages may build concurrently, use the listener that tags each
+				// line with the package being built by the calling thread
 				Log::RegisterListener(
-					std::make_shared<ConsoleTraceListener>(
+					std::make_shared<PackageTraceListener>(
 						"Log",
 						_filter,
-						false,
 						false));
 
 				// Setup the real services
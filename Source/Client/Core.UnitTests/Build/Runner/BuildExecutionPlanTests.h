@@ -0,0 +1,167 @@
+// <copyright file="BuildExecutionPlanTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::UnitTests
+{
+	class BuildExecutionPlanTests
+	{
+	public:
+		[[Fact]]
+		void Compile_SharedChild()
+		{
+			auto link = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Link", "link.exe", "", "C:/Root/", {}, {}));
+			auto compile1 = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Compile1", "cl.exe", "", "C:/Root/", {}, {}, { link }));
+			auto compile2 = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Compile2", "cl.exe", "", "C:/Root/", {}, {}, { link }));
+
+			auto uut = BuildExecutionPlan();
+			uut.AddPackage({ compile1, compile2 });
+			uut.Compile();
+
+			Assert::AreEqual<size_t>(3, uut.GetNodeCount(), "Verify the shared child is added once.");
+			Assert::AreEqual(std::string("Compile1"), std::string(uut.GetNode(0).GetTitle()), "Verify first node.");
+			Assert::AreEqual(std::string("Link"), std::string(uut.GetNode(1).GetTitle()), "Verify second node.");
+			Assert::AreEqual(std::string("Compile2"), std::string(uut.GetNode(2).GetTitle()), "Verify third node.");
+			Assert::AreEqual(
+				std::vector<uint32_t>({ 1, 2, 1 }),
+				uut.GetDependencyCounts(),
+				"Verify the dependency counts.");
+			Assert::AreEqual(
+				std::vector<uint32_t>({ 0, 2 }),
+				std::vector<uint32_t>(uut.GetPackageRoots(0).begin(), uut.GetPackageRoots(0).end()),
+				"Verify the package roots.");
+		}
+
+		[[Fact]]
+		void Compile_LinkedEdge_AfterChildren()
+		{
+			auto link = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Link", "link.exe", "", "C:/Root/", {}, {}));
+			auto compile = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Compile", "cl.exe", "", "C:/Root/", {}, {}, { link }));
+			auto consumer = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Consumer", "cl.exe", "", "C:/Other/", {}, {}));
+
+			auto uut = BuildExecutionPlan();
+			uut.AddPackage({ compile });
+			uut.AddPackage({ consumer });
+			uut.AddLinkedEdge(0, 2);
+			uut.Compile();
+
+			Assert::AreEqual<uint32_t>(1, uut.GetPackage(2), "Verify the consumer package.");
+			Assert::AreEqual(
+				std::vector<uint32_t>({ 1, 2 }),
+				std::vector<uint32_t>(uut.GetChildren(0).begin(), uut.GetChildren(0).end()),
+				"Verify the linked child follows the package children.");
+			Assert::AreEqual(
+				std::vector<uint32_t>({ 1, 1, 2 }),
+				uut.GetDependencyCounts(),
+				"Verify the dependency counts.");
+		}
+
+		[[Fact]]
+		void Compile_Cycle_Throws()
+		{
+			auto first = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("First", "cl.exe", "", "C:/Root/", {}, {}));
+			auto second = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Second", "cl.exe", "", "C:/Root/", {}, {}));
+			auto third = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Third", "cl.exe", "", "C:/Root/", {}, {}));
+
+			IGraphNode* secondNode = second.GetRaw();
+			IGraphNode* thirdNode = third.GetRaw();
+			static_cast<IList2<IGraphNode*>&>(first->GetChildList()).TryAppendValues(1, &secondNode);
+			static_cast<IList2<IGraphNode*>&>(second->GetChildList()).TryAppendValues(1, &thirdNode);
+			static_cast<IList2<IGraphNode*>&>(third->GetChildList()).TryAppendValues(1, &secondNode);
+
+			auto uut = BuildExecutionPlan();
+			uut.AddPackage({ first });
+
+			auto message = std::string();
+			try
+			{
+				uut.Compile();
+			}
+			catch (const std::runtime_error& error)
+			{
+				message = error.what();
+			}
+
+			Assert::AreEqual(
+				std::string("Build node graph must be acyclic: Second -> Third -> Second"),
+				message,
+				"Verify the cycle path is reported.");
+
+			// Break the cycle so the nodes are released
+			second->GetChildList().Resize(0);
+		}
+
+		[[Fact]]
+		void Deduplicate_MergesIdenticalNodes()
+		{
+			auto linkA = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Link: A", "link.exe", "", "C:/PackageA/", {}, {}));
+			auto copyA = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Copy: A", "copy", "Runtime.dll bin/", "C:/Root/", {}, { "bin/Runtime.dll" }, { linkA }));
+			auto linkB = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Link: B", "link.exe", "", "C:/PackageB/", {}, {}));
+			auto copyB = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Copy: B", "copy", "Runtime.dll bin/", "C:/Root/", {}, { "bin/Runtime.dll" }, { linkB }));
+
+			auto uut = BuildExecutionPlan();
+			uut.AddPackage({ copyA });
+			uut.AddPackage({ copyB });
+			uut.Deduplicate();
+			uut.Compile();
+
+			Assert::IsFalse(uut.IsDuplicate(0), "Verify the first copy is kept.");
+			Assert::IsTrue(uut.IsDuplicate(2), "Verify the second copy is merged.");
+			Assert::AreEqual(
+				std::vector<uint32_t>({ 1, 3 }),
+				std::vector<uint32_t>(uut.GetChildren(0).begin(), uut.GetChildren(0).end()),
+				"Verify the merged node has both children.");
+			Assert::IsTrue(uut.GetChildren(2).empty(), "Verify the merged node has no children.");
+			Assert::AreEqual(
+				std::vector<uint32_t>({ 0 }),
+				std::vector<uint32_t>(uut.GetPackageRoots(1).begin(), uut.GetPackageRoots(1).end()),
+				"Verify the package root is rewired.");
+			Assert::AreEqual(
+				std::vector<uint32_t>({ 2, 1, 0, 1 }),
+				uut.GetDependencyCounts(),
+				"Verify the dependency counts.");
+		}
+
+		[[Fact]]
+		void Deduplicate_ConflictingProducers_Throws()
+		{
+			auto copyA = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Copy: A", "copy", "A/Runtime.dll bin/", "C:/Root/", {}, { "bin/Runtime.dll" }));
+			auto copyB = Memory::Reference<Runtime::BuildGraphNode>(
+				new Runtime::BuildGraphNode("Copy: B", "copy", "B/Runtime.dll bin/", "C:/Root/", {}, { "bin/Runtime.dll" }));
+
+			auto uut = BuildExecutionPlan();
+			uut.AddPackage({ copyA, copyB });
+
+			auto message = std::string();
+			try
+			{
+				uut.Deduplicate();
+			}
+			catch (const std::runtime_error& error)
+			{
+				message = error.what();
+			}
+
+			Assert::AreEqual(
+				std::string("Conflicting producers for output file C:/Root/bin/Runtime.dll: Copy: A and Copy: B"),
+				message,
+				"Verify the conflict is reported.");
+		}
+	};
+}
@@ -200,6 +200,50 @@ namespace Soup::Build::UnitTests
 				"Verify log messages match expected.");
 		}
 
+		[[Fact]]
+		void IsOutdated_SingleInput_TargetExists_Outdated_Explanation()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Create the file state
+			auto outputTime = CreateDateTime(2015, 5, 22, 9, 12);
+			auto inputTime = CreateDateTime(2015, 5, 22, 9, 13);
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Output.bin"),
+				std::make_shared<MockFile>(outputTime));
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(inputTime));
+
+			// Setup the input parameters
+			auto targetFiles = std::vector<Path>({
+				Path("Output.bin"),
+			});
+			auto inputFiles = std::vector<Path>({
+				Path("Input.cpp"),
+			});
+			auto rootPath = Path("C:/Root/");
+
+			// Perform the check
+			auto uut = BuildHistoryChecker();
+			auto explanation = RebuildExplanation();
+			bool result = uut.IsOutdated(targetFiles, inputFiles, rootPath, explanation);
+
+			// Verify the results
+			Assert::IsTrue(result, "Verify the result is true.");
+			Assert::IsTrue(explanation.Reason == RebuildReason::InputNewer, "Verify the reason is a newer input.");
+			Assert::AreEqual(
+				std::string("C:/Root/Input.cpp is newer than C:/Root/Output.bin by 60s"),
+				explanation.Detail,
+				"Verify the explanation detail.");
+		}
+
 		[[Fact]]
 		void IsOutdated_SingleInput_TargetExists_UpToDate()
 		{
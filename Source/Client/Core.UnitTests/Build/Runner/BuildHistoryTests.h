@@ -192,5 +192,70 @@ namespace Soup::Build::UnitTests
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
 		}
+
+		[[Fact]]
+		void TryFindSourceFile_UnityBuildRoundTrip()
+		{
+			// Record the includes the way the runner sees a unity compile followed by a
+			// file compiled on its own
+			auto unityFile = HeaderInclude(Path("out/obj/unity_1234.cpp"));
+			auto batchFile = HeaderInclude(Path("C:/Package/File1.cpp"));
+			batchFile.Includes.push_back(HeaderInclude(Path("C:/Package/Common.h")));
+			unityFile.Includes.push_back(std::move(batchFile));
+
+			auto singleFile = HeaderInclude(Path("File2.cpp"));
+			singleFile.Includes.push_back(HeaderInclude(Path("C:/Package/Other.h")));
+
+			auto history = BuildHistory();
+			history.UpdateIncludeTree(std::vector<HeaderInclude>({ std::move(unityFile) }));
+			history.UpdateIncludeTree(std::vector<HeaderInclude>({ std::move(singleFile) }));
+
+			// Round trip through the saved state
+			auto content = std::stringstream();
+			BuildHistoryJson::Serialize(history, content);
+			auto uut = BuildHistoryJson::Deserialize(content);
+
+			auto packageRoot = Path("C:/Package/");
+			auto batchHistoryFile = Path();
+			Assert::IsTrue(
+				uut.TryFindSourceFile(packageRoot, Path("File1.cpp"), batchHistoryFile),
+				"Verify the unity batch file was found.");
+			Assert::AreEqual(Path("C:/Package/File1.cpp"), batchHistoryFile, "Verify the batch history file matches.");
+
+			auto batchClosure = std::vector<Path>();
+			Assert::IsTrue(uut.TryBuildIncludeClosure(batchHistoryFile, batchClosure), "Verify the batch closure succeeded.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("C:/Package/Common.h") }),
+				batchClosure,
+				"Verify the batch closure matches.");
+
+			auto singleHistoryFile = Path();
+			Assert::IsTrue(
+				uut.TryFindSourceFile(packageRoot, Path("File2.cpp"), singleHistoryFile),
+				"Verify the single file was found.");
+			Assert::AreEqual(Path("File2.cpp"), singleHistoryFile, "Verify the single history file matches.");
+
+			auto singleClosure = std::vector<Path>();
+			Assert::IsTrue(uut.TryBuildIncludeClosure(singleHistoryFile, singleClosure), "Verify the single closure succeeded.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("C:/Package/Other.h") }),
+				singleClosure,
+				"Verify the single closure matches.");
+		}
+
+		[[Fact]]
+		void TryFindSourceFile_MissingFails()
+		{
+			auto uut = BuildHistory(std::vector<FileInfo>({
+				FileInfo(
+					Path("File1.cpp"),
+					std::vector<Path>({})),
+			}));
+
+			auto historyFile = Path();
+			Assert::IsFalse(
+				uut.TryFindSourceFile(Path("C:/Package/"), Path("File2.cpp"), historyFile),
+				"Verify the missing file was not found.");
+		}
 	};
 }
@@ -0,0 +1,221 @@
+// <copyright file="BuildResourceSchedulerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::UnitTests
+{
+	class MockJobServer : public IJobServer
+	{
+	public:
+		MockJobServer(uint32_t tokens) :
+			Tokens(tokens)
+		{
+		}
+
+		bool TryAcquire() override final
+		{
+			if (Tokens == 0)
+				return false;
+			Tokens--;
+			return true;
+		}
+
+		void Release() override final
+		{
+			Tokens++;
+		}
+
+		uint32_t Tokens;
+	};
+
+	class BuildResourceSchedulerTests
+	{
+	public:
+		[[Fact]]
+		void Initialize()
+		{
+			auto uut = BuildResourceScheduler(BuildResourceLimits());
+
+			Assert::AreEqual<uint64_t>(0, uut.GetActiveCount(), "Verify active count.");
+			Assert::AreEqual<uint64_t>(0, uut.GetActiveMemory(), "Verify active memory.");
+			Assert::AreEqual<uint64_t>(1, uut.GetLimits().MaxParallelism, "Verify default parallelism.");
+		}
+
+		[[Fact]]
+		void TryAcquire_MaxParallelism()
+		{
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 2;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify first is admitted.");
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify second is admitted.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Copy, 0), "Verify third is rejected.");
+
+			uut.Release(ResourceClass::Compile, 0);
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Copy, 0), "Verify admitted after release.");
+			Assert::AreEqual<uint64_t>(2, uut.GetActiveCount(), "Verify active count.");
+		}
+
+		[[Fact]]
+		void TryAcquire_ClassLimit()
+		{
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 8;
+			limits.ClassLimits.emplace(ResourceClass::Link, 1);
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Link, 0), "Verify first link is admitted.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Link, 0), "Verify second link is rejected.");
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify compile is admitted.");
+			Assert::AreEqual<uint64_t>(1, uut.GetActiveCount(ResourceClass::Link), "Verify active link count.");
+		}
+
+		[[Fact]]
+		void TryAcquire_MemoryBudget()
+		{
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 8;
+			limits.MemoryBudget = 1024;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 512), "Verify first is admitted.");
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 512), "Verify second is admitted.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Compile, 1), "Verify over budget is rejected.");
+
+			uut.Release(ResourceClass::Compile, 512);
+			Assert::AreEqual<uint64_t>(512, uut.GetActiveMemory(), "Verify active memory.");
+		}
+
+		[[Fact]]
+		void TryAcquire_OverBudget_AdmittedWhenIdle()
+		{
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 8;
+			limits.MemoryBudget = 1024;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Link, 4096), "Verify large node is admitted.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Compile, 1), "Verify second is rejected.");
+		}
+
+		[[Fact]]
+		void Release_NotAcquired_Throws()
+		{
+			auto uut = BuildResourceScheduler(BuildResourceLimits());
+
+			Assert::ThrowsRuntimeError([&uut]() {
+				uut.Release(ResourceClass::Compile, 0);
+			});
+		}
+
+		[[Fact]]
+		void TryAcquire_MemoryPressure()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("/proc/pressure/memory"),
+				std::make_shared<MockFile>(std::stringstream(
+					"some avg10=42.50 avg60=10.00 avg300=1.00 total=123456\n"
+					"full avg10=20.00 avg60=5.00 avg300=0.50 total=65432\n")));
+
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 8;
+			limits.MemoryPressureThreshold = 40;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify first is admitted.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Compile, 0), "Verify rejected under pressure.");
+		}
+
+		[[Fact]]
+		void TryAcquire_MemoryPressure_Unavailable()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 8;
+			limits.MemoryPressureThreshold = 40;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify first is admitted.");
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify second is admitted.");
+		}
+
+		[[Fact]]
+		void TryAcquire_JobServer()
+		{
+			auto jobServer = std::make_shared<MockJobServer>(1);
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 8;
+			limits.JobServer = jobServer;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify implicit token is used.");
+			Assert::AreEqual<uint32_t>(1, jobServer->Tokens, "Verify no token taken.");
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify second takes a token.");
+			Assert::AreEqual<uint32_t>(0, jobServer->Tokens, "Verify token taken.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Compile, 0), "Verify third is rejected.");
+
+			uut.Release(ResourceClass::Compile, 0);
+			Assert::AreEqual<uint32_t>(1, jobServer->Tokens, "Verify token returned.");
+			uut.Release(ResourceClass::Compile, 0);
+			Assert::AreEqual<uint32_t>(1, jobServer->Tokens, "Verify implicit token kept.");
+		}
+
+		[[Fact]]
+		void TryAcquire_ThreadCount()
+		{
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 4;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0, 3), "Verify batch is admitted.");
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0), "Verify single fits.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Compile, 0, 2), "Verify batch is rejected.");
+			Assert::AreEqual<uint64_t>(4, uut.GetActiveThreadCount(), "Verify active thread count.");
+
+			uut.Release(ResourceClass::Compile, 0, 3);
+			Assert::AreEqual<uint64_t>(1, uut.GetActiveThreadCount(), "Verify active thread count after release.");
+
+			// A batch larger than the build is clamped to the total parallelism
+			uut.Release(ResourceClass::Compile, 0);
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0, 16), "Verify large batch is admitted.");
+			Assert::AreEqual<uint64_t>(4, uut.GetActiveThreadCount(), "Verify clamped thread count.");
+		}
+
+		[[Fact]]
+		void TryAcquire_ThreadCount_JobServer()
+		{
+			auto jobServer = std::make_shared<MockJobServer>(2);
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 8;
+			limits.JobServer = jobServer;
+			auto uut = BuildResourceScheduler(limits);
+
+			Assert::IsTrue(uut.TryAcquire(ResourceClass::Compile, 0, 2), "Verify batch is admitted.");
+			Assert::AreEqual<uint32_t>(1, jobServer->Tokens, "Verify one extra token taken.");
+			Assert::IsFalse(uut.TryAcquire(ResourceClass::Compile, 0, 2), "Verify second batch is rejected.");
+			Assert::AreEqual<uint32_t>(1, jobServer->Tokens, "Verify partial tokens returned.");
+
+			uut.Release(ResourceClass::Compile, 0, 2);
+			Assert::AreEqual<uint32_t>(2, jobServer->Tokens, "Verify tokens returned.");
+		}
+
+		[[Fact]]
+		void TryParsePressure()
+		{
+			auto content = std::stringstream("some avg10=1.25 avg60=0.00 avg300=0.00 total=0\n");
+			double result = 0;
+			Assert::IsTrue(MemoryPressureMonitor::TryParsePressure(content, result), "Verify parse succeeded.");
+			Assert::AreEqual(1.25, result, "Verify pressure value.");
+		}
+	};
+}
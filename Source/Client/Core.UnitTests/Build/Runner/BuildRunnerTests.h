@@ -588,5 +588,476 @@ namespace Soup::Build::UnitTests
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
 		}
+
+		[[Fact]]
+		void Execute_TwoPackages_ConsumerWaitsForProducer()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcesManager = ScopedProcessManagerRegister(processManager);
+
+			auto uut = BuildRunner(Path("C:/BuildDirectory/"));
+
+			// Setup the consumer package first to ensure the order comes from the shared file
+			auto consumerNodes = std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+				new Runtime::BuildGraphNode(
+					"Link: B",
+					"Link.exe",
+					"Arguments",
+					"C:/PackageB/",
+					std::vector<std::string>({
+						"C:/PackageA/out/A.lib",
+					}),
+					std::vector<std::string>({
+						"out/B.exe",
+					})),
+			});
+			auto producerNodes = std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+				new Runtime::BuildGraphNode(
+					"Archive: A",
+					"Archive.exe",
+					"Arguments",
+					"C:/PackageA/",
+					std::vector<std::string>({
+						"A.obj",
+					}),
+					std::vector<std::string>({
+						"out/A.lib",
+					})),
+			});
+			bool forceBuild = true;
+			uut.AddPackage(consumerNodes, Path("C:/PackageB/out/obj/release/"), forceBuild);
+			uut.AddPackage(producerNodes, Path("C:/PackageA/out/obj/release/"), forceBuild);
+			uut.Execute();
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"HIGH: Archive: A",
+					"DIAG: Execute: Archive.exe Arguments",
+					"HIGH: Link: B",
+					"DIAG: Execute: Link.exe Arguments",
+					"INFO: Saving updated build state",
+					"INFO: Create Directory: C:/PackageB/out/obj/release/.soup",
+					"INFO: Saving updated build state",
+					"INFO: Create Directory: C:/PackageA/out/obj/release/.soup",
+					"HIGH: Done",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Exists: C:/PackageB/out/obj/release/.soup",
+					"CreateDirectory: C:/PackageB/out/obj/release/.soup",
+					"OpenWrite: C:/PackageB/out/obj/release/.soup/BuildHistory.json",
+					"Exists: C:/PackageA/out/obj/release/.soup",
+					"CreateDirectory: C:/PackageA/out/obj/release/.soup",
+					"OpenWrite: C:/PackageA/out/obj/release/.soup/BuildHistory.json",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Execute: [C:/PackageA/] Archive.exe Arguments",
+					"Execute: [C:/PackageB/] Link.exe Arguments",
+				}),
+				processManager->GetRequests(),
+				"Verify process manager requests match expected.");
+		}
+
+		[[Fact]]
+		void Execute_BatchCompile_AttributesIncludes()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// The batched compiler echoes each file name before its includes
+			auto uut = BuildRunner(
+				Path("C:/BuildDirectory/"),
+				BuildResourceLimits(),
+				nullptr,
+				[](const Path& program, const std::string& arguments, const Path& workingDirectory)
+				{
+					auto result = BuildRunner::ProcessResult();
+					result.ExitCode = 0;
+					result.StdOut =
+						"A.cpp\n"
+						"Note: including file: C:/root/A.h\n"
+						"B.cpp\n"
+						"Note: including file: C:/root/B.h\n";
+					return result;
+				});
+
+			auto nodes = std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+				new Runtime::BuildGraphNode(
+					"Batch",
+					"cl.exe",
+					"Arguments",
+					"C:/root/",
+					std::vector<std::string>({
+						"A.cpp",
+						"Source/B.cpp",
+					}),
+					std::vector<std::string>({
+						"A.obj",
+						"B.obj",
+					})),
+			});
+			auto objectDirectory = Path("out/obj/release/");
+			bool forceBuild = true;
+			uut.Execute(nodes, objectDirectory, forceBuild);
+
+			// Verify each file only has its own includes
+			auto historyFile = fileSystem->GetMockFile(Path("C:/BuildDirectory/out/obj/release/.soup/BuildHistory.json"));
+			auto actual = BuildHistoryJson::Deserialize(historyFile->Content);
+			auto expected = BuildHistory(
+				{
+					FileInfo(Path("A.cpp"), { Path("C:/root/A.h") }),
+					FileInfo(Path("C:/root/A.h"), {}),
+					FileInfo(Path("C:/root/B.h"), {}),
+					FileInfo(Path("Source/B.cpp"), { Path("C:/root/B.h") }),
+				});
+
+			Assert::AreEqual(expected, actual, "Verify build history matches expected.");
+		}
+
+		[[Fact]]
+		void Execute_BatchCompile_DuplicateFileName_NotAttributed()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Both files named A.cpp echo the same name
+			auto uut = BuildRunner(
+				Path("C:/BuildDirectory/"),
+				BuildResourceLimits(),
+				nullptr,
+				[](const Path& program, const std::string& arguments, const Path& workingDirectory)
+				{
+					auto result = BuildRunner::ProcessResult();
+					result.ExitCode = 0;
+					result.StdOut =
+						"A.cpp\n"
+						"Note: including file: C:/root/A.h\n"
+						"A.cpp\n"
+						"Note: including file: C:/root/Nested/A.h\n"
+						"B.cpp\n"
+						"Note: including file: C:/root/B.h\n";
+					return result;
+				});
+
+			auto nodes = std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+				new Runtime::BuildGraphNode(
+					"Batch",
+					"cl.exe",
+					"Arguments",
+					"C:/root/",
+					std::vector<std::string>({
+						"A.cpp",
+						"Nested/A.cpp",
+						"B.cpp",
+					}),
+					std::vector<std::string>({
+						"A.obj",
+						"Nested/A.obj",
+						"B.obj",
+					})),
+			});
+			auto objectDirectory = Path("out/obj/release/");
+			bool forceBuild = true;
+			uut.Execute(nodes, objectDirectory, forceBuild);
+
+			// Verify the includes were not given to the wrong file
+			auto historyFile = fileSystem->GetMockFile(Path("C:/BuildDirectory/out/obj/release/.soup/BuildHistory.json"));
+			auto actual = BuildHistoryJson::Deserialize(historyFile->Content);
+			auto expected = BuildHistory(
+				{
+					FileInfo(Path("B.cpp"), { Path("C:/root/B.h") }),
+					FileInfo(Path("C:/root/B.h"), {}),
+				});
+
+			Assert::AreEqual(expected, actual, "Verify build history matches expected.");
+		}
+
+		[[Fact]]
+		void Execute_Parallel_CompletesOutOfOrder()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto jobServer = std::make_shared<MockJobServer>(1);
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 2;
+			limits.JobServer = jobServer;
+
+			// Hold the slow job until the child of the fast job has started
+			std::mutex mutex;
+			std::condition_variable condition;
+			auto fastChildStarted = false;
+			auto events = std::vector<std::string>();
+			auto uut = BuildRunner(
+				Path("C:/BuildDirectory/"),
+				limits,
+				nullptr,
+				[&](const Path& program, const std::string& arguments, const Path& workingDirectory)
+				{
+					auto name = program.GetFileStem();
+					auto lock = std::unique_lock<std::mutex>(mutex);
+					events.push_back("Start " + name);
+					if (name == "Slow")
+					{
+						condition.wait_for(lock, std::chrono::seconds(10), [&]() { return fastChildStarted; });
+					}
+					else if (name == "FastChild")
+					{
+						fastChildStarted = true;
+						condition.notify_all();
+					}
+
+					events.push_back("Done " + name);
+					auto result = BuildRunner::ProcessResult();
+					result.ExitCode = 0;
+					return result;
+				});
+
+			auto nodes = std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+				new Runtime::BuildGraphNode(
+					"Slow",
+					"Slow.exe",
+					"Arguments",
+					"C:/root/",
+					std::vector<std::string>({}),
+					std::vector<std::string>({ "Slow.out" }),
+					std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+						new Runtime::BuildGraphNode(
+							"SlowChild",
+							"SlowChild.exe",
+							"Arguments",
+							"C:/root/",
+							std::vector<std::string>({}),
+							std::vector<std::string>({ "SlowChild.out" })),
+					})),
+				new Runtime::BuildGraphNode(
+					"Fast",
+					"Fast.exe",
+					"Arguments",
+					"C:/root/",
+					std::vector<std::string>({}),
+					std::vector<std::string>({ "Fast.out" }),
+					std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+						new Runtime::BuildGraphNode(
+							"FastChild",
+							"FastChild.exe",
+							"Arguments",
+							"C:/root/",
+							std::vector<std::string>({}),
+							std::vector<std::string>({ "FastChild.out" })),
+					})),
+			});
+			bool forceBuild = true;
+			auto objectDirectory = Path("out/obj/release/");
+			uut.Execute(nodes, objectDirectory, forceBuild);
+
+			// Verify the fast job unblocked its child while the slow job was still running
+			auto getEventIndex = [&events](const std::string& event)
+			{
+				return std::find(events.begin(), events.end(), event) - events.begin();
+			};
+
+			Assert::AreEqual<size_t>(8, events.size(), "Verify all jobs ran once.");
+			Assert::IsTrue(getEventIndex("Done Fast") < getEventIndex("Start FastChild"), "Verify child started after parent.");
+			Assert::IsTrue(getEventIndex("Start FastChild") < getEventIndex("Done Slow"), "Verify child started while the slow job was running.");
+			Assert::IsTrue(getEventIndex("Done Slow") < getEventIndex("Start SlowChild"), "Verify child started after parent.");
+
+			// Verify the borrowed job server token was returned
+			Assert::AreEqual<uint32_t>(1, jobServer->Tokens, "Verify job server tokens were released.");
+		}
+
+		[[Fact]]
+		void Execute_Parallel_FailureJoinsRunningJobs()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto jobServer = std::make_shared<MockJobServer>(1);
+			auto limits = BuildResourceLimits();
+			limits.MaxParallelism = 2;
+			limits.JobServer = jobServer;
+
+			// Keep the second job running until the first job has failed
+			std::mutex mutex;
+			std::condition_variable condition;
+			auto failed = false;
+			auto events = std::vector<std::string>();
+			auto uut = BuildRunner(
+				Path("C:/BuildDirectory/"),
+				limits,
+				nullptr,
+				[&](const Path& program, const std::string& arguments, const Path& workingDirectory)
+				{
+					auto name = program.GetFileStem();
+					auto lock = std::unique_lock<std::mutex>(mutex);
+					events.push_back("Start " + name);
+					auto result = BuildRunner::ProcessResult();
+					result.ExitCode = 0;
+					if (name == "Failing")
+					{
+						failed = true;
+						condition.notify_all();
+						result.ExitCode = 1;
+					}
+					else if (name == "Running")
+					{
+						condition.wait_for(lock, std::chrono::seconds(10), [&]() { return failed; });
+					}
+
+					events.push_back("Done " + name);
+					return result;
+				});
+
+			auto nodes = std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+				new Runtime::BuildGraphNode(
+					"Failing",
+					"Failing.exe",
+					"Arguments",
+					"C:/root/",
+					std::vector<std::string>({}),
+					std::vector<std::string>({ "Failing.out" })),
+				new Runtime::BuildGraphNode(
+					"Running",
+					"Running.exe",
+					"Arguments",
+					"C:/root/",
+					std::vector<std::string>({}),
+					std::vector<std::string>({ "Running.out" }),
+					std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+						new Runtime::BuildGraphNode(
+							"RunningChild",
+							"RunningChild.exe",
+							"Arguments",
+							"C:/root/",
+							std::vector<std::string>({}),
+							std::vector<std::string>({ "RunningChild.out" })),
+					})),
+			});
+			bool forceBuild = true;
+			auto objectDirectory = Path("out/obj/release/");
+			Assert::ThrowsRuntimeError([&uut, &nodes, &objectDirectory, forceBuild]() {
+				uut.Execute(nodes, objectDirectory, forceBuild);
+			});
+
+			// Verify the running job was joined and no new work was started
+			std::sort(events.begin(), events.end());
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Done Failing",
+					"Done Running",
+					"Start Failing",
+					"Start Running",
+				}),
+				events,
+				"Verify only the root jobs ran.");
+
+			// Verify the borrowed job server token was returned
+			Assert::AreEqual<uint32_t>(1, jobServer->Tokens, "Verify job server tokens were released.");
+		}
+
+		[[Fact]]
+		void Execute_Explain_SharedLogAcrossRunners()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto executeProcess = [](const Path& program, const std::string& arguments, const Path& workingDirectory)
+			{
+				auto result = BuildRunner::ProcessResult();
+				result.ExitCode = 0;
+				return result;
+			};
+
+			// Each build stage runs its own runner that reports to the same log
+			auto explanationLog = RebuildExplanationLog();
+			auto objectDirectory = Path("out/obj/release/");
+			bool forceBuild = true;
+			for (auto title : { "Compile", "Link" })
+			{
+				auto uut = BuildRunner(
+					Path("C:/BuildDirectory/"),
+					BuildResourceLimits(),
+					&explanationLog,
+					executeProcess);
+				auto nodes = std::vector<Memory::Reference<Runtime::BuildGraphNode>>({
+					new Runtime::BuildGraphNode(
+						title,
+						"Command.exe",
+						"Arguments",
+						"C:/TestWorkingDirectory/",
+						std::vector<std::string>({}),
+						std::vector<std::string>({})),
+				});
+				uut.Execute(nodes, objectDirectory, forceBuild);
+			}
+
+			explanationLog.ReportSummary();
+
+			// Verify the totals were only reported once for both runners
+			auto highPriorityMessages = std::vector<std::string>();
+			for (auto& message : testListener->GetMessages())
+			{
+				if (message.starts_with("HIGH: "))
+					highPriorityMessages.push_back(message);
+			}
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"HIGH: Compile",
+					"HIGH: Explain: Compile: Forced rebuild",
+					"HIGH: Done",
+					"HIGH: Link",
+					"HIGH: Explain: Link: Forced rebuild",
+					"HIGH: Done",
+					"HIGH: Explain: 2 operations executed",
+					"HIGH:   Forced rebuild: 2",
+				}),
+				highPriorityMessages,
+				"Verify log messages match expected.");
+		}
 	};
 }
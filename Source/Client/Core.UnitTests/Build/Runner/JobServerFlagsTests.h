@@ -0,0 +1,150 @@
+// <copyright file="JobServerFlagsTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::UnitTests
+{
+	class JobServerFlagsTests
+	{
+	public:
+		[[Fact]]
+		void TryParse_Empty()
+		{
+			auto result = JobServerAuth();
+			Assert::IsFalse(JobServerFlags::TryParse("", result), "Verify parse failed.");
+		}
+
+		[[Fact]]
+		void TryParse_NoJobServer()
+		{
+			auto result = JobServerAuth();
+			Assert::IsFalse(JobServerFlags::TryParse("-k -j4", result), "Verify parse failed.");
+		}
+
+		[[Fact]]
+		void TryParse_Fifo()
+		{
+			auto result = JobServerAuth();
+			Assert::IsTrue(
+				JobServerFlags::TryParse("-j8 --jobserver-auth=fifo:/tmp/GMfifo1234", result),
+				"Verify parse succeeded.");
+
+			auto expected = JobServerAuth();
+			expected.Type = JobServerType::Fifo;
+			expected.Name = "/tmp/GMfifo1234";
+			expected.JobCount = 8;
+			Assert::IsTrue(expected == result, "Verify result matches expected.");
+		}
+
+		[[Fact]]
+		void TryParse_Pipe()
+		{
+			auto result = JobServerAuth();
+			Assert::IsTrue(
+				JobServerFlags::TryParse(" --jobserver-auth=3,4 -- VAR=1", result),
+				"Verify parse succeeded.");
+
+			auto expected = JobServerAuth();
+			expected.Type = JobServerType::Pipe;
+			expected.ReadDescriptor = 3;
+			expected.WriteDescriptor = 4;
+			Assert::IsTrue(expected == result, "Verify result matches expected.");
+		}
+
+		[[Fact]]
+		void TryParse_LegacyPipe()
+		{
+			auto result = JobServerAuth();
+			Assert::IsTrue(
+				JobServerFlags::TryParse("--jobserver-fds=5,6 -j", result),
+				"Verify parse succeeded.");
+
+			auto expected = JobServerAuth();
+			expected.Type = JobServerType::Pipe;
+			expected.ReadDescriptor = 5;
+			expected.WriteDescriptor = 6;
+			Assert::IsTrue(expected == result, "Verify result matches expected.");
+		}
+
+		[[Fact]]
+		void TryParse_ClosedPipe()
+		{
+			auto result = JobServerAuth();
+			Assert::IsFalse(
+				JobServerFlags::TryParse("--jobserver-auth=-2,-2", result),
+				"Verify parse failed.");
+		}
+
+		[[Fact]]
+		void TryParse_Semaphore()
+		{
+			auto result = JobServerAuth();
+			Assert::IsTrue(
+				JobServerFlags::TryParse("-j2 --jobserver-auth=gmake_semaphore_1234", result),
+				"Verify parse succeeded.");
+
+			auto expected = JobServerAuth();
+			expected.Type = JobServerType::Semaphore;
+			expected.Name = "gmake_semaphore_1234";
+			expected.JobCount = 2;
+			Assert::IsTrue(expected == result, "Verify result matches expected.");
+		}
+
+		[[Fact]]
+		void Format_Fifo()
+		{
+			auto auth = JobServerAuth();
+			auth.Type = JobServerType::Fifo;
+			auth.Name = "/tmp/soup_jobserver_1";
+			auth.JobCount = 16;
+
+			Assert::AreEqual(
+				std::string("-j16 --jobserver-auth=fifo:/tmp/soup_jobserver_1"),
+				JobServerFlags::Format(auth),
+				"Verify format matches expected.");
+		}
+
+		[[Fact]]
+		void Format_RoundTrip()
+		{
+			auto auth = JobServerAuth();
+			auth.Type = JobServerType::Pipe;
+			auth.ReadDescriptor = 7;
+			auth.WriteDescriptor = 8;
+
+			auto result = JobServerAuth();
+			Assert::IsTrue(JobServerFlags::TryParse(JobServerFlags::Format(auth), result), "Verify parse succeeded.");
+			Assert::IsTrue(auth == result, "Verify round trip matches.");
+		}
+
+		[[Fact]]
+		void Merge_Empty()
+		{
+			auto auth = JobServerAuth();
+			auth.Type = JobServerType::Fifo;
+			auth.Name = "/tmp/soup_jobserver_1";
+			auth.JobCount = 4;
+
+			Assert::AreEqual(
+				std::string("-j4 --jobserver-auth=fifo:/tmp/soup_jobserver_1"),
+				JobServerFlags::Merge("", auth),
+				"Verify merge matches expected.");
+		}
+
+		[[Fact]]
+		void Merge_KeepsExistingFlags()
+		{
+			auto auth = JobServerAuth();
+			auth.Type = JobServerType::Fifo;
+			auth.Name = "/tmp/soup_jobserver_1";
+			auth.JobCount = 4;
+
+			Assert::AreEqual(
+				std::string("k -s -j4 --jobserver-auth=fifo:/tmp/soup_jobserver_1 -- VAR=1"),
+				JobServerFlags::Merge("k -s -j2 --jobserver-auth=3,4 --jobserver-fds=3,4 -- VAR=1", auth),
+				"Verify merge matches expected.");
+		}
+	};
+}
@@ -0,0 +1,203 @@
+// <copyright file="BuildExtensionRegistryTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class BuildExtensionRegistryTests
+	{
+	public:
+		[[Fact]]
+		void GetRegisterFunction_CacheHit()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/bin/Extension.dll"),
+				std::make_shared<MockFile>(std::stringstream("Binary")));
+
+			auto loadedLibraries = std::vector<std::string>();
+			auto uut = BuildExtensionRegistry([&loadedLibraries](const Path& libraryPath)
+			{
+				loadedLibraries.push_back(libraryPath.ToString());
+				return BuildExtensionRegistry::RegisterBuildExtensionFunction(
+					[](IBuildSystem&) { return 1; });
+			});
+
+			auto first = uut.GetRegisterFunction(Path("C:/Extension/bin/Extension.dll"));
+			auto second = uut.GetRegisterFunction(Path("C:/Extension/bin/Extension.dll"));
+
+			Assert::IsTrue(first == second, "Verify the cached function is returned.");
+
+			// Verify the library was loaded once through its content addressed copy
+			auto copyPath = GetCopyPath("C:/Extension/bin/", "Binary");
+			Assert::AreEqual(
+				std::vector<std::string>({
+					copyPath.ToString(),
+				}),
+				loadedLibraries,
+				"Verify the loaded libraries match expected.");
+
+			// Verify the copy was written to a temporary file and moved into place
+			auto temporaryPath = FindTemporaryCopyPath(*fileSystem, copyPath);
+			auto& temporaryFile = fileSystem->GetMockFile(temporaryPath);
+			Assert::AreEqual(std::string("Binary"), temporaryFile->Content.str(), "Verify the copy contents match.");
+
+			auto requests = fileSystem->GetRequests();
+			Assert::IsTrue(
+				std::find(
+					requests.begin(),
+					requests.end(),
+					"Rename: [" + temporaryPath.ToString() + "] -> [" + copyPath.ToString() + "]") != requests.end(),
+				"Verify the copy was moved into place.");
+			Assert::IsTrue(
+				std::find(
+					requests.begin(),
+					requests.end(),
+					"GetDirectoryChildren: C:/Extension/bin/") != requests.end(),
+				"Verify the stale copies were checked.");
+		}
+
+		[[Fact]]
+		void GetRegisterFunction_UnchangedContent()
+		{
+			auto loadedLibraries = std::vector<std::string>();
+			auto uut = BuildExtensionRegistry([&loadedLibraries](const Path& libraryPath)
+			{
+				loadedLibraries.push_back(libraryPath.ToString());
+				if (loadedLibraries.size() == 1)
+					return BuildExtensionRegistry::RegisterBuildExtensionFunction(
+						[](IBuildSystem&) { return 1; });
+				else
+					return BuildExtensionRegistry::RegisterBuildExtensionFunction(
+						[](IBuildSystem&) { return 2; });
+			});
+
+			auto libraryPath = Path("C:/Extension/bin/Extension.dll");
+			auto first = BuildExtensionRegistry::RegisterBuildExtensionFunction(nullptr);
+			{
+				auto fileSystem = std::make_shared<MockFileSystem>();
+				auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+				fileSystem->CreateMockFile(
+					libraryPath,
+					std::make_shared<MockFile>(CreateDateTime(2015, 5, 22, 9, 11)));
+
+				first = uut.GetRegisterFunction(libraryPath);
+			}
+
+			// The binary was written again with the same content
+			{
+				auto fileSystem = std::make_shared<MockFileSystem>();
+				auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+				fileSystem->CreateMockFile(
+					libraryPath,
+					std::make_shared<MockFile>(CreateDateTime(2015, 5, 22, 9, 12)));
+
+				auto actual = uut.GetRegisterFunction(libraryPath);
+				Assert::IsTrue(first == actual, "Verify the loaded function is kept.");
+				Assert::AreEqual<size_t>(1, loadedLibraries.size(), "Verify the library was not reloaded.");
+			}
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					GetCopyPath("C:/Extension/bin/", "").ToString(),
+				}),
+				loadedLibraries,
+				"Verify the loaded libraries match expected.");
+		}
+
+		[[Fact]]
+		void GetRegisterFunction_ChangedContent()
+		{
+			auto loadedLibraries = std::vector<std::string>();
+			auto uut = BuildExtensionRegistry([&loadedLibraries](const Path& libraryPath)
+			{
+				loadedLibraries.push_back(libraryPath.ToString());
+				if (loadedLibraries.size() == 1)
+					return BuildExtensionRegistry::RegisterBuildExtensionFunction(
+						[](IBuildSystem&) { return 1; });
+				else
+					return BuildExtensionRegistry::RegisterBuildExtensionFunction(
+						[](IBuildSystem&) { return 2; });
+			});
+
+			auto libraryPath = Path("C:/Extension/bin/Extension.dll");
+			auto first = BuildExtensionRegistry::RegisterBuildExtensionFunction(nullptr);
+			{
+				auto fileSystem = std::make_shared<MockFileSystem>();
+				auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+				fileSystem->CreateMockFile(
+					libraryPath,
+					std::make_shared<MockFile>(std::stringstream("Original")));
+
+				first = uut.GetRegisterFunction(libraryPath);
+			}
+
+			// The binary was rebuilt with new content
+			{
+				auto fileSystem = std::make_shared<MockFileSystem>();
+				auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+				fileSystem->CreateMockFile(
+					libraryPath,
+					std::make_shared<MockFile>(std::stringstream("Changed")));
+
+				auto actual = uut.GetRegisterFunction(libraryPath);
+				Assert::IsFalse(first == actual, "Verify the new function is returned.");
+			}
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					GetCopyPath("C:/Extension/bin/", "Original").ToString(),
+					GetCopyPath("C:/Extension/bin/", "Changed").ToString(),
+				}),
+				loadedLibraries,
+				"Verify the changed library was loaded from a new path.");
+		}
+
+		[[Fact]]
+		void IsContentCopy()
+		{
+			auto libraryPath = Path("C:/Extension/bin/Extension.dll");
+			Assert::IsTrue(
+				BuildExtensionRegistry::IsContentCopy(libraryPath, Path("C:/Extension/bin/Extension.0123abcd.dll")),
+				"Verify a content copy matches.");
+			Assert::IsFalse(
+				BuildExtensionRegistry::IsContentCopy(libraryPath, Path("C:/Extension/bin/Extension.dll")),
+				"Verify the original library does not match.");
+			Assert::IsFalse(
+				BuildExtensionRegistry::IsContentCopy(libraryPath, Path("C:/Extension/bin/Extension.Core.dll")),
+				"Verify a sibling library does not match.");
+			Assert::IsFalse(
+				BuildExtensionRegistry::IsContentCopy(libraryPath, Path("C:/Extension/bin/Other.1234.dll")),
+				"Verify another library copy does not match.");
+			Assert::IsFalse(
+				BuildExtensionRegistry::IsContentCopy(libraryPath, Path("C:/Extension/bin/Extension.0123abcd.dll.5678.tmp")),
+				"Verify an in progress copy does not match.");
+		}
+
+	private:
+		static Path FindTemporaryCopyPath(MockFileSystem& fileSystem, const Path& copyPath)
+		{
+			auto prefix = "OpenWriteBinary: " + copyPath.ToString() + ".";
+			for (auto& request : fileSystem.GetRequests())
+			{
+				if (request.starts_with(prefix))
+					return Path(request.substr(std::string("OpenWriteBinary: ").size()));
+			}
+
+			throw std::runtime_error("Missing temporary copy write.");
+		}
+
+		static Path GetCopyPath(std::string_view directory, std::string_view content)
+		{
+			auto hash = ContentHash();
+			hash.Add(content);
+			auto copyName = std::stringstream();
+			copyName << "Extension." << std::hex << hash.GetValue() << ".dll";
+			return Path(std::string(directory)) + Path(copyName.str());
+		}
+	};
+}
@@ -0,0 +1,126 @@
+// <copyright file="ExtensionFingerprintTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class ExtensionFingerprintTests
+	{
+	public:
+		[[Fact]]
+		void TryLoad_MissingFile()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			uint64_t actual = 0;
+			auto result = ExtensionFingerprint::TryLoad(Path("C:/Extension/out/obj/"), actual);
+
+			Assert::IsFalse(result, "Verify result is false.");
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Exists: C:/Extension/out/obj/.soup/ExtensionFingerprint.txt",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		[[Fact]]
+		void TryLoad_SavedFingerprint()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/out/obj/.soup/ExtensionFingerprint.txt"),
+				std::make_shared<MockFile>(std::stringstream("1a2b3c")));
+
+			uint64_t actual = 0;
+			auto result = ExtensionFingerprint::TryLoad(Path("C:/Extension/out/obj/"), actual);
+
+			Assert::IsTrue(result, "Verify result is true.");
+			Assert::AreEqual<uint64_t>(0x1a2b3c, actual, "Verify the fingerprint matches expected.");
+		}
+
+		[[Fact]]
+		void Compute_ChangesWithCompilerAndDependencies()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto recipe = Recipe();
+			recipe.SetName("Extension");
+			auto packageRoot = Path("C:/Extension/");
+			auto targetDirectory = Path("C:/Extension/out/obj/");
+
+			auto expected = ExtensionFingerprint::Compute(packageRoot, targetDirectory, recipe, "MSVC", "release", {});
+			auto actual = ExtensionFingerprint::Compute(packageRoot, targetDirectory, recipe, "MSVC", "release", {});
+			Assert::AreEqual(expected, actual, "Verify the fingerprint is stable.");
+
+			auto otherCompiler = ExtensionFingerprint::Compute(packageRoot, targetDirectory, recipe, "Clang", "release", {});
+			Assert::AreNotEqual(expected, otherCompiler, "Verify the compiler is part of the fingerprint.");
+
+			auto otherFlavor = ExtensionFingerprint::Compute(packageRoot, targetDirectory, recipe, "MSVC", "debug", {});
+			Assert::AreNotEqual(expected, otherFlavor, "Verify the flavor is part of the fingerprint.");
+
+			auto otherDependency = ExtensionFingerprint::Compute(packageRoot, targetDirectory, recipe, "MSVC", "release", { 1 });
+			Assert::AreNotEqual(expected, otherDependency, "Verify the dependencies are part of the fingerprint.");
+		}
+
+		[[Fact]]
+		void Compute_ChangesWithIncludedHeader()
+		{
+			auto recipe = Recipe();
+			recipe.SetName("Extension");
+			recipe.SetSource({ "Extension.cpp" });
+			auto packageRoot = Path("C:/Extension/");
+			auto targetDirectory = Path("C:/Extension/out/obj/");
+
+			// The source was compiled in a unity file and recorded under its absolute path
+			auto expected = ComputeWithHeaderTime(packageRoot, targetDirectory, recipe, CreateDateTime(2015, 5, 22, 9, 11));
+			auto actual = ComputeWithHeaderTime(packageRoot, targetDirectory, recipe, CreateDateTime(2015, 5, 22, 9, 11));
+			Assert::AreEqual(expected, actual, "Verify the fingerprint is stable.");
+
+			auto changedHeader = ComputeWithHeaderTime(packageRoot, targetDirectory, recipe, CreateDateTime(2015, 5, 22, 9, 12));
+			Assert::AreNotEqual(expected, changedHeader, "Verify the included header is part of the fingerprint.");
+		}
+
+	private:
+		static uint64_t ComputeWithHeaderTime(
+			const Path& packageRoot,
+			const Path& targetDirectory,
+			Recipe& recipe,
+			std::time_t headerTime)
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/out/obj/.soup/BuildHistory.json"),
+				std::make_shared<MockFile>(std::stringstream(R"({
+					"knownFiles": [
+						{
+							"file": "C:/Extension/Extension.cpp",
+							"includes": [ "C:/Extension/Helper.h" ]
+						},
+						{
+							"file": "C:/Extension/Helper.h",
+							"includes": []
+						}
+					]
+				})")));
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/Extension.cpp"),
+				std::make_shared<MockFile>(CreateDateTime(2015, 5, 22, 9, 10)));
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/Helper.h"),
+				std::make_shared<MockFile>(headerTime));
+
+			return ExtensionFingerprint::Compute(packageRoot, targetDirectory, recipe, "MSVC", "release", {});
+		}
+	};
+}
@@ -0,0 +1,108 @@
+// <copyright file="PackageBuildSchedulerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class PackageBuildSchedulerTests
+	{
+	public:
+		[[Fact]]
+		void Initialize()
+		{
+			auto uut = PackageBuildScheduler(1);
+		}
+
+		[[Fact]]
+		void Execute_SingleJob_DependencyOrder()
+		{
+			auto uut = PackageBuildScheduler(1);
+			uut.AddPackage(3, { 1, 2 });
+			uut.AddPackage(1, {});
+			uut.AddPackage(2, { 1 });
+			uut.AddPackage(4, {});
+
+			auto prepared = std::vector<int>();
+			auto built = std::vector<int>();
+			uut.Execute(
+				[&prepared](int id) { prepared.push_back(id); },
+				[&built](int id) { built.push_back(id); });
+
+			Assert::AreEqual(
+				std::vector<int>({ 1, 2, 3, 4 }),
+				prepared,
+				"Verify packages are prepared in dependency order.");
+			Assert::AreEqual(
+				std::vector<int>({ 1, 2, 3, 4 }),
+				built,
+				"Verify packages are built in dependency order.");
+		}
+
+		[[Fact]]
+		void Execute_IndependentPackagesRunConcurrently()
+		{
+			auto uut = PackageBuildScheduler(2);
+			uut.AddPackage(1, {});
+			uut.AddPackage(2, {});
+
+			// Each build waits for the other to start, which can only complete when both run at once
+			auto startedCount = std::atomic<int>(0);
+			auto overlapped = std::atomic<int>(0);
+			uut.Execute(
+				[](int) {},
+				[&startedCount, &overlapped](int)
+				{
+					startedCount++;
+					auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+					while (startedCount < 2 && std::chrono::steady_clock::now() < timeout)
+						std::this_thread::yield();
+
+					if (startedCount == 2)
+						overlapped++;
+				});
+
+			Assert::AreEqual(2, overlapped.load(), "Verify both packages were building at the same time.");
+		}
+
+		[[Fact]]
+		void Execute_Failure_SkipsDependents()
+		{
+			auto uut = PackageBuildScheduler(1);
+			uut.AddPackage(1, {});
+			uut.AddPackage(2, { 1 });
+
+			auto built = std::vector<int>();
+			Assert::ThrowsRuntimeError([&uut, &built]() {
+				uut.Execute(
+					[](int) {},
+					[&built](int id)
+					{
+						built.push_back(id);
+						if (id == 1)
+							throw std::runtime_error("Build failed.");
+					});
+			});
+
+			Assert::AreEqual(
+				std::vector<int>({ 1 }),
+				built,
+				"Verify the dependent package was not built.");
+		}
+
+		[[Fact]]
+		void Execute_Cycle_Throws()
+		{
+			auto uut = PackageBuildScheduler(1);
+			uut.AddPackage(1, { 2 });
+			uut.AddPackage(2, { 1 });
+
+			Assert::ThrowsRuntimeError([&uut]() {
+				uut.Execute(
+					[](int) {},
+					[](int) {});
+			});
+		}
+	};
+}
@@ -0,0 +1,201 @@
+// <copyright file="PackageGraphTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PackageGraphTests
+	{
+	public:
+		[[Fact]]
+		void Initialize()
+		{
+			auto uut = PackageGraph();
+
+			Assert::AreEqual(0, uut.GetRootId(), "Verify root id matches expected.");
+			Assert::IsTrue(uut.GetPackages().empty(), "Verify there are no packages.");
+		}
+
+		[[Fact]]
+		void Load_SharedDependency_LoadedOnce()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Workspace/Left/Recipe.toml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name = "Left"
+					Version = "1.2.3"
+					Dependencies = [
+						"../Shared/",
+					]
+				)")));
+
+			fileSystem->CreateMockFile(
+				Path("C:/Workspace/Right/Recipe.toml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name = "Right"
+					Version = "1.2.3"
+					Dependencies = [
+						"../Shared/",
+					]
+				)")));
+
+			fileSystem->CreateMockFile(
+				Path("C:/Workspace/Shared/Recipe.toml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name = "Shared"
+					Version = "1.2.3"
+				)")));
+
+			auto recipe = Recipe("Root", SemanticVersion(1, 2, 3));
+			recipe.SetDependencies({
+				PackageReference(Path("../Left/")),
+				PackageReference(Path("../Right/")),
+			});
+
+			auto recipeCache = RecipeCache(false);
+			auto uut = PackageGraph::Load(
+				Path("C:/Workspace/Root/"),
+				recipe,
+				recipeCache,
+				[](const Path& workingDirectory, const PackageReference& reference)
+				{
+					return RecipeExtensions::GetPackageReferencePath(workingDirectory, reference);
+				});
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Load Recipe: C:/Workspace/Left/Recipe.toml",
+					"DIAG: Load Recipe: C:/Workspace/Shared/Recipe.toml",
+					"DIAG: Load Recipe: C:/Workspace/Right/Recipe.toml",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify each package is ordered after its dependencies
+			int sharedId = 0;
+			int leftId = 0;
+			int rightId = 0;
+			int rootId = 0;
+			Assert::IsTrue(uut.TryFindPackage("Shared", sharedId), "Verify shared package found.");
+			Assert::IsTrue(uut.TryFindPackage("Left", leftId), "Verify left package found.");
+			Assert::IsTrue(uut.TryFindPackage("Right", rightId), "Verify right package found.");
+			Assert::IsTrue(uut.TryFindPackage("Root", rootId), "Verify root package found.");
+			Assert::AreEqual(1, sharedId, "Verify shared id matches expected.");
+			Assert::AreEqual(2, leftId, "Verify left id matches expected.");
+			Assert::AreEqual(3, rightId, "Verify right id matches expected.");
+			Assert::AreEqual(4, rootId, "Verify root id matches expected.");
+			Assert::AreEqual(rootId, uut.GetRootId(), "Verify root id matches expected.");
+
+			Assert::AreEqual(
+				std::vector<int>({ 2, 3 }),
+				uut.GetPackage(rootId).Dependencies,
+				"Verify root dependencies match expected.");
+			Assert::AreEqual(
+				std::vector<int>({ 1 }),
+				uut.GetPackage(rightId).Dependencies,
+				"Verify right dependencies match expected.");
+			Assert::AreEqual(
+				Path("C:/Workspace/Shared/"),
+				uut.GetPackage(sharedId).WorkingDirectory,
+				"Verify shared directory matches expected.");
+		}
+
+		[[Fact]]
+		void Load_DevDependency_SystemBuild()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Workspace/Extension/Recipe.toml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name = "Extension"
+					Version = "1.2.3"
+				)")));
+
+			auto recipe = Recipe("Root", SemanticVersion(1, 2, 3));
+			recipe.SetDevDependencies({
+				PackageReference(Path("../Extension/")),
+			});
+
+			auto recipeCache = RecipeCache(false);
+			auto uut = PackageGraph::Load(
+				Path("C:/Workspace/Root/"),
+				recipe,
+				recipeCache,
+				[](const Path& workingDirectory, const PackageReference& reference)
+				{
+					return RecipeExtensions::GetPackageReferencePath(workingDirectory, reference);
+				});
+
+			Assert::AreEqual(
+				std::vector<int>({ 1 }),
+				uut.GetPackage(uut.GetRootId()).DevDependencies,
+				"Verify root dev dependencies match expected.");
+			Assert::IsTrue(uut.GetPackage(1).IsSystemBuild, "Verify extension is a system build.");
+			Assert::IsFalse(uut.GetPackage(uut.GetRootId()).IsSystemBuild, "Verify root is not a system build.");
+		}
+
+		[[Fact]]
+		void Load_CircularDependency_Throws()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Workspace/Child/Recipe.toml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name = "Child"
+					Version = "1.2.3"
+					Dependencies = [
+						"../Root/",
+					]
+				)")));
+
+			fileSystem->CreateMockFile(
+				Path("C:/Workspace/Root/Recipe.toml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name = "Root"
+					Version = "1.2.3"
+				)")));
+
+			auto recipe = Recipe("Root", SemanticVersion(1, 2, 3));
+			recipe.SetDependencies({
+				PackageReference(Path("../Child/")),
+			});
+
+			auto recipeCache = RecipeCache(false);
+			Assert::ThrowsRuntimeError([&recipe, &recipeCache]() {
+				PackageGraph::Load(
+					Path("C:/Workspace/Root/"),
+					recipe,
+					recipeCache,
+					[](const Path& workingDirectory, const PackageReference& reference)
+					{
+						return RecipeExtensions::GetPackageReferencePath(workingDirectory, reference);
+					});
+			});
+		}
+	};
+}
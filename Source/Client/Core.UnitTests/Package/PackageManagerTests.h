@@ -121,10 +121,13 @@ namespace Soup::UnitTests
 					"Exists: Recipe.toml",
 					"OpenReadBinary: Recipe.toml",
 					"Exists: ../MyProject1/Recipe.toml",
+					"GetLastWriteTime: ../MyProject1/Recipe.toml",
 					"OpenReadBinary: ../MyProject1/Recipe.toml",
 					"Exists: ../../MyProject2/Recipe.toml",
+					"GetLastWriteTime: ../../MyProject2/Recipe.toml",
 					"OpenReadBinary: ../../MyProject2/Recipe.toml",
 					"Exists: ../../MyProject3/Recipe.toml",
+					"GetLastWriteTime: ../../MyProject3/Recipe.toml",
 					"OpenReadBinary: ../../MyProject3/Recipe.toml",
 					"DeleteDirectoryRecursive: C:/Users/Me/.soup/packages/.staging",
 				}),
@@ -211,6 +214,7 @@ namespace Soup::UnitTests
 					"OpenWriteBinary: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
 					"SetLastWriteTime: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
 					"Exists: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"GetLastWriteTime: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
 					"OpenReadBinary: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
 					"Exists: C:/Users/Me/.soup/packages/TheirPackage",
 					"CreateDirectory: C:/Users/Me/.soup/packages/TheirPackage",
@@ -235,6 +239,138 @@ namespace Soup::UnitTests
 				"Verify http requests match expected.");
 		}
 
+		[[Fact]]
+		void InstallPackages_TransitiveDependency_MovesDependencyFirst()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Register the test listener
+			auto testNetworkManager = std::make_shared<Network::MockNetworkManager>();
+			auto scopedNetworkManager = Network::ScopedNetworkManagerRegister(testNetworkManager);
+
+			// Create the Recipe
+			fileSystem->CreateMockFile(
+				Path("Recipe.toml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name = "MyPackage"
+					Version = "1.2.3"
+					Dependencies = [
+						"TheirPackage@2.2.2",
+					]
+				)")));
+
+			// Create the required http client
+			auto testHttpClient = std::make_shared<Network::MockHttpClient>(
+				"api.soupbuild.com",
+				443);
+			testNetworkManager->RegisterClient(testHttpClient);
+
+			// Setup the expected http requests
+			auto packageOneContentResponse = Network::HttpResponse(
+				Network::HttpStatusCode::Ok,
+				GetTheirPackageWithDependencyArchive());
+			testHttpClient->AddGetResponse("/v1/packages/TheirPackage/v2.2.2/download", packageOneContentResponse);
+
+			auto packageTwoContentResponse = Network::HttpResponse(
+				Network::HttpStatusCode::Ok,
+				GetMyDependencyArchive());
+			testHttpClient->AddGetResponse("/v1/packages/MyDependency/v1.0.0/download", packageTwoContentResponse);
+
+			PackageManager::InstallPackages();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Using Package Store: C:/Users/Me/.soup/packages/",
+					"DIAG: Load Recipe: Recipe.toml",
+					"HIGH: Install Package: TheirPackage@2.2.2",
+					"HIGH: Downloading package",
+					"DIAG: /v1/packages/TheirPackage/v2.2.2/download",
+					"INFO: ExtractStart: 86",
+					"INFO: ExtractProgress: 0",
+					"INFO: ExtractProgress: 0",
+					"INFO: ExtractProgress: 0",
+					"INFO: ExtractProgress: 86",
+					"INFO: ExtractGetStream: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"INFO: ExtractOnOperationStart",
+					"INFO: ExtractOperationCompleted",
+					"INFO: ExtractProgress: 86",
+					"INFO: ExtractDone",
+					"DIAG: Load Recipe: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"HIGH: Install Package: MyDependency@1.0.0",
+					"HIGH: Downloading package",
+					"DIAG: /v1/packages/MyDependency/v1.0.0/download",
+					"INFO: ExtractStart: 42",
+					"INFO: ExtractProgress: 0",
+					"INFO: ExtractProgress: 0",
+					"INFO: ExtractProgress: 0",
+					"INFO: ExtractProgress: 42",
+					"INFO: ExtractGetStream: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"INFO: ExtractOnOperationStart",
+					"INFO: ExtractOperationCompleted",
+					"INFO: ExtractProgress: 42",
+					"INFO: ExtractDone",
+					"DIAG: Load Recipe: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"INFO: Deleting staging directory",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify the transitive dependency lands in the store before the package that references it
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentDirectory",
+					"Exists: C:/Users/Me/.soup/packages/.staging",
+					"CreateDirectory: C:/Users/Me/.soup/packages/.staging",
+					"Exists: Recipe.toml",
+					"OpenReadBinary: Recipe.toml",
+					"Exists: C:/Users/Me/.soup/packages/TheirPackage/2.2.2",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/.staging/TheirPackage.7z",
+					"CreateDirectory: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2",
+					"OpenReadBinary: C:/Users/Me/.soup/packages/.staging/TheirPackage.7z",
+					"Exists: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"SetLastWriteTime: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"Exists: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"GetLastWriteTime: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"OpenReadBinary: C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2/Recipe.toml",
+					"Exists: C:/Users/Me/.soup/packages/MyDependency/1.0.0",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/.staging/MyDependency.7z",
+					"CreateDirectory: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0",
+					"OpenReadBinary: C:/Users/Me/.soup/packages/.staging/MyDependency.7z",
+					"Exists: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"SetLastWriteTime: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"Exists: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"GetLastWriteTime: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"OpenReadBinary: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"Exists: C:/Users/Me/.soup/packages/MyDependency",
+					"CreateDirectory: C:/Users/Me/.soup/packages/MyDependency",
+					"Rename: [C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0] -> [C:/Users/Me/.soup/packages/MyDependency/1.0.0]",
+					"Exists: C:/Users/Me/.soup/packages/TheirPackage",
+					"CreateDirectory: C:/Users/Me/.soup/packages/TheirPackage",
+					"Rename: [C:/Users/Me/.soup/packages/.staging/TheirPackage/2.2.2] -> [C:/Users/Me/.soup/packages/TheirPackage/2.2.2]",
+					"DeleteDirectoryRecursive: C:/Users/Me/.soup/packages/.staging",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Get: /v1/packages/TheirPackage/v2.2.2/download",
+					"Get: /v1/packages/MyDependency/v1.0.0/download",
+				}),
+				testHttpClient->GetRequests(),
+				"Verify http requests match expected.");
+		}
+
 		[[Fact]]
 		void InstallPackageReference_MissingRecipe_Throws()
 		{
@@ -488,6 +624,7 @@ Dependencies = [
 					"OpenWriteBinary: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
 					"SetLastWriteTime: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
 					"Exists: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
+					"GetLastWriteTime: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
 					"OpenReadBinary: C:/Users/Me/.soup/packages/.staging/MyDependency/1.0.0/Recipe.toml",
 					"Exists: C:/Users/Me/.soup/packages/MyDependency",
 					"CreateDirectory: C:/Users/Me/.soup/packages/MyDependency",
@@ -0,0 +1,98 @@
+// <copyright file="RecipeBinaryTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::UnitTests
+{
+	class RecipeBinaryTests
+	{
+	public:
+		[[Fact]]
+		void TryDeserialize_GarbageThrows()
+		{
+			auto binary = std::stringstream("BRCP");
+			Recipe actual = {};
+			Assert::ThrowsRuntimeError([&binary, &actual]() {
+				RecipeBinary::TryDeserialize(binary, 1234, actual);
+			});
+		}
+
+		[[Fact]]
+		void TryDeserialize_InvalidFileType()
+		{
+			auto binary = std::stringstream("TOML");
+			Recipe actual = {};
+			auto result = RecipeBinary::TryDeserialize(binary, 1234, actual);
+
+			Assert::IsFalse(result, "Verify the snapshot was rejected.");
+		}
+
+		[[Fact]]
+		void TryDeserialize_ChangedContent()
+		{
+			auto recipe = Recipe(
+				"MyPackage",
+				SemanticVersion(1, 2, 3));
+			auto binary = std::stringstream();
+			RecipeBinary::Serialize(recipe, 1234, binary);
+
+			Recipe actual = {};
+			auto result = RecipeBinary::TryDeserialize(binary, 5678, actual);
+
+			Assert::IsFalse(result, "Verify the snapshot was rejected.");
+		}
+
+		[[Fact]]
+		void TryDeserialize_PreviousVersion()
+		{
+			// Version 1 snapshots only stored the recipe write time
+			auto binary = std::stringstream();
+			binary.write("BRCP", 4);
+			uint32_t version = 1;
+			binary.write(reinterpret_cast<const char*>(&version), sizeof(version));
+			int64_t lastWriteTime = 1234;
+			binary.write(reinterpret_cast<const char*>(&lastWriteTime), sizeof(lastWriteTime));
+
+			Recipe actual = {};
+			auto result = RecipeBinary::TryDeserialize(binary, 1234, actual);
+
+			Assert::IsFalse(result, "Verify the snapshot was rejected.");
+		}
+
+		[[Fact]]
+		void RoundTrip_AllProperties()
+		{
+			auto expected = Recipe(
+				"MyPackage",
+				SemanticVersion(1, 2, 3),
+				Build::Extensions::RecipeType::Executable,
+				Build::Extensions::RecipeLanguageVersion::CPP17,
+				std::vector<PackageReference>({
+					PackageReference(Path("../Dependency/")),
+				}),
+				std::vector<PackageReference>({
+					PackageReference("Extension", SemanticVersion(2, 0, 0)),
+				}),
+				"Public.cpp",
+				std::vector<std::string>({
+					"Source.cpp",
+				}),
+				std::vector<std::string>({
+					"Include/",
+				}),
+				std::vector<std::string>({
+					"DEBUG",
+				}));
+			auto binary = std::stringstream();
+			RecipeBinary::Serialize(expected, 1234, binary);
+
+			Recipe actual = {};
+			auto result = RecipeBinary::TryDeserialize(binary, 1234, actual);
+
+			Assert::IsTrue(result, "Verify the snapshot was loaded.");
+			Assert::AreEqual(expected, actual, "Verify matches expected.");
+		}
+	};
+}
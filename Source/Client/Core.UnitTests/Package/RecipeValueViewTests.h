@@ -0,0 +1,122 @@
+// <copyright file="RecipeValueViewTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime::UnitTests
+{
+	class RecipeValueViewTests
+	{
+	public:
+		[[Fact]]
+		void Initialize()
+		{
+			auto recipe = Recipe();
+			auto uut = RecipeValueView(recipe.GetTable());
+
+			uint64_t type = 0;
+			Assert::AreEqual<OperationResult>(0, uut.TryGetType(type), "Verify get type succeeded.");
+			Assert::AreEqual(static_cast<uint64_t>(ValueType::Table), type, "Verify the root is a table.");
+		}
+
+		[[Fact]]
+		void TryGetAsString_SharesRecipeString()
+		{
+			auto recipe = Recipe();
+			recipe.SetName("MyPackage");
+			auto uut = RecipeValueView(recipe.GetTable());
+
+			IValueTable* table = nullptr;
+			Assert::AreEqual<OperationResult>(0, uut.TryGetAsTable(table), "Verify get table succeeded.");
+			IValue* nameValue = nullptr;
+			Assert::AreEqual<OperationResult>(0, table->TryGetValue("Name", nameValue), "Verify get name succeeded.");
+			IValuePrimitive<const char*>* name = nullptr;
+			Assert::AreEqual<OperationResult>(0, nameValue->TryGetAsString(name), "Verify get string succeeded.");
+			const char* nameString = nullptr;
+			Assert::AreEqual<OperationResult>(0, name->TryGetValue(nameString), "Verify get value succeeded.");
+
+			Assert::IsTrue(
+				recipe.GetNameValue().AsString().c_str() == nameString,
+				"Verify the string is read from the recipe.");
+		}
+
+		[[Fact]]
+		void TrySetValue_DoesNotModifyRecipe()
+		{
+			auto recipe = Recipe();
+			recipe.SetName("MyPackage");
+			auto uut = RecipeValueView(recipe.GetTable());
+
+			IValueTable* table = nullptr;
+			uut.TryGetAsTable(table);
+			IValue* nameValue = nullptr;
+			table->TryGetValue("Name", nameValue);
+			IValuePrimitive<const char*>* name = nullptr;
+			nameValue->TryGetAsString(name);
+			Assert::AreEqual<OperationResult>(0, name->TrySetValue("Other"), "Verify set value succeeded.");
+
+			const char* nameString = nullptr;
+			name->TryGetValue(nameString);
+			Assert::AreEqual(std::string("Other"), std::string(nameString), "Verify the view was updated.");
+			Assert::AreEqual(std::string("MyPackage"), recipe.GetName(), "Verify the recipe was not modified.");
+
+			// Changing the type stops using the recipe value
+			Assert::AreEqual<OperationResult>(
+				0,
+				nameValue->TrySetType(static_cast<uint64_t>(ValueType::Integer)),
+				"Verify set type succeeded.");
+			uint64_t type = 0;
+			nameValue->TryGetType(type);
+			Assert::AreEqual(static_cast<uint64_t>(ValueType::Integer), type, "Verify the type changed.");
+			Assert::AreEqual(std::string("MyPackage"), recipe.GetName(), "Verify the recipe was not modified.");
+		}
+
+		[[Fact]]
+		void TryCreateValue_KeepsNewValuesOutOfRecipe()
+		{
+			auto recipe = Recipe();
+			recipe.SetName("MyPackage");
+			auto uut = RecipeValueView(recipe.GetTable());
+
+			IValueTable* table = nullptr;
+			uut.TryGetAsTable(table);
+			IValue* value = nullptr;
+			Assert::AreEqual<OperationResult>(-1, table->TryCreateValue("Name", value), "Verify create existing value failed.");
+			Assert::AreEqual<OperationResult>(0, table->TryCreateValue("NewValue", value), "Verify create new value succeeded.");
+
+			bool hasValue = false;
+			table->TryCheckHasValue("NewValue", hasValue);
+			Assert::IsTrue(hasValue, "Verify the view has the new value.");
+			Assert::IsFalse(recipe.GetTable().contains("NewValue"), "Verify the recipe was not modified.");
+		}
+
+		[[Fact]]
+		void TryGetStringValues_ReadsRecipeList()
+		{
+			auto recipe = Recipe();
+			recipe.SetSource({ "File1.cpp", "File2.cpp" });
+			auto uut = RecipeValueView(recipe.GetTable());
+
+			IValueTable* table = nullptr;
+			uut.TryGetAsTable(table);
+			IValue* sourceValue = nullptr;
+			table->TryGetValue("Source", sourceValue);
+			IValueList* sourceList = nullptr;
+			Assert::AreEqual<OperationResult>(0, sourceValue->TryGetAsList(sourceList), "Verify get list succeeded.");
+			auto source = static_cast<IValueList2*>(sourceList);
+
+			const char* append[] = { "File3.cpp" };
+			uint64_t appendLengths[] = { 9 };
+			Assert::AreEqual<OperationResult>(0, source->TryAppendStringValues(1, append, appendLengths), "Verify append succeeded.");
+			Assert::AreEqual<uint64_t>(3, source->GetSize(), "Verify the list size.");
+
+			auto values = std::vector<const char*>(3);
+			Assert::AreEqual<OperationResult>(0, source->TryGetStringValues(0, 3, values.data()), "Verify get values succeeded.");
+			Assert::AreEqual(std::string("File1.cpp"), std::string(values[0]), "Verify the first value.");
+			Assert::AreEqual(std::string("File2.cpp"), std::string(values[1]), "Verify the second value.");
+			Assert::AreEqual(std::string("File3.cpp"), std::string(values[2]), "Verify the appended value.");
+			Assert::AreEqual<size_t>(2, recipe.GetSource().size(), "Verify the recipe was not modified.");
+		}
+	};
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "Build/Runner/BuildExecutionPlanTests.h"
+
+TestState RunBuildExecutionPlanTests() 
+ {
+	auto className = "BuildExecutionPlanTests";
+	auto testClass = std::make_shared<Soup::Build::UnitTests::BuildExecutionPlanTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Compile_SharedChild", [&testClass]() { testClass->Compile_SharedChild(); });
+	state += SoupTest::RunTest(className, "Compile_LinkedEdge_AfterChildren", [&testClass]() { testClass->Compile_LinkedEdge_AfterChildren(); });
+	state += SoupTest::RunTest(className, "Compile_Cycle_Throws", [&testClass]() { testClass->Compile_Cycle_Throws(); });
+	state += SoupTest::RunTest(className, "Deduplicate_MergesIdenticalNodes", [&testClass]() { testClass->Deduplicate_MergesIdenticalNodes(); });
+	state += SoupTest::RunTest(className, "Deduplicate_ConflictingProducers_Throws", [&testClass]() { testClass->Deduplicate_ConflictingProducers_Throws(); });
+
+	return state;
+}
\ No newline at end of file
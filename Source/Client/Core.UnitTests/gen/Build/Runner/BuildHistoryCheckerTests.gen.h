@@ -10,6 +10,7 @@ TestState RunBuildHistoryCheckerTests()
 	state += SoupTest::RunTest(className, "IsOutdated_SingleInput_MissingTarget", [&testClass]() { testClass->IsOutdated_SingleInput_MissingTarget(); });
 	state += SoupTest::RunTest(className, "IsOutdated_SingleInput_TargetExists_MissingInputFile", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_MissingInputFile(); });
 	state += SoupTest::RunTest(className, "IsOutdated_SingleInput_TargetExists_Outdated", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_Outdated(); });
+	state += SoupTest::RunTest(className, "IsOutdated_SingleInput_TargetExists_Outdated_Explanation", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_Outdated_Explanation(); });
 	state += SoupTest::RunTest(className, "IsOutdated_SingleInput_TargetExists_UpToDate", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_UpToDate(); });
 	state += SoupTest::RunTest(className, "IsOutdated_MultipleInputs_RelativeAndAbsolute", [&testClass]() { testClass->IsOutdated_MultipleInputs_RelativeAndAbsolute(); });
 
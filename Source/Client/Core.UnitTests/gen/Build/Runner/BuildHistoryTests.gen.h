@@ -11,6 +11,8 @@ TestState RunBuildHistoryTests()
 	state += SoupTest::RunTest(className, "TryBuildIncludeClosure_NoDependencies", [&testClass]() { testClass->TryBuildIncludeClosure_NoDependencies(); });
 	state += SoupTest::RunTest(className, "TryBuildIncludeClosure_MultipleDependencies", [&testClass]() { testClass->TryBuildIncludeClosure_MultipleDependencies(); });
 	state += SoupTest::RunTest(className, "TryBuildIncludeClosure_CircularDependencies", [&testClass]() { testClass->TryBuildIncludeClosure_CircularDependencies(); });
+	state += SoupTest::RunTest(className, "TryFindSourceFile_UnityBuildRoundTrip", [&testClass]() { testClass->TryFindSourceFile_UnityBuildRoundTrip(); });
+	state += SoupTest::RunTest(className, "TryFindSourceFile_MissingFails", [&testClass]() { testClass->TryFindSourceFile_MissingFails(); });
 
 	return state;
 }
\ No newline at end of file
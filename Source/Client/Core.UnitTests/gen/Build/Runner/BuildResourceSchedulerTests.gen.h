@@ -0,0 +1,23 @@
+#pragma once
+#include "Build/Runner/BuildResourceSchedulerTests.h"
+
+TestState RunBuildResourceSchedulerTests() 
+{
+	auto className = "BuildResourceSchedulerTests";
+	auto testClass = std::make_shared<Soup::Build::UnitTests::BuildResourceSchedulerTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += SoupTest::RunTest(className, "TryAcquire_MaxParallelism", [&testClass]() { testClass->TryAcquire_MaxParallelism(); });
+	state += SoupTest::RunTest(className, "TryAcquire_ClassLimit", [&testClass]() { testClass->TryAcquire_ClassLimit(); });
+	state += SoupTest::RunTest(className, "TryAcquire_MemoryBudget", [&testClass]() { testClass->TryAcquire_MemoryBudget(); });
+	state += SoupTest::RunTest(className, "TryAcquire_OverBudget_AdmittedWhenIdle", [&testClass]() { testClass->TryAcquire_OverBudget_AdmittedWhenIdle(); });
+	state += SoupTest::RunTest(className, "Release_NotAcquired_Throws", [&testClass]() { testClass->Release_NotAcquired_Throws(); });
+	state += SoupTest::RunTest(className, "TryAcquire_MemoryPressure", [&testClass]() { testClass->TryAcquire_MemoryPressure(); });
+	state += SoupTest::RunTest(className, "TryAcquire_MemoryPressure_Unavailable", [&testClass]() { testClass->TryAcquire_MemoryPressure_Unavailable(); });
+	state += SoupTest::RunTest(className, "TryAcquire_JobServer", [&testClass]() { testClass->TryAcquire_JobServer(); });
+	state += SoupTest::RunTest(className, "TryAcquire_ThreadCount", [&testClass]() { testClass->TryAcquire_ThreadCount(); });
+	state += SoupTest::RunTest(className, "TryAcquire_ThreadCount_JobServer", [&testClass]() { testClass->TryAcquire_ThreadCount_JobServer(); });
+	state += SoupTest::RunTest(className, "TryParsePressure", [&testClass]() { testClass->TryParsePressure(); });
+
+	return state;
+}
@@ -15,6 +15,12 @@ TestState RunBuildRunnerTests()
 	state += SoupTest::RunTest(className, "Execute_OneNode_Incremental_MissingTargetFile", [&testClass]() { testClass->Execute_OneNode_Incremental_MissingTargetFile(); });
 	state += SoupTest::RunTest(className, "Execute_OneNode_Incremental_OutOfDate", [&testClass]() { testClass->Execute_OneNode_Incremental_OutOfDate(); });
 	state += SoupTest::RunTest(className, "Execute_OneNode_Incremental_UpToDate", [&testClass]() { testClass->Execute_OneNode_Incremental_UpToDate(); });
+	state += SoupTest::RunTest(className, "Execute_TwoPackages_ConsumerWaitsForProducer", [&testClass]() { testClass->Execute_TwoPackages_ConsumerWaitsForProducer(); });
+	state += SoupTest::RunTest(className, "Execute_BatchCompile_AttributesIncludes", [&testClass]() { testClass->Execute_BatchCompile_AttributesIncludes(); });
+	state += SoupTest::RunTest(className, "Execute_BatchCompile_DuplicateFileName_NotAttributed", [&testClass]() { testClass->Execute_BatchCompile_DuplicateFileName_NotAttributed(); });
+	state += SoupTest::RunTest(className, "Execute_Parallel_CompletesOutOfOrder", [&testClass]() { testClass->Execute_Parallel_CompletesOutOfOrder(); });
+	state += SoupTest::RunTest(className, "Execute_Parallel_FailureJoinsRunningJobs", [&testClass]() { testClass->Execute_Parallel_FailureJoinsRunningJobs(); });
+	state += SoupTest::RunTest(className, "Execute_Explain_SharedLogAcrossRunners", [&testClass]() { testClass->Execute_Explain_SharedLogAcrossRunners(); });
 
 	return state;
 }
\ No newline at end of file
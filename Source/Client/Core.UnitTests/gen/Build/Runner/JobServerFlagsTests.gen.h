@@ -0,0 +1,22 @@
+#pragma once
+#include "Build/Runner/JobServerFlagsTests.h"
+
+TestState RunJobServerFlagsTests() 
+{
+	auto className = "JobServerFlagsTests";
+	auto testClass = std::make_shared<Soup::Build::UnitTests::JobServerFlagsTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "TryParse_Empty", [&testClass]() { testClass->TryParse_Empty(); });
+	state += SoupTest::RunTest(className, "TryParse_NoJobServer", [&testClass]() { testClass->TryParse_NoJobServer(); });
+	state += SoupTest::RunTest(className, "TryParse_Fifo", [&testClass]() { testClass->TryParse_Fifo(); });
+	state += SoupTest::RunTest(className, "TryParse_Pipe", [&testClass]() { testClass->TryParse_Pipe(); });
+	state += SoupTest::RunTest(className, "TryParse_LegacyPipe", [&testClass]() { testClass->TryParse_LegacyPipe(); });
+	state += SoupTest::RunTest(className, "TryParse_ClosedPipe", [&testClass]() { testClass->TryParse_ClosedPipe(); });
+	state += SoupTest::RunTest(className, "TryParse_Semaphore", [&testClass]() { testClass->TryParse_Semaphore(); });
+	state += SoupTest::RunTest(className, "Format_Fifo", [&testClass]() { testClass->Format_Fifo(); });
+	state += SoupTest::RunTest(className, "Format_RoundTrip", [&testClass]() { testClass->Format_RoundTrip(); });
+	state += SoupTest::RunTest(className, "Merge_Empty", [&testClass]() { testClass->Merge_Empty(); });
+	state += SoupTest::RunTest(className, "Merge_KeepsExistingFlags", [&testClass]() { testClass->Merge_KeepsExistingFlags(); });
+
+	return state;
+}
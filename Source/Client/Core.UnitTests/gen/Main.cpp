@@ -1,15 +1,23 @@
+#include <algorithm>
 #include <any>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 import Opal;
 import Opal.Extensions;
+import Soup.Build;
+import Soup.Build.Runtime;
 import SoupCore;
 import json11;
 import SoupTest;
@@ -22,24 +30,33 @@ using namespace SoupTest;
 #include "Api/SoupApiTests.gen.h"
 #include "Api/SoupApiJsonModelsTests.gen.h"
 
+#include "Build/Runner/BuildExecutionPlanTests.gen.h"
 #include "Build/Runner/BuildHistoryCheckerTests.gen.h"
 #include "Build/Runner/BuildHistoryJsonTests.gen.h"
 #include "Build/Runner/BuildHistoryTests.gen.h"
 #include "Build/Runner/BuildHistoryManagerTests.gen.h"
+#include "Build/Runner/BuildResourceSchedulerTests.gen.h"
 #include "Build/Runner/BuildRunnerTests.gen.h"
+#include "Build/Runner/JobServerFlagsTests.gen.h"
 
 #include "Config/LocalUserConfigExtensionsTests.gen.h"
 #include "Config/LocalUserConfigJsonTests.gen.h"
 #include "Config/LocalUserConfigTests.gen.h"
 
+#include "Package/BuildExtensionRegistryTests.gen.h"
+#include "Package/ExtensionFingerprintTests.gen.h"
+#include "Package/PackageBuildSchedulerTests.gen.h"
+#include "Package/PackageGraphTests.gen.h"
 #include "Package/PackageManagerTests.gen.h"
 #include "Package/PackageReferenceTests.gen.h"
+#include "Package/RecipeBinaryTests.gen.h"
 #include "Package/RecipeBuilderTests.gen.h"
 #include "Package/RecipeBuildManagerTests.gen.h"
 #include "Package/RecipeExtensionsTests.gen.h"
 #include "Package/RecipeJsonTests.gen.h"
 #include "Package/RecipeTests.gen.h"
 #include "Package/RecipeTomlTests.gen.h"
+#include "Package/RecipeValueViewTests.gen.h"
 
 #include "Utils/PathTests.gen.h"
 #include "Utils/SemanticVersionTests.gen.h"
@@ -53,24 +70,33 @@ int main()
 	state += RunSoupApiTests();
 	state += RunSoupApiJsonModelsTests();
 
+	state += RunBuildExecutionPlanTests();
 	state += RunBuildHistoryCheckerTests();
 	state += RunBuildHistoryJsonTests();
 	state += RunBuildHistoryTests();
 	state += RunBuildHistoryManagerTests();
+	state += RunBuildResourceSchedulerTests();
 	state += RunBuildRunnerTests();
+	state += RunJobServerFlagsTests();
 
 	state += RunLocalUserConfigExtensionsTests();
 	state += RunLocalUserConfigJsonTests();
 	state += RunLocalUserConfigTests();
 
+	state += RunBuildExtensionRegistryTests();
+	state += RunExtensionFingerprintTests();
+	state += RunPackageBuildSchedulerTests();
+	state += RunPackageGraphTests();
 	state += RunPackageManagerTests();
 	state += RunPackageReferenceTests();
+	state += RunRecipeBinaryTests();
 	state += RunRecipeBuilderTests();
 	state += RunRecipeBuildManagerTests();
 	state += RunRecipeExtensionsTests();
 	state += RunRecipeJsonTests();
 	state += RunRecipeTests();
 	state += RunRecipeTomlTests();
+	state += RunRecipeValueViewTests();
 
 	state += RunPathTests();
 	state += RunSemanticVersionTests();
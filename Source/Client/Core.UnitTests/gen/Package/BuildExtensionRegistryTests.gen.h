@@ -0,0 +1,15 @@
+#pragma once
+#include "Package/BuildExtensionRegistryTests.h"
+
+TestState RunBuildExtensionRegistryTests() 
+ {
+	auto className = "BuildExtensionRegistryTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::BuildExtensionRegistryTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "GetRegisterFunction_CacheHit", [&testClass]() { testClass->GetRegisterFunction_CacheHit(); });
+	state += SoupTest::RunTest(className, "GetRegisterFunction_UnchangedContent", [&testClass]() { testClass->GetRegisterFunction_UnchangedContent(); });
+	state += SoupTest::RunTest(className, "GetRegisterFunction_ChangedContent", [&testClass]() { testClass->GetRegisterFunction_ChangedContent(); });
+	state += SoupTest::RunTest(className, "IsContentCopy", [&testClass]() { testClass->IsContentCopy(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include "Package/ExtensionFingerprintTests.h"
+
+TestState RunExtensionFingerprintTests() 
+ {
+	auto className = "ExtensionFingerprintTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::ExtensionFingerprintTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "TryLoad_MissingFile", [&testClass]() { testClass->TryLoad_MissingFile(); });
+	state += SoupTest::RunTest(className, "TryLoad_SavedFingerprint", [&testClass]() { testClass->TryLoad_SavedFingerprint(); });
+	state += SoupTest::RunTest(className, "Compute_ChangesWithCompilerAndDependencies", [&testClass]() { testClass->Compute_ChangesWithCompilerAndDependencies(); });
+	state += SoupTest::RunTest(className, "Compute_ChangesWithIncludedHeader", [&testClass]() { testClass->Compute_ChangesWithIncludedHeader(); });
+
+	return state;
+}
\ No newline at end of file
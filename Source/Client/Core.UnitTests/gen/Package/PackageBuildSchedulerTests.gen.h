@@ -0,0 +1,16 @@
+#pragma once
+#include "Package/PackageBuildSchedulerTests.h"
+
+TestState RunPackageBuildSchedulerTests() 
+{
+	auto className = "PackageBuildSchedulerTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::PackageBuildSchedulerTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += SoupTest::RunTest(className, "Execute_SingleJob_DependencyOrder", [&testClass]() { testClass->Execute_SingleJob_DependencyOrder(); });
+	state += SoupTest::RunTest(className, "Execute_IndependentPackagesRunConcurrently", [&testClass]() { testClass->Execute_IndependentPackagesRunConcurrently(); });
+	state += SoupTest::RunTest(className, "Execute_Failure_SkipsDependents", [&testClass]() { testClass->Execute_Failure_SkipsDependents(); });
+	state += SoupTest::RunTest(className, "Execute_Cycle_Throws", [&testClass]() { testClass->Execute_Cycle_Throws(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include "Package/PackageGraphTests.h"
+
+TestState RunPackageGraphTests() 
+ {
+	auto className = "PackageGraphTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PackageGraphTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += SoupTest::RunTest(className, "Load_SharedDependency_LoadedOnce", [&testClass]() { testClass->Load_SharedDependency_LoadedOnce(); });
+	state += SoupTest::RunTest(className, "Load_DevDependency_SystemBuild", [&testClass]() { testClass->Load_DevDependency_SystemBuild(); });
+	state += SoupTest::RunTest(className, "Load_CircularDependency_Throws", [&testClass]() { testClass->Load_CircularDependency_Throws(); });
+
+	return state;
+}
\ No newline at end of file
@@ -9,6 +9,7 @@ TestState RunPackageManagerTests()
 	state += SoupTest::RunTest(className, "InstallPackages_NoDependencies_Success", [&testClass]() { testClass->InstallPackages_NoDependencies_Success(); });
 	state += SoupTest::RunTest(className, "InstallPackages_OnlyLocalDependencies_Success", [&testClass]() { testClass->InstallPackages_OnlyLocalDependencies_Success(); });
 	state += SoupTest::RunTest(className, "InstallPackages_SingleDependency_Success", [&testClass]() { testClass->InstallPackages_SingleDependency_Success(); });
+	state += SoupTest::RunTest(className, "InstallPackages_TransitiveDependency_MovesDependencyFirst", [&testClass]() { testClass->InstallPackages_TransitiveDependency_MovesDependencyFirst(); });
 	state += SoupTest::RunTest(className, "InstallPackageReference_MissingRecipe_Throws", [&testClass]() { testClass->InstallPackageReference_MissingRecipe_Throws(); });
 	state += SoupTest::RunTest(className, "InstallPackageReference_Version_Success", [&testClass]() { testClass->InstallPackageReference_Version_Success(); });
 	state += SoupTest::RunTest(className, "InstallPackageReference_Recursive_Success", [&testClass]() { testClass->InstallPackageReference_Recursive_Success(); });
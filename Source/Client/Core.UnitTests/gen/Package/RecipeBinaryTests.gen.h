@@ -0,0 +1,16 @@
+#pragma once
+#include "Package/RecipeBinaryTests.h"
+
+TestState RunRecipeBinaryTests() 
+ {
+	auto className = "RecipeBinaryTests";
+	auto testClass = std::make_shared<Soup::Build::UnitTests::RecipeBinaryTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "TryDeserialize_GarbageThrows", [&testClass]() { testClass->TryDeserialize_GarbageThrows(); });
+	state += SoupTest::RunTest(className, "TryDeserialize_InvalidFileType", [&testClass]() { testClass->TryDeserialize_InvalidFileType(); });
+	state += SoupTest::RunTest(className, "TryDeserialize_ChangedContent", [&testClass]() { testClass->TryDeserialize_ChangedContent(); });
+	state += SoupTest::RunTest(className, "TryDeserialize_PreviousVersion", [&testClass]() { testClass->TryDeserialize_PreviousVersion(); });
+	state += SoupTest::RunTest(className, "RoundTrip_AllProperties", [&testClass]() { testClass->RoundTrip_AllProperties(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "Package/RecipeValueViewTests.h"
+
+TestState RunRecipeValueViewTests() 
+ {
+	auto className = "RecipeValueViewTests";
+	auto testClass = std::make_shared<Soup::Build::Runtime::UnitTests::RecipeValueViewTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += SoupTest::RunTest(className, "TryGetAsString_SharesRecipeString", [&testClass]() { testClass->TryGetAsString_SharesRecipeString(); });
+	state += SoupTest::RunTest(className, "TrySetValue_DoesNotModifyRecipe", [&testClass]() { testClass->TrySetValue_DoesNotModifyRecipe(); });
+	state += SoupTest::RunTest(className, "TryCreateValue_KeepsNewValuesOutOfRecipe", [&testClass]() { testClass->TryCreateValue_KeepsNewValuesOutOfRecipe(); });
+	state += SoupTest::RunTest(className, "TryGetStringValues_ReadsRecipeList", [&testClass]() { testClass->TryGetStringValues_ReadsRecipeList(); });
+
+	return state;
+}
\ No newline at end of file
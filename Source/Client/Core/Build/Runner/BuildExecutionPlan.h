@@ -0,0 +1,390 @@
+﻿// <copyright file="BuildExecutionPlan.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// The build node graph flattened into dense indices with the children of every node
+	/// stored in contiguous arrays
+	/// Note: The children of a node are its own children followed by the nodes in other
+	/// packages that consume its output. Every appearance in a package root list counts as
+	/// an incoming edge so the roots are released by queuing the package.
+	/// Identical nodes are merged into the first one that was reached, the duplicates keep
+	/// their index but have no edges and are never scheduled.
+	/// </summary>
+	export class BuildExecutionPlan
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildExecutionPlan"/> class.
+		/// </summary>
+		BuildExecutionPlan() :
+			_nodes(),
+			_nodePackages(),
+			_nodeIndices(),
+			_canonicalNodes(),
+			_producers(),
+			_packageRootOffsets({ 0 }),
+			_packageRoots(),
+			_linkedEdges(),
+			_childOffsets(),
+			_children(),
+			_dependencyCounts()
+		{
+		}
+
+		/// <summary>
+		/// Add the nodes reachable from the package roots
+		/// Note: A node reachable from multiple packages belongs to the first package that reached it
+		/// </summary>
+		void AddPackage(const std::vector<Memory::Reference<Runtime::BuildGraphNode>>& roots)
+		{
+			// Assign the indices in depth first pre-order with an explicit stack of child lists
+			auto packageIndex = static_cast<uint32_t>(_packageRootOffsets.size() - 1);
+			auto stack = std::vector<std::pair<const std::vector<Memory::Reference<Runtime::BuildGraphNode>>*, size_t>>();
+			stack.push_back({ &roots, 0 });
+			while (!stack.empty())
+			{
+				auto& [nodes, offset] = stack.back();
+				if (offset == nodes->size())
+				{
+					stack.pop_back();
+					continue;
+				}
+
+				auto& node = *(*nodes)[offset++].GetRaw();
+				if (TryAddNode(node, packageIndex))
+					stack.push_back({ &node.GetChildren(), 0 });
+			}
+
+			for (auto& root : roots)
+				_packageRoots.push_back(_nodeIndices.at(root->GetId()));
+
+			_packageRootOffsets.push_back(static_cast<uint32_t>(_packageRoots.size()));
+		}
+
+		/// <summary>
+		/// Merge the nodes that run the same command to produce the same outputs and index
+		/// the node that produces each output file
+		/// Note: Two different nodes that produce the same file cannot both run, the conflict is an error
+		/// </summary>
+		void Deduplicate()
+		{
+			auto nodeCount = static_cast<uint32_t>(_nodes.size());
+			_canonicalNodes.resize(nodeCount);
+			_producers.clear();
+
+			auto commands = std::unordered_map<std::string, uint32_t>();
+			for (uint32_t index = 0; index < nodeCount; index++)
+			{
+				auto& node = *_nodes[index];
+				_canonicalNodes[index] = index;
+
+				// Nodes without outputs cannot be proven to be redundant
+				if (node.GetOutputFiles().empty())
+					continue;
+
+				auto command = GetCommandKey(node);
+				auto insertResult = commands.emplace(std::move(command), index);
+				if (!insertResult.second)
+				{
+					auto canonicalIndex = insertResult.first->second;
+					Log::Diag("Merge duplicate node: " + std::string(node.GetTitle()));
+					_canonicalNodes[index] = canonicalIndex;
+					continue;
+				}
+
+				for (auto& file : node.GetOutputFiles())
+				{
+					auto fullPath = GetFullPath(node, file);
+					auto producer = _producers.emplace(fullPath, index);
+					if (!producer.second && producer.first->second != index)
+					{
+						throw std::runtime_error(
+							"Conflicting producers for output file " + fullPath + ": " +
+							_nodes[producer.first->second]->GetTitle() + " and " + node.GetTitle());
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Add an edge from the node that produces a file to a node that consumes it
+		/// </summary>
+		void AddLinkedEdge(uint32_t producer, uint32_t consumer)
+		{
+			_linkedEdges.push_back({ producer, consumer });
+		}
+
+		/// <summary>
+		/// Build the child arrays and dependency counts and verify the graph has no cycles
+		/// </summary>
+		void Compile()
+		{
+			auto nodeCount = _nodes.size();
+
+			// Merge the duplicates if the caller did not need the producers first
+			if (_canonicalNodes.size() != nodeCount)
+				Deduplicate();
+
+			// Count the children of each node
+			// Note: The children of a duplicate node are moved to the node it was merged into
+			_childOffsets.assign(nodeCount + 1, 0);
+			for (size_t index = 0; index < nodeCount; index++)
+			{
+				_childOffsets[_canonicalNodes[index] + 1] += static_cast<uint32_t>(_nodes[index]->GetChildren().size());
+			}
+
+			for (auto& edge : _linkedEdges)
+			{
+				_childOffsets[_canonicalNodes[edge.first] + 1]++;
+			}
+
+			for (size_t index = 0; index < nodeCount; index++)
+			{
+				_childOffsets[index + 1] += _childOffsets[index];
+			}
+
+			// Fill the own children first and the linked children after them
+			_children.resize(_childOffsets[nodeCount]);
+			auto cursors = std::vector<uint32_t>(_childOffsets.begin(), _childOffsets.end() - 1);
+			for (size_t index = 0; index < nodeCount; index++)
+			{
+				auto canonicalIndex = _canonicalNodes[index];
+				for (auto& child : _nodes[index]->GetChildren())
+				{
+					_children[cursors[canonicalIndex]++] = _canonicalNodes[_nodeIndices.at(child->GetId())];
+				}
+			}
+
+			for (auto& edge : _linkedEdges)
+			{
+				_children[cursors[_canonicalNodes[edge.first]]++] = _canonicalNodes[edge.second];
+			}
+
+			// Point the package roots at the merged nodes
+			for (auto& root : _packageRoots)
+				root = _canonicalNodes[root];
+
+			// Count the incoming edges for each node
+			_dependencyCounts.assign(nodeCount, 0);
+			for (auto child : _children)
+				_dependencyCounts[child]++;
+			for (auto root : _packageRoots)
+				_dependencyCounts[root]++;
+
+			VerifyAcyclic();
+		}
+
+		/// <summary>
+		/// Gets the number of nodes in the plan
+		/// </summary>
+		size_t GetNodeCount() const
+		{
+			return _nodes.size();
+		}
+
+		/// <summary>
+		/// Gets a single node
+		/// </summary>
+		const Runtime::BuildGraphNode& GetNode(uint32_t index) const
+		{
+			return *_nodes[index];
+		}
+
+		/// <summary>
+		/// Gets the package that owns a node
+		/// </summary>
+		uint32_t GetPackage(uint32_t index) const
+		{
+			return _nodePackages[index];
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the node was merged into another identical node
+		/// </summary>
+		bool IsDuplicate(uint32_t index) const
+		{
+			return _canonicalNodes[index] != index;
+		}
+
+		/// <summary>
+		/// Find the node that produces the provided file
+		/// </summary>
+		bool TryGetProducer(const std::string& fullPath, uint32_t& index) const
+		{
+			auto findResult = _producers.find(fullPath);
+			if (findResult == _producers.end())
+				return false;
+
+			index = findResult->second;
+			return true;
+		}
+
+		/// <summary>
+		/// Resolve a node file relative to the working directory of the node
+		/// </summary>
+		static std::string GetFullPath(const Runtime::BuildGraphNode& node, const std::string& file)
+		{
+			auto filePath = Path(file);
+			if (filePath.HasRoot())
+				return filePath.ToString();
+			else
+				return (Path(node.GetWorkingDirectory()) + filePath).ToString();
+		}
+
+		/// <summary>
+		/// Gets the index of the node with the provided id
+		/// </summary>
+		bool TryGetIndex(int64_t nodeId, uint32_t& index) const
+		{
+			auto findResult = _nodeIndices.find(nodeId);
+			if (findResult == _nodeIndices.end())
+				return false;
+
+			index = findResult->second;
+			return true;
+		}
+
+		/// <summary>
+		/// Gets the root nodes of a package
+		/// </summary>
+		std::span<const uint32_t> GetPackageRoots(size_t packageIndex) const
+		{
+			return std::span<const uint32_t>(
+				_packageRoots.data() + _packageRootOffsets[packageIndex],
+				_packageRoots.data() + _packageRootOffsets[packageIndex + 1]);
+		}
+
+		/// <summary>
+		/// Gets the children of a node
+		/// </summary>
+		std::span<const uint32_t> GetChildren(uint32_t index) const
+		{
+			return std::span<const uint32_t>(
+				_children.data() + _childOffsets[index],
+				_children.data() + _childOffsets[index + 1]);
+		}
+
+		/// <summary>
+		/// Gets the number of incoming edges for every node
+		/// </summary>
+		const std::vector<uint32_t>& GetDependencyCounts() const
+		{
+			return _dependencyCounts;
+		}
+
+	private:
+		/// <summary>
+		/// Build the key that identifies the command a node runs and the files it produces
+		/// </summary>
+		static std::string GetCommandKey(const Runtime::BuildGraphNode& node)
+		{
+			auto key = std::string();
+			key.append(node.GetProgram()).push_back('\0');
+			key.append(node.GetArguments()).push_back('\0');
+			key.append(node.GetWorkingDirectory()).push_back('\0');
+			for (auto& file : node.GetOutputFiles())
+				key.append(file).push_back('\0');
+
+			return key;
+		}
+
+		/// <summary>
+		/// Assign the next index to a node the first time it is reached
+		/// </summary>
+		bool TryAddNode(const Runtime::BuildGraphNode& node, uint32_t packageIndex)
+		{
+			auto index = static_cast<uint32_t>(_nodes.size());
+			if (!_nodeIndices.emplace(node.GetId(), index).second)
+				return false;
+
+			_nodes.push_back(&node);
+			_nodePackages.push_back(packageIndex);
+			return true;
+		}
+
+		/// <summary>
+		/// Walk the graph with a single iterative depth first search and report the first cycle
+		/// </summary>
+		void VerifyAcyclic() const
+		{
+			enum class VisitState : uint8_t
+			{
+				New,
+				Active,
+				Done,
+			};
+
+			// The stack holds each active node along with the offset of its next child
+			auto states = std::vector<VisitState>(_nodes.size(), VisitState::New);
+			auto stack = std::vector<std::pair<uint32_t, uint32_t>>();
+			for (uint32_t start = 0; start < _nodes.size(); start++)
+			{
+				if (states[start] != VisitState::New)
+					continue;
+
+				states[start] = VisitState::Active;
+				stack.push_back({ start, _childOffsets[start] });
+				while (!stack.empty())
+				{
+					auto& [index, offset] = stack.back();
+					if (offset == _childOffsets[index + 1])
+					{
+						states[index] = VisitState::Done;
+						stack.pop_back();
+						continue;
+					}
+
+					auto child = _children[offset++];
+					switch (states[child])
+					{
+						case VisitState::New:
+							states[child] = VisitState::Active;
+							stack.push_back({ child, _childOffsets[child] });
+							break;
+						case VisitState::Active:
+							ThrowCycle(stack, child);
+						case VisitState::Done:
+							break;
+					}
+				}
+			}
+		}
+
+		[[noreturn]] void ThrowCycle(
+			const std::vector<std::pair<uint32_t, uint32_t>>& stack,
+			uint32_t child) const
+		{
+			auto message = std::stringstream();
+			message << "Build node graph must be acyclic: ";
+			auto cycleStart = std::find_if(
+				stack.begin(),
+				stack.end(),
+				[child](const auto& entry) { return entry.first == child; });
+			for (auto entry = cycleStart; entry != stack.end(); ++entry)
+			{
+				message << _nodes[entry->first]->GetTitle() << " -> ";
+			}
+
+			message << _nodes[child]->GetTitle();
+			throw std::runtime_error(message.str());
+		}
+
+	private:
+		std::vector<const Runtime::BuildGraphNode*> _nodes;
+		std::vector<uint32_t> _nodePackages;
+		std::unordered_map<int64_t, uint32_t> _nodeIndices;
+		std::vector<uint32_t> _canonicalNodes;
+		std::unordered_map<std::string, uint32_t> _producers;
+		std::vector<uint32_t> _packageRootOffsets;
+		std::vector<uint32_t> _packageRoots;
+		std::vector<std::pair<uint32_t, uint32_t>> _linkedEdges;
+		std::vector<uint32_t> _childOffsets;
+		std::vector<uint32_t> _children;
+		std::vector<uint32_t> _dependencyCounts;
+	};
+}
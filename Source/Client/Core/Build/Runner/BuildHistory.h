@@ -84,6 +84,55 @@ namespace Soup::Build
 			return _knownFiles;
 		}
 
+		/// <summary>
+		/// Get the files directly included by the requested file
+		/// </summary>
+		bool TryGetIncludes(
+			const Path& file,
+			std::vector<Path>& includes) const
+		{
+			auto fileInfoResult = _fastLookup.find(file.ToString());
+			if (fileInfoResult != _fastLookup.end())
+			{
+				includes = fileInfoResult->second.Includes;
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Find the name the history recorded for a package source file
+		/// Files compiled on their own are recorded by their package relative path
+		/// while files compiled inside a unity file are recorded by the absolute path
+		/// the unity file includes them with
+		/// </summary>
+		bool TryFindSourceFile(
+			const Path& packageRoot,
+			const Path& sourceFile,
+			Path& historyFile) const
+		{
+			if (_fastLookup.contains(sourceFile.ToString()))
+			{
+				historyFile = sourceFile;
+				return true;
+			}
+
+			if (!sourceFile.HasRoot())
+			{
+				auto absoluteSourceFile = packageRoot + sourceFile;
+				if (_fastLookup.contains(absoluteSourceFile.ToString()))
+				{
+					historyFile = std::move(absoluteSourceFile);
+					return true;
+				}
+			}
+
+			return false;
+		}
+
 		/// <summary>
 		/// Recursively build up the closure of all included files
 		/// from the build state
@@ -4,6 +4,7 @@
 
 #pragma once
 #include "BuildHistory.h"
+#include "RebuildExplanation.h"
 
 namespace Soup::Build
 {
@@ -23,13 +24,27 @@ namespace Soup::Build
 			const std::vector<Path>& targetFiles,
 			const std::vector<Path>& inputFiles,
 			const Path& rootPath)
+		{
+			auto explanation = RebuildExplanation();
+			return IsOutdated(targetFiles, inputFiles, rootPath, explanation);
+		}
+
+		/// <summary>
+		/// Perform a check if the requested target is outdated with
+		/// respect to the input files and explain the first reason it is
+		/// </summary>
+		bool IsOutdated(
+			const std::vector<Path>& targetFiles,
+			const std::vector<Path>& inputFiles,
+			const Path& rootPath,
+			RebuildExplanation& explanation)
 		{
 			if (inputFiles.empty())
 				throw std::runtime_error("Cannot check outdated with no input files.");
 
 			for (auto& targetFile : targetFiles)
 			{
-				if (IsOutdated(targetFile, inputFiles, rootPath))
+				if (IsOutdated(targetFile, inputFiles, rootPath, explanation))
 				{
 					return true;
 				}
@@ -46,13 +61,15 @@ namespace Soup::Build
 		bool IsOutdated(
 			const Path& targetFile,
 			const std::vector<Path>& inputFiles,
-			const Path& rootPath)
+			const Path& rootPath,
+			RebuildExplanation& explanation)
 		{
 			// Verify the output file exists
 			auto relativeOutputFile = targetFile.HasRoot() ? targetFile : rootPath + targetFile;
 			if (!System::IFileSystem::Current().Exists(relativeOutputFile))
 			{
 				Log::Info("Output target does not exist: " + relativeOutputFile.ToString());
+				explanation = RebuildExplanation({ RebuildReason::MissingOutput, relativeOutputFile.ToString() });
 				return true;
 			}
 
@@ -64,7 +81,7 @@ namespace Soup::Build
 			{
 				// If the file is relative then combine it with the root path
 				auto relativeInputFile = inputFile.HasRoot() ? inputFile : rootPath + inputFile;
-				if (IsOutdated(relativeInputFile, relativeOutputFile, outputFileLastWriteTime))
+				if (IsOutdated(relativeInputFile, relativeOutputFile, outputFileLastWriteTime, explanation))
 				{
 					return true;
 				}
@@ -74,7 +91,11 @@ namespace Soup::Build
 		}
 
 	private:
-		bool IsOutdated(Path inputFile, Path outputFile, std::time_t outputFileLastWriteTime)
+		bool IsOutdated(
+			Path inputFile,
+			Path outputFile,
+			std::time_t outputFileLastWriteTime,
+			RebuildExplanation& explanation)
 		{
 			// Check if the file exists in the cache
 			std::optional<std::time_t> lastWriteTime = std::nullopt;
@@ -105,6 +126,7 @@ namespace Soup::Build
 			{
 				// The input 
 				Log::Error("  " + inputFile.ToString() + " [MISSING]");
+				explanation = RebuildExplanation({ RebuildReason::MissingInput, inputFile.ToString() });
 				return true;
 			}
 			else
@@ -113,6 +135,12 @@ namespace Soup::Build
 				if (lastWriteTime.value() > outputFileLastWriteTime)
 				{
 					Log::Info("Input altered after target [" + inputFile.ToString() + "] -> [" + outputFile.ToString() + "]");
+					auto difference = static_cast<int64_t>(lastWriteTime.value() - outputFileLastWriteTime);
+					explanation = RebuildExplanation({
+						RebuildReason::InputNewer,
+						inputFile.ToString() + " is newer than " + outputFile.ToString() +
+							" by " + std::to_string(difference) + "s",
+					});
 					return true;
 				}
 				else
@@ -18,6 +18,16 @@ namespace Soup::Build
 		static constexpr std::string_view BuildHistoryFileName = "BuildHistory.json";
 
 	public:
+		/// <summary>
+		/// Get the build state file for the provided directory
+		/// </summary>
+		static Path GetStateFile(const Path& directory)
+		{
+			return directory +
+				Path(Constants::ProjectGenerateFolderName) +
+				Path(BuildHistoryFileName);
+		}
+
 		/// <summary>
 		/// Load the build state from the provided directory
 		/// </summary>
@@ -25,9 +35,7 @@ namespace Soup::Build
 			const Path& directory, BuildHistory& result)
 		{
 			// Verify the requested file exists
-			auto BuildHistoryFile = directory +
-				Path(Constants::ProjectGenerateFolderName) +
-				Path(BuildHistoryFileName);
+			auto BuildHistoryFile = GetStateFile(directory);
 			if (!System::IFileSystem::Current().Exists(BuildHistoryFile))
 			{
 				Log::Info("BuildHistory file does not exist");
@@ -62,8 +70,7 @@ namespace Soup::Build
 		{
 			auto buildProjectGenerateFolder = directory +
 				Path(Constants::ProjectGenerateFolderName);
-			auto BuildHistoryFile = buildProjectGenerateFolder +
-				Path(BuildHistoryFileName);
+			auto BuildHistoryFile = GetStateFile(directory);
 
 			// Ensure the target directories exists
 			if (!System::IFileSystem::Current().Exists(buildProjectGenerateFolder))
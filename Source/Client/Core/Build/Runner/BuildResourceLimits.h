@@ -0,0 +1,89 @@
+﻿// <copyright file="BuildResourceLimits.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "IJobServer.h"
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// The set of machine resource limits the build runner must respect
+	/// while executing build nodes concurrently
+	/// </summary>
+	export class BuildResourceLimits
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildResourceLimits"/> class.
+		/// Defaults to a single sequential job with no other restrictions
+		/// </summary>
+		BuildResourceLimits() :
+			MaxParallelism(1),
+			ClassLimits(),
+			MemoryBudget(0),
+			MemoryPressureThreshold(0),
+			JobServer()
+		{
+		}
+
+		/// <summary>
+		/// Gets the maximum number of nodes allowed to execute for the requested resource class
+		/// Note: Zero means the class is only restricted by the total parallelism
+		/// </summary>
+		uint64_t GetClassLimit(ResourceClass resourceClass) const
+		{
+			auto findResult = ClassLimits.find(resourceClass);
+			if (findResult != ClassLimits.end())
+				return findResult->second;
+			else
+				return 0;
+		}
+
+		/// <summary>
+		/// Gets or sets the maximum number of nodes executing at the same time
+		/// </summary>
+		uint64_t MaxParallelism;
+
+		/// <summary>
+		/// Gets or sets the per resource class pool sizes
+		/// </summary>
+		std::map<ResourceClass, uint64_t> ClassLimits;
+
+		/// <summary>
+		/// Gets or sets the total memory weight (MB) allowed to be in flight
+		/// Note: Zero means unlimited
+		/// </summary>
+		uint64_t MemoryBudget;
+
+		/// <summary>
+		/// Gets or sets the memory pressure stall percentage (avg10) at which
+		/// the runner stops admitting new work
+		/// Note: Zero disables the pressure check
+		/// </summary>
+		double MemoryPressureThreshold;
+
+		/// <summary>
+		/// Gets or sets the optional job server that every concurrent job
+		/// beyond the first must hold a token from
+		/// </summary>
+		std::shared_ptr<IJobServer> JobServer;
+
+		/// <summary>
+		/// Equality operator
+		/// </summary>
+		bool operator ==(const BuildResourceLimits& rhs) const
+		{
+			return MaxParallelism == rhs.MaxParallelism &&
+				ClassLimits == rhs.ClassLimits &&
+				MemoryBudget == rhs.MemoryBudget &&
+				MemoryPressureThreshold == rhs.MemoryPressureThreshold &&
+				JobServer == rhs.JobServer;
+		}
+
+		bool operator !=(const BuildResourceLimits& rhs) const
+		{
+			return !(*this == rhs);
+		}
+	};
+}
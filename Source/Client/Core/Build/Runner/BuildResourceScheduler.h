@@ -0,0 +1,200 @@
+﻿// <copyright file="BuildResourceScheduler.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "BuildResourceLimits.h"
+#include "MemoryPressureMonitor.h"
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// Tracks the resources held by the currently executing build nodes and
+	/// decides if another node may be admitted
+	/// </summary>
+	export class BuildResourceScheduler
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildResourceScheduler"/> class.
+		/// </summary>
+		BuildResourceScheduler(BuildResourceLimits limits) :
+			_limits(std::move(limits)),
+			_activeCount(0),
+			_activeThreads(0),
+			_activeClassCounts(),
+			_activeMemory(0),
+			_jobServerTokens(0),
+			_pressureMonitor()
+		{
+		}
+
+		/// <summary>
+		/// Attempt to reserve the resources for a single node
+		/// Note: A node is always admitted when nothing else is running so that a
+		/// single node that exceeds the budget can still make forward progress
+		/// </summary>
+		bool TryAcquire(ResourceClass resourceClass, uint64_t memoryWeight, uint64_t threadCount = 1)
+		{
+			auto slots = GetSlotCount(threadCount);
+			if (_activeCount > 0)
+			{
+				if (!CanAdmit(resourceClass, memoryWeight, slots))
+					return false;
+
+				// The first job slot runs on the implicit token, all others must
+				// share the job server budget with the rest of the process tree
+				if (!TryAcquireJobServerTokens(_activeThreads + slots - 1))
+					return false;
+			}
+			else if (_limits.JobServer != nullptr)
+			{
+				// Take what is available for the extra threads of the first node
+				while (_jobServerTokens < slots - 1 && _limits.JobServer->TryAcquire())
+					_jobServerTokens++;
+			}
+
+			_activeCount++;
+			_activeThreads += slots;
+			_activeClassCounts[resourceClass]++;
+			_activeMemory += memoryWeight;
+			return true;
+		}
+
+		/// <summary>
+		/// Release the resources reserved for a single node
+		/// </summary>
+		void Release(ResourceClass resourceClass, uint64_t memoryWeight, uint64_t threadCount = 1)
+		{
+			auto findClass = _activeClassCounts.find(resourceClass);
+			if (_activeCount == 0 || findClass == _activeClassCounts.end() || findClass->second == 0)
+				throw std::runtime_error("Released a resource that was never acquired.");
+
+			auto slots = GetSlotCount(threadCount);
+			_activeCount--;
+			_activeThreads -= std::min(_activeThreads, slots);
+			findClass->second--;
+			_activeMemory -= std::min(_activeMemory, memoryWeight);
+
+			// Always keep the implicit token, return the extra ones
+			auto requiredTokens = _activeThreads > 0 ? _activeThreads - 1 : 0;
+			while (_jobServerTokens > requiredTokens)
+			{
+				_limits.JobServer->Release();
+				_jobServerTokens--;
+			}
+		}
+
+		uint64_t GetActiveCount() const
+		{
+			return _activeCount;
+		}
+
+		uint64_t GetActiveCount(ResourceClass resourceClass) const
+		{
+			auto findClass = _activeClassCounts.find(resourceClass);
+			if (findClass != _activeClassCounts.end())
+				return findClass->second;
+			else
+				return 0;
+		}
+
+		uint64_t GetActiveThreadCount() const
+		{
+			return _activeThreads;
+		}
+
+		uint64_t GetActiveMemory() const
+		{
+			return _activeMemory;
+		}
+
+		uint64_t GetJobServerTokenCount() const
+		{
+			return _jobServerTokens;
+		}
+
+		const BuildResourceLimits& GetLimits() const
+		{
+			return _limits;
+		}
+
+	private:
+		/// <summary>
+		/// A node never reserves more job slots than the build allows in total
+		/// </summary>
+		uint64_t GetSlotCount(uint64_t threadCount) const
+		{
+			auto maxParallelism = std::max<uint64_t>(1, _limits.MaxParallelism);
+			return std::clamp<uint64_t>(threadCount, 1, maxParallelism);
+		}
+
+		/// <summary>
+		/// Grow the set of held job server tokens to the requested count
+		/// </summary>
+		bool TryAcquireJobServerTokens(uint64_t requiredTokens)
+		{
+			if (_limits.JobServer == nullptr)
+				return true;
+
+			auto initialTokens = _jobServerTokens;
+			while (_jobServerTokens < requiredTokens)
+			{
+				if (!_limits.JobServer->TryAcquire())
+				{
+					// Only keep the tokens for the nodes that are already running
+					while (_jobServerTokens > initialTokens)
+					{
+						_limits.JobServer->Release();
+						_jobServerTokens--;
+					}
+
+					return false;
+				}
+
+				_jobServerTokens++;
+			}
+
+			return true;
+		}
+
+		bool CanAdmit(ResourceClass resourceClass, uint64_t memoryWeight, uint64_t slots)
+		{
+			// Check the total parallelism
+			auto maxParallelism = std::max<uint64_t>(1, _limits.MaxParallelism);
+			if (_activeThreads + slots > maxParallelism)
+				return false;
+
+			// Check the pool for the requested class
+			auto classLimit = _limits.GetClassLimit(resourceClass);
+			if (classLimit > 0 && GetActiveCount(resourceClass) >= classLimit)
+				return false;
+
+			// Check the memory budget
+			if (_limits.MemoryBudget > 0 && _activeMemory + memoryWeight > _limits.MemoryBudget)
+				return false;
+
+			// Back off if the system is already stalling on memory
+			if (_limits.MemoryPressureThreshold > 0)
+			{
+				double pressure = 0;
+				if (_pressureMonitor.TryGetPressure(pressure) &&
+					pressure >= _limits.MemoryPressureThreshold)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+	private:
+		BuildResourceLimits _limits;
+		uint64_t _activeCount;
+		uint64_t _activeThreads;
+		std::map<ResourceClass, uint64_t> _activeClassCounts;
+		uint64_t _activeMemory;
+		uint64_t _jobServerTokens;
+		MemoryPressureMonitor _pressureMonitor;
+	};
+}
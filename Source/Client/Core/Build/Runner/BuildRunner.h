@@ -3,7 +3,10 @@
 // </copyright>
 
 #pragma once
+#include "Build/Runner/BuildExecutionPlan.h"
 #include "Build/Runner/BuildHistory.h"
+#include "Build/Runner/BuildResourceScheduler.h"
+#include "Build/Runner/BuiltInOperationRunner.h"
 
 namespace Soup::Build
 {
@@ -12,247 +15,710 @@ namespace Soup::Build
 	/// </summary>
 	export class BuildRunner
 	{
+	public:
+		using ProcessResult = decltype(std::declval<System::IProcessManager&>().Execute(
+			std::declval<const Path&>(),
+			std::declval<const std::string&>(),
+			std::declval<const Path&>()));
+
+		/// <summary>
+		/// Execute a single external process
+		/// Note: Called from the worker threads when running in parallel
+		/// </summary>
+		using ExecuteProcessFunction = std::function<ProcessResult(const Path&, const std::string&, const Path&)>;
+
+	private:
+
+		/// <summary>
+		/// A node that has had all of its parents complete and is waiting to be started
+		/// </summary>
+		struct ReadyNode
+		{
+			uint32_t Index;
+			bool ForceBuild;
+		};
+
+		/// <summary>
+		/// The result of a node that was executed on a worker thread
+		/// </summary>
+		struct CompletedJob
+		{
+			uint32_t Index;
+			ProcessResult Result;
+			std::exception_ptr Exception;
+		};
+
+		/// <summary>
+		/// The build nodes for a single package that share one build history
+		/// </summary>
+		struct PackageGraph
+		{
+			std::vector<Memory::Reference<Runtime::BuildGraphNode>> Nodes;
+			Path TargetDirectory;
+			BuildHistory History;
+			bool ForceBuild;
+			RebuildReason ForceReason;
+		};
+
+		/// <summary>
+		/// The parent of a node that was not forced to build by another node
+		/// </summary>
+		static constexpr uint32_t NoParent = std::numeric_limits<uint32_t>::max();
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="BuildRunner"/> class.
 		/// </summary>
 		BuildRunner(Path workingDirectory) :
+			BuildRunner(std::move(workingDirectory), BuildResourceLimits())
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildRunner"/> class.
+		/// </summary>
+		BuildRunner(Path workingDirectory, BuildResourceLimits limits) :
+			BuildRunner(std::move(workingDirectory), std::move(limits), nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildRunner"/> class.
+		/// Note: When an explanation log is provided the reason every executed node was run is
+		/// reported to it, the caller owns the log and reports the totals once for the whole build
+		/// </summary>
+		BuildRunner(Path workingDirectory, BuildResourceLimits limits, RebuildExplanationLog* explanationLog) :
+			BuildRunner(std::move(workingDirectory), std::move(limits), explanationLog, nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildRunner"/> class
+		/// with a custom process executor, the current process manager is used when empty.
+		/// </summary>
+		BuildRunner(
+			Path workingDirectory,
+			BuildResourceLimits limits,
+			RebuildExplanationLog* explanationLog,
+			ExecuteProcessFunction executeProcess) :
 			_workingDirectory(std::move(workingDirectory)),
+			_executeProcess(std::move(executeProcess)),
+			_explanationLog(explanationLog),
+			_packages(),
+			_plan(),
 			_dependencyCounts(),
-			_buildHistory(),
-			_stateChecker()
+			_forceBuildState(),
+			_forcedBy(),
+			_stateChecker(),
+			_scheduler(std::move(limits)),
+			_readyNodes(),
+			_runningJobs(),
+			_completedJobs(),
+			_completedMutex(),
+			_completedCondition()
 		{
 		}
 
+		/// <summary>
+		/// Execute the build nodes for a single package
+		/// </summary>
 		void Execute(
 			const std::vector<Memory::Reference<Runtime::BuildGraphNode>>& nodes,
 			const Path& objectDirectory,
 			bool forceBuild)
+		{
+			AddPackage(nodes, _workingDirectory + objectDirectory, forceBuild);
+			Execute();
+		}
+
+		/// <summary>
+		/// Add the build nodes for a package to the combined build graph
+		/// Note: Each package keeps its own build history in its target directory
+		/// </summary>
+		void AddPackage(
+			const std::vector<Memory::Reference<Runtime::BuildGraphNode>>& nodes,
+			Path targetDirectory,
+			bool forceBuild)
 		{
 			// Load the previous build state if performing an incremental build
-			auto targetDirectory = _workingDirectory + objectDirectory;
+			auto history = BuildHistory();
+			auto forceReason = RebuildReason::ForceRebuild;
 			if (!forceBuild)
 			{
 				Log::Diag("Loading previous build state");
-				if (!BuildHistoryManager::TryLoadState(targetDirectory, _buildHistory))
+				if (!BuildHistoryManager::TryLoadState(targetDirectory, history))
 				{
 					Log::Info("No previous state found, full rebuild required");
-					_buildHistory = BuildHistory();
+					history = BuildHistory();
 					forceBuild = true;
+					forceReason = RebuildReason::MissingHistory;
 				}
 			}
 
-			// Build the initial node dependency set to
+			_packages.push_back(PackageGraph({
+				nodes,
+				std::move(targetDirectory),
+				std::move(history),
+				forceBuild,
+				forceReason,
+			}));
+
+			_plan.AddPackage(nodes);
+		}
+
+		/// <summary>
+		/// Execute all of the added packages as a single build graph
+		/// </summary>
+		void Execute()
+		{
+			// Merge identical nodes so the same work never runs twice and
+			// verify that every output file has a single producer
+			_plan.Deduplicate();
+
+			// Connect the packages through the files they share so that a node
+			// only waits on the upstream work it actually consumes
+			LinkPackages();
+
+			// Flatten the graph into the execution plan to
 			// ensure nodes are built in the correct order 
 			// and that there are no cycles
-			auto emptyParentSet = std::set<int>();
-			BuildDependencies(nodes, emptyParentSet);
+			_plan.Compile();
+			_dependencyCounts = _plan.GetDependencyCounts();
+			_forceBuildState.assign(_plan.GetNodeCount(), false);
+			_forcedBy.assign(_plan.GetNodeCount(), NoParent);
 
 			// Run all build nodes in the correct order with incremental build checks
-			CheckExecuteNodes(nodes, forceBuild);
+			// Note: Queue in reverse so the first package is at the front of the ready list
+			for (size_t packageIndex = _packages.size(); packageIndex > 0; packageIndex--)
+			{
+				auto& package = _packages[packageIndex - 1];
+				QueueReadyNodes(_plan.GetPackageRoots(packageIndex - 1), package.ForceBuild, NoParent);
+			}
 
-			Log::Info("Saving updated build state");
-			BuildHistoryManager::SaveState(targetDirectory, _buildHistory);
+			try
+			{
+				ExecuteReadyNodes();
+			}
+			catch (...)
+			{
+				// Do not leave any work running after a failure and return the
+				// resources (and job server tokens) that the running work still holds
+				WaitForRunningJobs();
+				throw;
+			}
+
+			for (auto& package : _packages)
+			{
+				Log::Info("Saving updated build state");
+				BuildHistoryManager::SaveState(package.TargetDirectory, package.History);
+			}
 
 			Log::HighPriority("Done");
 		}
 
 	private:
 		/// <summary>
-		/// Build dependencies
+		/// Add an edge from the node that produces a file in one package to each node
+		/// in a different package that uses the file as an input
 		/// </summary>
-		void BuildDependencies(
-			const std::vector<Memory::Reference<Runtime::BuildGraphNode>>& nodes,
-			const std::set<int>& parentSet)
+		void LinkPackages()
+		{
+			if (_packages.size() <= 1)
+				return;
+
+			auto nodeCount = static_cast<uint32_t>(_plan.GetNodeCount());
+			for (uint32_t index = 0; index < nodeCount; index++)
+			{
+				// The merged nodes share the edges of the node they were merged into
+				if (_plan.IsDuplicate(index))
+					continue;
+
+				auto& node = _plan.GetNode(index);
+				auto consumerPackage = _plan.GetPackage(index);
+				auto linkedProducers = std::set<uint32_t>();
+				for (auto& file : node.GetInputFiles())
+				{
+					uint32_t producerIndex = 0;
+					if (!_plan.TryGetProducer(BuildExecutionPlan::GetFullPath(node, file), producerIndex))
+						continue;
+
+					// Edges inside a single package are already part of its graph
+					if (_plan.GetPackage(producerIndex) == consumerPackage)
+						continue;
+
+					if (linkedProducers.insert(producerIndex).second)
+					{
+						_plan.AddLinkedEdge(producerIndex, index);
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Get the build history for the package that owns the node
+		/// </summary>
+		BuildHistory& GetBuildHistory(uint32_t index)
+		{
+			return _packages[_plan.GetPackage(index)].History;
+		}
+
+		/// <summary>
+		/// Notify the collection of build nodes that a parent has completed and
+		/// move any node that has no remaining dependencies into the ready list
+		/// </summary>
+		void QueueReadyNodes(
+			std::span<const uint32_t> nodes,
+			bool forceBuild,
+			uint32_t parentIndex)
 		{
-			for (auto& node : nodes)
+			auto readyNodes = std::vector<ReadyNode>();
+			for (auto index : nodes)
 			{
-				// Make sure there are no cycles
-				if (parentSet.contains(node->GetId()))
-					throw std::runtime_error("A build node graph must be acyclic.");
-				
-				// Check if the node was already a child from a different path
-				auto currentNodeSearch = _dependencyCounts.find(node->GetId());
-				if (currentNodeSearch != _dependencyCounts.end())
+				// Force build if any parent was built
+				// Note: Remember the first parent that forced the build to explain it
+				if (forceBuild && !_forceBuildState[index])
+				{
+					_forceBuildState[index] = true;
+					_forcedBy[index] = parentIndex;
+				}
+
+				bool nodeForceBuild = _forceBuildState[index];
+
+				auto remainingCount = --_dependencyCounts[index];
+				if (remainingCount == 0)
 				{
-					// Increment the dependency count
-					currentNodeSearch->second++;
+					readyNodes.push_back({ index, nodeForceBuild });
 				}
 				else
 				{
-					// Insert a new entry with a single count
-					_dependencyCounts.emplace(node->GetId(), 1);
-					
-					// Recurse to children only the first time we see a node
-					auto updatedParentSet = parentSet;
-					updatedParentSet.insert(node->GetId());
-					BuildDependencies(node->GetChildren(), updatedParentSet);
+					// This node will be executed from a different path
 				}
 			}
+
+			// Place the new nodes at the front of the list to keep a depth first
+			// execution order, which matches the sequential build
+			_readyNodes.insert(_readyNodes.begin(), readyNodes.begin(), readyNodes.end());
 		}
 
 		/// <summary>
-		/// Execute the collection of build nodes
+		/// Execute nodes from the ready list until the graph is complete
 		/// </summary>
-		void CheckExecuteNodes(
-			const std::vector<Memory::Reference<Runtime::BuildGraphNode>>& nodes,
-			bool forceBuild)
+		void ExecuteReadyNodes()
 		{
-			for (auto& node : nodes)
+			while (!_readyNodes.empty() || _scheduler.GetActiveCount() > 0)
 			{
-				// Check if the node was already a child from a different path
-				auto currentNodeSearch = _dependencyCounts.find(node->GetId());
-				if (currentNodeSearch != _dependencyCounts.end())
+				// Complete finished work first so that children become ready
+				ProcessCompletedJobs();
+
+				// Start as much work as the resource limits allow
+				bool startedNode = false;
+				while (TryStartReadyNode())
 				{
-					auto remainingCount = --currentNodeSearch->second;
-					if (remainingCount == 0)
-					{
-						ExecuteNode(*node, forceBuild);
-					}
-					else
-					{
-						// This node will be executed from a different path
-					}
+					startedNode = true;
 				}
-				else
+
+				// Wait for running work to complete to free up resources
+				if (!startedNode && _scheduler.GetActiveCount() > 0)
 				{
-					throw std::runtime_error("A node id was missing from the dependency collection.");
+					WaitForCompletedJob();
 				}
 			}
 		}
 
 		/// <summary>
-		/// Execute a single build node and all of its children
+		/// Attempt to start the first ready node that fits in the available resources
 		/// </summary>
-		void ExecuteNode(
-			const Runtime::BuildGraphNode& node,
-			bool forceBuild)
+		bool TryStartReadyNode()
 		{
-			bool buildRequired = forceBuild;
-			if (!forceBuild)
+			for (auto iterator = _readyNodes.begin(); iterator != _readyNodes.end(); ++iterator)
 			{
-				// Check if each source file is out of date and requires a rebuild
-				Log::Diag("Check for updated source");
-				
-				// Try to build up the closure of include dependencies
-				const auto& inputFiles = node.GetInputFiles();
-				if (!inputFiles.empty())
+				auto& node = _plan.GetNode(iterator->Index);
+				auto resourceClass = static_cast<ResourceClass>(node.GetResourceClass());
+				if (_scheduler.TryAcquire(resourceClass, node.GetMemoryWeight(), node.GetThreadCount()))
 				{
-					auto inputClosure = std::vector<Path>();
+					auto readyNode = *iterator;
+					_readyNodes.erase(iterator);
+					StartNode(readyNode.Index, readyNode.ForceBuild);
+					return true;
+				}
+			}
 
-					// TODO: Is this how we want to handle no input nodes?
-					// If there are source files to the node check their build state
-					for (auto& inputFile : inputFiles)
+			return false;
+		}
+
+		/// <summary>
+		/// Start a single build node
+		/// Note: The incremental check runs on the calling thread and only the
+		/// external process is executed on a worker thread
+		/// </summary>
+		void StartNode(
+			uint32_t index,
+			bool forceBuild)
+		{
+			auto& node = _plan.GetNode(index);
+			auto builtInOperation = Extensions::BuiltInOperation();
+			bool isBuiltInOperation = Extensions::TryParseBuiltInProgram(node.GetProgram(), builtInOperation);
+			if (isBuiltInOperation && builtInOperation == Extensions::BuiltInOperation::WriteFile)
+			{
+				StartWriteFileNode(index, forceBuild);
+				return;
+			}
+
+			auto explanation = RebuildExplanation();
+			bool buildRequired = false;
+			if (forceBuild)
+			{
+				explanation = GetForceBuildExplanation(index);
+				buildRequired = true;
+			}
+			else
+			{
+				buildRequired = CheckBuildRequired(index, explanation);
+			}
+
+			if (!buildRequired)
+			{
+				Log::Info(node.GetTitle());
+				ReleaseResources(node);
+
+				// Notify the children that this node is complete
+				QueueChildren(index, false);
+				return;
+			}
+
+			Log::HighPriority(node.GetTitle());
+			if (_explanationLog != nullptr)
+				_explanationLog->Report(node.GetTitle(), explanation);
+
+			// Built in operations are cheap enough to always run inline
+			if (isBuiltInOperation)
+			{
+				Log::Diag("Execute: " + std::string(node.GetProgram()) + " " + node.GetArguments());
+				auto builtInResult = BuiltInOperationRunner::Execute(
+					builtInOperation,
+					node.GetArguments(),
+					Path(node.GetWorkingDirectory()));
+
+				auto result = ProcessResult();
+				result.ExitCode = builtInResult.ExitCode;
+				result.StdOut = std::move(builtInResult.StdOut);
+				result.StdErr = std::move(builtInResult.StdErr);
+
+				ReleaseResources(node);
+				CompleteNode(index, std::move(result));
+				return;
+			}
+
+			auto program = Path(node.GetProgram());
+			auto message = "Execute: " + program.ToString() + " " + node.GetArguments();
+			Log::Diag(message);
+
+			if (_scheduler.GetLimits().MaxParallelism <= 1)
+			{
+				// Run inline when there is no parallelism
+				auto result = ExecuteProcess(
+					program,
+					node.GetArguments(),
+					Path(node.GetWorkingDirectory()));
+				ReleaseResources(node);
+				CompleteNode(index, std::move(result));
+			}
+			else
+			{
+				auto arguments = std::string(node.GetArguments());
+				auto workingDirectory = Path(node.GetWorkingDirectory());
+				_runningJobs.emplace(
+					index,
+					std::thread([this, index, program, arguments, workingDirectory]()
 					{
-						// Build the input closure for all source files
-						auto inputFilePath = Path(inputFile);
-						if (inputFilePath.GetFileExtension() == ".cpp")
+						auto completedJob = CompletedJob({ index, ProcessResult(), nullptr });
+						try
 						{
-							if (!_buildHistory.TryBuildIncludeClosure(inputFilePath, inputClosure))
-							{
-								// Could not determine the set of input files, not enough info to perform incremental build
-								buildRequired = true;
-								break;
-							}
+							completedJob.Result = ExecuteProcess(
+								program,
+								arguments,
+								workingDirectory);
 						}
-					}
-
-					// If we were able to load all of the build history then perform the timestamp checks
-					if (!buildRequired)
-					{
-						// Include the source files itself
-						inputClosure.insert(inputClosure.end(), inputFiles.begin(), inputFiles.end());
-
-						// Load the output files
-						auto outputFiles = std::vector<Path>();
-						for (auto& file : node.GetOutputFiles())
-							outputFiles.push_back(Path(file));
-
-						// Check if any of the input files have changed since last build
-						if (_stateChecker.IsOutdated(
-							outputFiles,
-							inputClosure,
-							Path(node.GetWorkingDirectory())))
+						catch (...)
 						{
-							// The file or a dependency has changed
-							buildRequired = true;
+							completedJob.Exception = std::current_exception();
 						}
-						else
+
 						{
-							Log::Info("Up to date");
+							auto lock = std::lock_guard<std::mutex>(_completedMutex);
+							_completedJobs.push_back(std::move(completedJob));
 						}
-					}
-				}
-				else
+
+						_completedCondition.notify_one();
+					}));
+			}
+		}
+
+		/// <summary>
+		/// Generated files have no inputs to compare against, so always run the write
+		/// and let it decide: the file (and its timestamp) is only touched when the
+		/// content changed and only then are the children forced to build
+		/// </summary>
+		void StartWriteFileNode(
+			uint32_t index,
+			bool forceBuild)
+		{
+			auto& node = _plan.GetNode(index);
+			Log::Diag("Execute: " + std::string(node.GetProgram()) + " " + node.GetArguments());
+			auto builtInResult = BuiltInOperationRunner::Execute(
+				Extensions::BuiltInOperation::WriteFile,
+				node.GetArguments(),
+				Path(node.GetWorkingDirectory()));
+			ReleaseResources(node);
+
+			if (builtInResult.ExitCode == 0 && !builtInResult.Changed && !forceBuild)
+			{
+				Log::Info(node.GetTitle());
+
+				// Notify the children that this node is complete
+				QueueChildren(index, false);
+				return;
+			}
+
+			Log::HighPriority(node.GetTitle());
+			if (_explanationLog != nullptr)
+			{
+				auto explanation = forceBuild ?
+					GetForceBuildExplanation(index) :
+					RebuildExplanation({ RebuildReason::ContentChanged, std::string() });
+				_explanationLog->Report(node.GetTitle(), explanation);
+			}
+
+			auto result = ProcessResult();
+			result.ExitCode = builtInResult.ExitCode;
+			result.StdOut = std::move(builtInResult.StdOut);
+			result.StdErr = std::move(builtInResult.StdErr);
+			CompleteNode(index, std::move(result));
+		}
+
+		/// <summary>
+		/// Explain why a node is built without checking if it is out of date
+		/// </summary>
+		RebuildExplanation GetForceBuildExplanation(uint32_t index)
+		{
+			auto parentIndex = _forcedBy[index];
+			if (parentIndex != NoParent)
+				return RebuildExplanation({ RebuildReason::ForcedByParent, _plan.GetNode(parentIndex).GetTitle() });
+
+			return RebuildExplanation({ _packages[_plan.GetPackage(index)].ForceReason, std::string() });
+		}
+
+		/// <summary>
+		/// Check if a single build node is out of date
+		/// </summary>
+		bool CheckBuildRequired(uint32_t index, RebuildExplanation& explanation)
+		{
+			auto& node = _plan.GetNode(index);
+			bool buildRequired = false;
+
+			// Check if each source file is out of date and requires a rebuild
+			Log::Diag("Check for updated source");
+			
+			// Try to build up the closure of include dependencies
+			const auto& inputFiles = node.GetInputFiles();
+			if (!inputFiles.empty())
+			{
+				auto inputClosure = std::vector<Path>();
+
+				// TODO: Is this how we want to handle no input nodes?
+				// If there are source files to the node check their build state
+				for (auto& inputFile : inputFiles)
 				{
-					// Since there are no input files, the best we can do for an
-					// incremental build is check that the output exists
-					for (auto& file : node.GetOutputFiles())
+					// Build the input closure for all source files
+					auto inputFilePath = Path(inputFile);
+					if (inputFilePath.GetFileExtension() == ".cpp")
 					{
-						auto filePath = Path(file);
-						auto relativeOutputFile = filePath.HasRoot() ? filePath : Path(node.GetWorkingDirectory()) + filePath;
-						if (!System::IFileSystem::Current().Exists(relativeOutputFile))
+						if (!GetBuildHistory(index).TryBuildIncludeClosure(inputFilePath, inputClosure))
 						{
-							Log::Info("Output target does not exist: " + relativeOutputFile.ToString());
+							// Could not determine the set of input files, not enough info to perform incremental build
+							explanation = RebuildExplanation({ RebuildReason::ClosureUnavailable, inputFilePath.ToString() });
 							buildRequired = true;
 							break;
 						}
 					}
 				}
-			}
 
-			if (buildRequired)
-			{
-				Log::HighPriority(node.GetTitle());
-				auto program = Path(node.GetProgram());
-				auto message = "Execute: " + program.ToString() + " " + node.GetArguments();
-				Log::Diag(message);
-				auto result = System::IProcessManager::Current().Execute(
-					program,
-					node.GetArguments(),
-					Path(node.GetWorkingDirectory()));
-
-				// Try parse includes if available
-				auto cleanOutput = std::stringstream();
-				auto headerIncludes = std::vector<HeaderInclude>();
-				if (TryParsesHeaderIncludes(node, result.StdOut, headerIncludes, cleanOutput))
+				// If we were able to load all of the build history then perform the timestamp checks
+				if (!buildRequired)
 				{
-					// Save off the build history for future builds
-					_buildHistory.UpdateIncludeTree(headerIncludes);
-
-					// Replace the output string with the clean version
-					result.StdOut = cleanOutput.str();
-				}
+					// Include the source files itself
+					inputClosure.insert(inputClosure.end(), inputFiles.begin(), inputFiles.end());
 
-				if (!result.StdOut.empty())
-				{
-					// Upgrade output to a warning if the command fails
-					if (result.ExitCode != 0)
-						Log::Warning(result.StdOut);
+					// Load the output files
+					auto outputFiles = std::vector<Path>();
+					for (auto& file : node.GetOutputFiles())
+						outputFiles.push_back(Path(file));
+
+					// Check if any of the input files have changed since last build
+					if (_stateChecker.IsOutdated(
+						outputFiles,
+						inputClosure,
+						Path(node.GetWorkingDirectory()),
+						explanation))
+					{
+						// The file or a dependency has changed
+						buildRequired = true;
+					}
 					else
-						Log::Info(result.StdOut);
+					{
+						Log::Info("Up to date");
+					}
 				}
-
-				// If there was any error output then the build failed
-				// TODO: Find warnings + errors
-				if (!result.StdErr.empty())
+			}
+			else
+			{
+				// Since there are no input files, the best we can do for an
+				// incremental build is check that the output exists
+				for (auto& file : node.GetOutputFiles())
 				{
-					Log::Error(result.StdErr);
+					auto filePath = Path(file);
+					auto relativeOutputFile = filePath.HasRoot() ? filePath : Path(node.GetWorkingDirectory()) + filePath;
+					if (!System::IFileSystem::Current().Exists(relativeOutputFile))
+					{
+						Log::Info("Output target does not exist: " + relativeOutputFile.ToString());
+						explanation = RebuildExplanation({ RebuildReason::MissingOutput, relativeOutputFile.ToString() });
+						buildRequired = true;
+						break;
+					}
 				}
+			}
+
+			return buildRequired;
+		}
+
+		/// <summary>
+		/// Handle the results of an executed build node and queue its children
+		/// </summary>
+		void CompleteNode(
+			uint32_t index,
+			ProcessResult result)
+		{
+			auto& node = _plan.GetNode(index);
+			// Try parse includes if available
+			auto cleanOutput = std::stringstream();
+			auto headerIncludes = std::vector<HeaderInclude>();
+			if (TryParsesHeaderIncludes(node, result.StdOut, headerIncludes, cleanOutput))
+			{
+				// Save off the build history for future builds
+				GetBuildHistory(index).UpdateIncludeTree(headerIncludes);
+
+				// Replace the output string with the clean version
+				result.StdOut = cleanOutput.str();
+			}
 
+			if (!result.StdOut.empty())
+			{
+				// Upgrade output to a warning if the command fails
 				if (result.ExitCode != 0)
+					Log::Warning(result.StdOut);
+				else
+					Log::Info(result.StdOut);
+			}
+
+			// If there was any error output then the build failed
+			// TODO: Find warnings + errors
+			if (!result.StdErr.empty())
+			{
+				Log::Error(result.StdErr);
+			}
+
+			if (result.ExitCode != 0)
+			{
+				throw std::runtime_error("Compiler Object Error: " + std::to_string(result.ExitCode));
+			}
+
+			// Notify the children that this node is complete
+			// Note: Force build if this node was built
+			QueueChildren(index, true);
+		}
+
+		/// <summary>
+		/// Notify the children of a completed node, including the nodes in other packages that consume its output
+		/// Note: The package children come first in the plan so they stay at the front of the ready list
+		/// </summary>
+		void QueueChildren(
+			uint32_t index,
+			bool forceBuild)
+		{
+			QueueReadyNodes(_plan.GetChildren(index), forceBuild, index);
+		}
+
+		/// <summary>
+		/// Complete all of the jobs that have finished on worker threads
+		/// </summary>
+		void ProcessCompletedJobs()
+		{
+			auto completedJobs = std::deque<CompletedJob>();
+			{
+				auto lock = std::lock_guard<std::mutex>(_completedMutex);
+				std::swap(completedJobs, _completedJobs);
+			}
+
+			for (auto& completedJob : completedJobs)
+			{
+				auto& node = _plan.GetNode(completedJob.Index);
+				auto runningJob = _runningJobs.find(completedJob.Index);
+				if (runningJob != _runningJobs.end())
 				{
-					throw std::runtime_error("Compiler Object Error: " + std::to_string(result.ExitCode));
+					runningJob->second.join();
+					_runningJobs.erase(runningJob);
 				}
+
+				ReleaseResources(node);
+
+				if (completedJob.Exception != nullptr)
+					std::rethrow_exception(completedJob.Exception);
+
+				CompleteNode(completedJob.Index, std::move(completedJob.Result));
 			}
-			else
+		}
+
+		void WaitForCompletedJob()
+		{
+			auto lock = std::unique_lock<std::mutex>(_completedMutex);
+			_completedCondition.wait(lock, [this]() { return !_completedJobs.empty(); });
+		}
+
+		/// <summary>
+		/// Join all of the running jobs and release their resources
+		/// Note: Jobs that completed but were never processed are still in the running set
+		/// </summary>
+		void WaitForRunningJobs()
+		{
+			for (auto& [index, runningJob] : _runningJobs)
 			{
-				Log::Info(node.GetTitle());
+				if (runningJob.joinable())
+					runningJob.join();
+
+				ReleaseResources(_plan.GetNode(index));
 			}
 
-			// Recursively build all of the node chilren
-			// Note: Force build if this node was built
-			CheckExecuteNodes(node.GetChildren(), buildRequired);
+			_runningJobs.clear();
+
+			auto lock = std::lock_guard<std::mutex>(_completedMutex);
+			_completedJobs.clear();
+		}
+
+		ProcessResult ExecuteProcess(
+			const Path& program,
+			const std::string& arguments,
+			const Path& workingDirectory)
+		{
+			if (_executeProcess != nullptr)
+				return _executeProcess(program, arguments, workingDirectory);
+			else
+				return System::IProcessManager::Current().Execute(program, arguments, workingDirectory);
+		}
+
+		void ReleaseResources(const Runtime::BuildGraphNode& node)
+		{
+			auto resourceClass = static_cast<ResourceClass>(node.GetResourceClass());
+			_scheduler.Release(resourceClass, node.GetMemoryWeight(), node.GetThreadCount());
 		}
 
 		bool TryParsesHeaderIncludes(
@@ -263,22 +729,34 @@ namespace Soup::Build
 		{
 			// Check for any cpp input files
 			auto program = Path(node.GetProgram());
+			auto sourceFiles = std::vector<Path>();
 			for (auto& inputFile : node.GetInputFiles())
 			{
 				auto inputFilePath = Path(inputFile);
 				if (inputFilePath.GetFileExtension() == ".cpp")
 				{
-					// Parse known compiler output
-					if (program.GetFileName() == "cl.exe")
-					{
-						headerIncludes = ParseMSVCIncludes(inputFilePath, output, cleanOutput);
-						return true;
-					}
-					else if (program.GetFileName() == "clang++.exe")
-					{
-						headerIncludes = ParseMSVCIncludes(inputFilePath, output, cleanOutput);
-						return true;
-					}
+					sourceFiles.push_back(std::move(inputFilePath));
+				}
+			}
+
+			if (sourceFiles.size() > 1 && program.GetFileName() == "cl.exe")
+			{
+				// A batched compile echoes each source file name before its own output
+				headerIncludes = ParseMSVCBatchIncludes(sourceFiles, output, cleanOutput);
+				return true;
+			}
+			else if (!sourceFiles.empty())
+			{
+				// Parse known compiler output
+				if (program.GetFileName() == "cl.exe")
+				{
+					headerIncludes = ParseMSVCIncludes(sourceFiles[0], output, cleanOutput);
+					return true;
+				}
+				else if (program.GetFileName() == "clang++.exe")
+				{
+					headerIncludes = ParseMSVCIncludes(sourceFiles[0], output, cleanOutput);
+					return true;
 				}
 			}
 
@@ -286,6 +764,66 @@ namespace Soup::Build
 			return false;
 		}
 
+		/// <summary>
+		/// Split the output of a batched compile into the section for each source file
+		/// and attribute the includes to the file that was being compiled
+		/// </summary>
+		std::vector<HeaderInclude> ParseMSVCBatchIncludes(
+			const std::vector<Path>& sourceFiles,
+			const std::string& output,
+			std::stringstream& cleanOutput)
+		{
+			// The compiler only echoes the file name, leave the output of files that share a name unattributed
+			auto sourceFileNames = std::map<std::string, const Path*>();
+			for (auto& file : sourceFiles)
+			{
+				auto insertResult = sourceFileNames.emplace(file.GetFileName(), &file);
+				if (!insertResult.second)
+					insertResult.first->second = nullptr;
+			}
+
+			auto result = std::vector<HeaderInclude>();
+			const Path* currentFile = nullptr;
+			auto currentOutput = std::stringstream();
+			auto flushCurrent = [&]()
+			{
+				if (currentFile != nullptr)
+				{
+					auto includes = ParseMSVCIncludes(*currentFile, currentOutput.str(), cleanOutput);
+					std::move(includes.begin(), includes.end(), std::back_inserter(result));
+				}
+				else
+				{
+					cleanOutput << currentOutput.str();
+				}
+
+				currentOutput = std::stringstream();
+			};
+
+			std::stringstream content(output);
+			std::string line;
+			while (std::getline(content, line))
+			{
+				if (!line.empty() && line[line.size() - 1] == '\r')
+				{
+					line.resize(line.size() - 1);
+				}
+
+				auto findFile = sourceFileNames.find(line);
+				if (findFile != sourceFileNames.end())
+				{
+					flushCurrent();
+					currentFile = findFile->second;
+				}
+
+				currentOutput << line << "\n";
+			}
+
+			flushCurrent();
+
+			return result;
+		}
+
 		std::vector<HeaderInclude> ParseClangIncludes(
 			const Path& file,
 			const std::string& output,
@@ -456,8 +994,20 @@ namespace Soup::Build
 
 	private:
 		Path _workingDirectory;
-		std::map<int64_t, int64_t> _dependencyCounts;
-		BuildHistory _buildHistory;
+		ExecuteProcessFunction _executeProcess;
+		RebuildExplanationLog* _explanationLog;
+		std::vector<PackageGraph> _packages;
+		BuildExecutionPlan _plan;
+		std::vector<uint32_t> _dependencyCounts;
+		std::vector<bool> _forceBuildState;
+		std::vector<uint32_t> _forcedBy;
 		BuildHistoryChecker _stateChecker;
+
+		BuildResourceScheduler _scheduler;
+		std::deque<ReadyNode> _readyNodes;
+		std::map<uint32_t, std::thread> _runningJobs;
+		std::deque<CompletedJob> _completedJobs;
+		std::mutex _completedMutex;
+		std::condition_variable _completedCondition;
 	};
 }
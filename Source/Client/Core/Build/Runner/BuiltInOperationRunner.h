@@ -0,0 +1,239 @@
+﻿// <copyright file="BuiltInOperationRunner.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// The result of a built in operation, mirrors the process result
+	/// </summary>
+	export struct BuiltInOperationResult
+	{
+		int ExitCode = 0;
+		std::string StdOut;
+		std::string StdErr;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether the operation modified its output
+		/// </summary>
+		bool Changed = true;
+	};
+
+	/// <summary>
+	/// Executes the built in graph node operations in process
+	/// </summary>
+	export class BuiltInOperationRunner
+	{
+	public:
+		/// <summary>
+		/// Execute the requested operation with arguments relative to the working directory
+		/// </summary>
+		static BuiltInOperationResult Execute(
+			Extensions::BuiltInOperation operation,
+			std::string_view arguments,
+			const Path& workingDirectory)
+		{
+			auto result = BuiltInOperationResult();
+			try
+			{
+				auto values = Extensions::ParseBuiltInArguments(arguments);
+
+				// Write file is the only operation with values that are not all paths
+				if (operation == Extensions::BuiltInOperation::WriteFile)
+				{
+					if (values.empty())
+						throw std::runtime_error("Built in operation expected a file argument.");
+
+					auto file = ResolvePath(values[0], workingDirectory);
+					result.Changed = WriteFileContents(file, std::vector<std::string>(values.begin() + 1, values.end()));
+					return result;
+				}
+
+				auto paths = std::vector<std::filesystem::path>();
+				for (auto& value : values)
+					paths.push_back(ResolvePath(value, workingDirectory));
+
+				switch (operation)
+				{
+					case Extensions::BuiltInOperation::MakeDirectory:
+						VerifyArgumentCount(paths, 1);
+						std::filesystem::create_directories(paths[0]);
+						break;
+					case Extensions::BuiltInOperation::Copy:
+						VerifyArgumentCount(paths, 2);
+						CopyFileContents(paths[0], paths[1]);
+						break;
+					case Extensions::BuiltInOperation::HardLink:
+						VerifyArgumentCount(paths, 2);
+						HardLinkFile(paths[0], paths[1]);
+						break;
+					case Extensions::BuiltInOperation::SymbolicLink:
+						VerifyArgumentCount(paths, 2);
+						SymbolicLinkFile(paths[0], paths[1]);
+						break;
+					default:
+						throw std::runtime_error("Unknown built in operation.");
+				}
+			}
+			catch (const std::exception& ex)
+			{
+				result.ExitCode = 1;
+				result.StdErr = ex.what();
+			}
+
+			return result;
+		}
+
+	private:
+		static std::filesystem::path ResolvePath(const std::string& value, const Path& workingDirectory)
+		{
+			auto path = Path(value);
+			if (!path.HasRoot())
+				path = workingDirectory + path;
+			return std::filesystem::path(path.ToString());
+		}
+
+		static void VerifyArgumentCount(const std::vector<std::filesystem::path>& paths, size_t count)
+		{
+			if (paths.size() != count)
+				throw std::runtime_error("Built in operation expected " + std::to_string(count) + " arguments.");
+		}
+
+		/// <summary>
+		/// Write the lines to the file, keep the existing file (and timestamp)
+		/// when the content already matches to avoid downstream rebuilds
+		/// Returns true if the file was written
+		/// </summary>
+		static bool WriteFileContents(const std::filesystem::path& file, const std::vector<std::string>& lines)
+		{
+			auto content = std::stringstream();
+			for (auto& line : lines)
+				content << line << "\n";
+
+			auto contentValue = content.str();
+			if (std::filesystem::exists(file))
+			{
+				auto existingFile = std::ifstream(file, std::ios::binary);
+				auto existingContent = std::string(
+					std::istreambuf_iterator<char>(existingFile),
+					std::istreambuf_iterator<char>());
+				if (existingContent == contentValue)
+					return false;
+			}
+
+			auto outputFile = std::ofstream(file, std::ios::binary | std::ios::trunc);
+			outputFile << contentValue;
+			if (!outputFile)
+				throw std::runtime_error("Failed to write file: " + file.string());
+
+			return true;
+		}
+
+		/// <summary>
+		/// Copy a single file, use a reflink or an in kernel copy when available
+		/// </summary>
+		static void CopyFileContents(const std::filesystem::path& source, const std::filesystem::path& destination)
+		{
+			RemoveExisting(destination);
+
+#ifdef __linux__
+			if (TryFastCopyFileContents(source, destination))
+				return;
+#endif
+
+			std::filesystem::copy_file(source, destination, std::filesystem::copy_options::overwrite_existing);
+		}
+
+		/// <summary>
+		/// Hard link a single file, fall back to a copy when the link is not possible
+		/// (cross device or unsupported file system)
+		/// </summary>
+		static void HardLinkFile(const std::filesystem::path& source, const std::filesystem::path& destination)
+		{
+			RemoveExisting(destination);
+
+			auto error = std::error_code();
+			std::filesystem::create_hard_link(source, destination, error);
+			if (error)
+				CopyFileContents(source, destination);
+		}
+
+		static void SymbolicLinkFile(const std::filesystem::path& source, const std::filesystem::path& destination)
+		{
+			RemoveExisting(destination);
+			std::filesystem::create_symlink(source, destination);
+		}
+
+		static void RemoveExisting(const std::filesystem::path& file)
+		{
+			auto error = std::error_code();
+			if (std::filesystem::is_symlink(std::filesystem::symlink_status(file, error)) ||
+				std::filesystem::exists(file, error))
+			{
+				std::filesystem::remove(file);
+			}
+		}
+
+#ifdef __linux__
+		/// <summary>
+		/// Attempt to clone the file extents (FICLONE) and otherwise let the
+		/// kernel copy the contents without a round trip through user space
+		/// </summary>
+		static bool TryFastCopyFileContents(const std::filesystem::path& source, const std::filesystem::path& destination)
+		{
+			int sourceDescriptor = open(source.c_str(), O_RDONLY | O_CLOEXEC);
+			if (sourceDescriptor < 0)
+				return false;
+
+			struct stat sourceStatus = {};
+			if (fstat(sourceDescriptor, &sourceStatus) != 0)
+			{
+				close(sourceDescriptor);
+				return false;
+			}
+
+			int destinationDescriptor = open(
+				destination.c_str(),
+				O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+				sourceStatus.st_mode & 0777);
+			if (destinationDescriptor < 0)
+			{
+				close(sourceDescriptor);
+				return false;
+			}
+
+			bool success = ioctl(destinationDescriptor, FICLONE, sourceDescriptor) == 0;
+			if (!success)
+			{
+				success = true;
+				auto remaining = static_cast<size_t>(sourceStatus.st_size);
+				while (remaining > 0)
+				{
+					auto copied = copy_file_range(sourceDescriptor, nullptr, destinationDescriptor, nullptr, remaining, 0);
+					if (copied < 0 && errno == EINTR)
+						continue;
+
+					if (copied <= 0)
+					{
+						success = false;
+						break;
+					}
+
+					remaining -= static_cast<size_t>(copied);
+				}
+			}
+
+			close(sourceDescriptor);
+			close(destinationDescriptor);
+
+			// Let the caller fall back to a regular copy
+			if (!success)
+				unlink(destination.c_str());
+
+			return success;
+		}
+#endif
+	};
+}
@@ -0,0 +1,29 @@
+﻿// <copyright file="IJobServer.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// A GNU make compatible job server that hands out tokens for concurrent work
+	/// Note: Every participant owns one implicit token that is never acquired,
+	/// only work beyond the first concurrent job must hold a token
+	/// </summary>
+	export class IJobServer
+	{
+	public:
+		virtual ~IJobServer() = default;
+
+		/// <summary>
+		/// Attempt to take a single token without blocking
+		/// </summary>
+		virtual bool TryAcquire() = 0;
+
+		/// <summary>
+		/// Return a single token that was previously acquired
+		/// </summary>
+		virtual void Release() = 0;
+	};
+}
@@ -0,0 +1,358 @@
+﻿// <copyright file="JobServer.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "IJobServer.h"
+#include "JobServerFlags.h"
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// The GNU make job server implementation for the current platform
+	/// Connects to a job server owned by a parent process or hosts a new one
+	/// that is shared with all child processes through MAKEFLAGS
+	/// Windows uses a named semaphore, all other platforms use a named fifo
+	/// </summary>
+	export class JobServer : public IJobServer
+	{
+	public:
+		/// <summary>
+		/// Attempt to connect to the job server described by the current MAKEFLAGS
+		/// </summary>
+		static std::shared_ptr<JobServer> TryConnectFromEnvironment()
+		{
+			auto makeFlags = std::getenv(JobServerFlags::EnvironmentVariable.data());
+			if (makeFlags == nullptr)
+				return nullptr;
+
+			auto auth = JobServerAuth();
+			if (!JobServerFlags::TryParse(makeFlags, auth))
+				return nullptr;
+
+			return TryConnect(auth);
+		}
+
+		/// <summary>
+		/// Attempt to connect to an existing job server
+		/// </summary>
+		static std::shared_ptr<JobServer> TryConnect(const JobServerAuth& auth)
+		{
+			auto result = std::shared_ptr<JobServer>(new JobServer(auth));
+			if (!result->Connect(auth))
+			{
+				Log::Warning("Unable to connect to job server: " + JobServerFlags::Format(auth));
+				return nullptr;
+			}
+
+			Log::Diag("Connected to job server: " + JobServerFlags::Format(auth));
+			return result;
+		}
+
+		/// <summary>
+		/// Attempt to host a new job server with the requested total job count and
+		/// publish it in MAKEFLAGS so that all child processes share the same budget
+		/// </summary>
+		static std::shared_ptr<JobServer> TryCreate(uint32_t jobCount)
+		{
+			if (jobCount <= 1)
+				return nullptr;
+
+			auto auth = JobServerAuth();
+			auth.JobCount = jobCount;
+			auto result = std::shared_ptr<JobServer>(new JobServer(auth));
+			if (!result->Host(auth))
+			{
+				Log::Warning("Unable to create job server");
+				return nullptr;
+			}
+
+			result->PublishEnvironment();
+			Log::Diag("Created job server: " + JobServerFlags::Format(result->_auth));
+			return result;
+		}
+
+		JobServer(const JobServer&) = delete;
+		JobServer& operator=(const JobServer&) = delete;
+
+		~JobServer()
+		{
+			// Return any tokens that are still held
+			while (!_tokens.empty())
+				Release();
+
+			RestoreEnvironment();
+			Close();
+		}
+
+		const JobServerAuth& GetAuth() const
+		{
+			return _auth;
+		}
+
+		bool TryAcquire() override final
+		{
+			char token = 0;
+			if (!TryReadToken(token))
+				return false;
+
+			_tokens.push_back(token);
+			return true;
+		}
+
+		void Release() override final
+		{
+			if (_tokens.empty())
+				throw std::runtime_error("Released a job server token that was never acquired.");
+
+			auto token = _tokens.back();
+			_tokens.pop_back();
+			WriteToken(token);
+		}
+
+	private:
+		JobServer(const JobServerAuth& auth) :
+			_auth(auth),
+			_isOwner(false),
+			_tokens(),
+			_hasPreviousMakeFlags(false),
+			_previousMakeFlags(),
+			_isPublished(false)
+		{
+		}
+
+		void PublishEnvironment()
+		{
+			auto previous = std::getenv(JobServerFlags::EnvironmentVariable.data());
+			_hasPreviousMakeFlags = previous != nullptr;
+			if (_hasPreviousMakeFlags)
+				_previousMakeFlags = previous;
+
+			// Keep any flags the parent passed down, only replace the job server connection
+			SetEnvironment(JobServerFlags::Merge(_hasPreviousMakeFlags ? _previousMakeFlags : "", _auth));
+			_isPublished = true;
+		}
+
+		void RestoreEnvironment()
+		{
+			if (!_isPublished)
+				return;
+
+			if (_hasPreviousMakeFlags)
+				SetEnvironment(_previousMakeFlags);
+			else
+				ClearEnvironment();
+
+			_isPublished = false;
+		}
+
+#ifdef _WIN32
+		bool Connect(const JobServerAuth& auth)
+		{
+			if (auth.Type != JobServerType::Semaphore)
+				return false;
+
+			_semaphore = OpenSemaphoreA(
+				SEMAPHORE_MODIFY_STATE | SYNCHRONIZE,
+				FALSE,
+				auth.Name.c_str());
+			return _semaphore != nullptr;
+		}
+
+		bool Host(JobServerAuth& auth)
+		{
+			auto tokenCount = static_cast<LONG>(auth.JobCount - 1);
+			auth.Type = JobServerType::Semaphore;
+			auth.Name = "soup_jobserver_" + std::to_string(GetCurrentProcessId());
+			_semaphore = CreateSemaphoreA(nullptr, tokenCount, tokenCount, auth.Name.c_str());
+			if (_semaphore == nullptr)
+				return false;
+
+			_auth = auth;
+			_isOwner = true;
+			return true;
+		}
+
+		void Close()
+		{
+			if (_semaphore != nullptr)
+			{
+				CloseHandle(_semaphore);
+				_semaphore = nullptr;
+			}
+		}
+
+		bool TryReadToken(char& token)
+		{
+			// Semaphore tokens have no value, use the default make token
+			token = '+';
+			return WaitForSingleObject(_semaphore, 0) == WAIT_OBJECT_0;
+		}
+
+		void WriteToken(char)
+		{
+			if (!ReleaseSemaphore(_semaphore, 1, nullptr))
+				throw std::runtime_error("Failed to release job server token.");
+		}
+
+		static void SetEnvironment(const std::string& value)
+		{
+			_putenv_s(JobServerFlags::EnvironmentVariable.data(), value.c_str());
+		}
+
+		static void ClearEnvironment()
+		{
+			_putenv_s(JobServerFlags::EnvironmentVariable.data(), "");
+		}
+
+	private:
+		HANDLE _semaphore = nullptr;
+#else
+		bool Connect(const JobServerAuth& auth)
+		{
+			switch (auth.Type)
+			{
+				case JobServerType::Fifo:
+					// Open private descriptors so that non-blocking reads do not
+					// change the behavior of other processes sharing the fifo
+					_readDescriptor = open(auth.Name.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+					_writeDescriptor = open(auth.Name.c_str(), O_WRONLY | O_CLOEXEC);
+					break;
+				case JobServerType::Pipe:
+				{
+					// Reopen the inherited read end to get a private non-blocking
+					// description, otherwise make the shared one non-blocking
+					// (GNU make already expects EAGAIN on the job server pipe)
+					auto readPath = "/proc/self/fd/" + std::to_string(auth.ReadDescriptor);
+					_readDescriptor = open(readPath.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+					if (_readDescriptor < 0)
+					{
+						if (fcntl(auth.ReadDescriptor, F_GETFD) < 0)
+							return false;
+						_readDescriptor = fcntl(auth.ReadDescriptor, F_DUPFD_CLOEXEC, 0);
+						if (_readDescriptor < 0)
+							return false;
+						auto flags = fcntl(_readDescriptor, F_GETFL);
+						if (flags < 0 || fcntl(_readDescriptor, F_SETFL, flags | O_NONBLOCK) < 0)
+							return false;
+					}
+
+					_writeDescriptor = dup(auth.WriteDescriptor);
+					break;
+				}
+				default:
+					return false;
+			}
+
+			return _readDescriptor >= 0 && _writeDescriptor >= 0;
+		}
+
+		bool Host(JobServerAuth& auth)
+		{
+			// Create the fifo inside a fresh private directory so a stale fifo left
+			// behind by a crashed process with a recycled pid can never collide
+			auto temporaryDirectory = std::getenv("TMPDIR");
+			auto directoryTemplate = std::string(temporaryDirectory != nullptr ? temporaryDirectory : "/tmp") +
+				"/soup_jobserver_XXXXXX";
+			if (mkdtemp(directoryTemplate.data()) == nullptr)
+				return false;
+
+			_hostDirectory = directoryTemplate;
+			auto fifoPath = _hostDirectory + "/fifo";
+			if (mkfifo(fifoPath.c_str(), 0600) != 0)
+			{
+				rmdir(_hostDirectory.c_str());
+				_hostDirectory.clear();
+				return false;
+			}
+
+			auth.Type = JobServerType::Fifo;
+			auth.Name = fifoPath;
+			_auth = auth;
+			_isOwner = true;
+
+			// Open the read end first without blocking so the write end can be opened
+			_readDescriptor = open(fifoPath.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+			_writeDescriptor = open(fifoPath.c_str(), O_WRONLY | O_CLOEXEC);
+			if (_readDescriptor < 0 || _writeDescriptor < 0)
+				return false;
+
+			// Fill the fifo with one token per job, minus the implicit one we own
+			for (uint32_t i = 1; i < auth.JobCount; i++)
+				WriteToken('+');
+
+			return true;
+		}
+
+		void Close()
+		{
+			if (_readDescriptor >= 0)
+			{
+				close(_readDescriptor);
+				_readDescriptor = -1;
+			}
+
+			if (_writeDescriptor >= 0)
+			{
+				close(_writeDescriptor);
+				_writeDescriptor = -1;
+			}
+
+			if (_isOwner)
+			{
+				unlink(_auth.Name.c_str());
+				rmdir(_hostDirectory.c_str());
+				_hostDirectory.clear();
+				_isOwner = false;
+			}
+		}
+
+		bool TryReadToken(char& token)
+		{
+			// The read descriptor is always non-blocking, EAGAIN means no token is available
+			ssize_t result = 0;
+			do
+			{
+				result = read(_readDescriptor, &token, 1);
+			} while (result < 0 && errno == EINTR);
+
+			return result == 1;
+		}
+
+		void WriteToken(char token)
+		{
+			ssize_t result = 0;
+			do
+			{
+				result = write(_writeDescriptor, &token, 1);
+			} while (result < 0 && errno == EINTR);
+
+			if (result != 1)
+				throw std::runtime_error("Failed to release job server token.");
+		}
+
+		static void SetEnvironment(const std::string& value)
+		{
+			setenv(JobServerFlags::EnvironmentVariable.data(), value.c_str(), 1);
+		}
+
+		static void ClearEnvironment()
+		{
+			unsetenv(JobServerFlags::EnvironmentVariable.data());
+		}
+
+	private:
+		int _readDescriptor = -1;
+		int _writeDescriptor = -1;
+		std::string _hostDirectory;
+#endif
+
+	private:
+		JobServerAuth _auth;
+		bool _isOwner;
+		std::vector<char> _tokens;
+		bool _hasPreviousMakeFlags;
+		std::string _previousMakeFlags;
+		bool _isPublished;
+	};
+}
@@ -0,0 +1,235 @@
+﻿// <copyright file="JobServerFlags.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// The transport used to share the job server tokens
+	/// </summary>
+	export enum class JobServerType
+	{
+		Fifo,
+		Pipe,
+		Semaphore,
+	};
+
+	/// <summary>
+	/// The job server connection information passed through MAKEFLAGS
+	/// </summary>
+	export struct JobServerAuth
+	{
+		JobServerType Type = JobServerType::Fifo;
+
+		/// <summary>
+		/// Gets or sets the named fifo path or named semaphore
+		/// </summary>
+		std::string Name;
+
+		/// <summary>
+		/// Gets or sets the inherited pipe file descriptors
+		/// </summary>
+		int ReadDescriptor = -1;
+		int WriteDescriptor = -1;
+
+		/// <summary>
+		/// Gets or sets the total job count (-j) if known, otherwise zero
+		/// </summary>
+		uint32_t JobCount = 0;
+
+		bool operator ==(const JobServerAuth& rhs) const
+		{
+			return Type == rhs.Type &&
+				Name == rhs.Name &&
+				ReadDescriptor == rhs.ReadDescriptor &&
+				WriteDescriptor == rhs.WriteDescriptor &&
+				JobCount == rhs.JobCount;
+		}
+	};
+
+	/// <summary>
+	/// Parse and format the job server section of the MAKEFLAGS environment variable
+	/// </summary>
+	export class JobServerFlags
+	{
+	public:
+		static constexpr std::string_view EnvironmentVariable = "MAKEFLAGS";
+
+		/// <summary>
+		/// Attempt to find the job server connection in the provided make flags
+		/// Supports: --jobserver-auth=fifo:PATH, --jobserver-auth=R,W,
+		/// --jobserver-fds=R,W and --jobserver-auth=SEMAPHORE (Windows)
+		/// </summary>
+		static bool TryParse(std::string_view makeFlags, JobServerAuth& result)
+		{
+			bool hasAuth = false;
+			auto jobCount = uint32_t(0);
+			auto stream = std::stringstream(std::string(makeFlags));
+			auto flag = std::string();
+			while (stream >> flag)
+			{
+				if (flag.rfind("-j", 0) == 0 && flag.size() > 2 && flag.rfind("--", 0) != 0)
+				{
+					// The job count, last one wins
+					if (!TryParseUInt(std::string_view(flag).substr(2), jobCount))
+						jobCount = 0;
+				}
+				else if (flag.rfind("--jobserver-auth=", 0) == 0)
+				{
+					hasAuth = TryParseAuth(
+						std::string_view(flag).substr(std::string_view("--jobserver-auth=").size()),
+						result);
+				}
+				else if (flag.rfind("--jobserver-fds=", 0) == 0)
+				{
+					hasAuth = TryParseAuth(
+						std::string_view(flag).substr(std::string_view("--jobserver-fds=").size()),
+						result);
+				}
+			}
+
+			if (hasAuth)
+				result.JobCount = jobCount;
+
+			return hasAuth;
+		}
+
+		/// <summary>
+		/// Create the make flags that allow child processes to connect to the job server
+		/// </summary>
+		static std::string Format(const JobServerAuth& auth)
+		{
+			auto stream = std::stringstream();
+			if (auth.JobCount > 0)
+				stream << "-j" << auth.JobCount << " ";
+
+			stream << "--jobserver-auth=";
+			switch (auth.Type)
+			{
+				case JobServerType::Fifo:
+					stream << "fifo:" << auth.Name;
+					break;
+				case JobServerType::Pipe:
+					stream << auth.ReadDescriptor << "," << auth.WriteDescriptor;
+					break;
+				case JobServerType::Semaphore:
+					stream << auth.Name;
+					break;
+				default:
+					throw std::runtime_error("Unknown job server type.");
+			}
+
+			return stream.str();
+		}
+
+		/// <summary>
+		/// Replace the job count and job server connection in existing make flags
+		/// while keeping every other flag and any trailing variable overrides
+		/// </summary>
+		static std::string Merge(std::string_view makeFlags, const JobServerAuth& auth)
+		{
+			auto flags = std::vector<std::string>();
+			auto overrides = std::vector<std::string>();
+			bool isOverride = false;
+			auto stream = std::stringstream(std::string(makeFlags));
+			auto flag = std::string();
+			while (stream >> flag)
+			{
+				if (isOverride)
+				{
+					overrides.push_back(std::move(flag));
+				}
+				else if (flag == "--")
+				{
+					isOverride = true;
+				}
+				else if (!IsJobServerFlag(flag))
+				{
+					flags.push_back(std::move(flag));
+				}
+			}
+
+			flags.push_back(Format(auth));
+
+			auto result = std::stringstream();
+			for (size_t i = 0; i < flags.size(); i++)
+			{
+				if (i > 0)
+					result << " ";
+				result << flags[i];
+			}
+
+			if (isOverride)
+			{
+				result << " --";
+				for (auto& value : overrides)
+					result << " " << value;
+			}
+
+			return result.str();
+		}
+
+	private:
+		static bool IsJobServerFlag(std::string_view flag)
+		{
+			return (flag.rfind("-j", 0) == 0 && flag.rfind("--", 0) != 0) ||
+				flag.rfind("--jobserver-auth=", 0) == 0 ||
+				flag.rfind("--jobserver-fds=", 0) == 0;
+		}
+
+		static bool TryParseAuth(std::string_view value, JobServerAuth& result)
+		{
+			auto fifoPrefix = std::string_view("fifo:");
+			if (value.rfind(fifoPrefix, 0) == 0)
+			{
+				result.Type = JobServerType::Fifo;
+				result.Name = std::string(value.substr(fifoPrefix.size()));
+				return !result.Name.empty();
+			}
+
+			auto separator = value.find(',');
+			if (separator != std::string_view::npos)
+			{
+				uint32_t readDescriptor = 0;
+				uint32_t writeDescriptor = 0;
+				if (!TryParseUInt(value.substr(0, separator), readDescriptor) ||
+					!TryParseUInt(value.substr(separator + 1), writeDescriptor))
+				{
+					// Negative descriptors mean the parent closed the pipe for this child
+					return false;
+				}
+
+				result.Type = JobServerType::Pipe;
+				result.ReadDescriptor = static_cast<int>(readDescriptor);
+				result.WriteDescriptor = static_cast<int>(writeDescriptor);
+				return true;
+			}
+
+			if (value.empty())
+				return false;
+
+			result.Type = JobServerType::Semaphore;
+			result.Name = std::string(value);
+			return true;
+		}
+
+		static bool TryParseUInt(std::string_view value, uint32_t& result)
+		{
+			if (value.empty())
+				return false;
+
+			uint32_t current = 0;
+			for (auto character : value)
+			{
+				if (character < '0' || character > '9')
+					return false;
+				current = current * 10 + (character - '0');
+			}
+
+			result = current;
+			return true;
+		}
+	};
+}
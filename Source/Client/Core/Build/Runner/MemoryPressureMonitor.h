@@ -0,0 +1,116 @@
+﻿// <copyright file="MemoryPressureMonitor.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// Samples the Linux pressure stall information for memory to allow the
+	/// build runner to back off before the machine starts swapping
+	/// </summary>
+	export class MemoryPressureMonitor
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="MemoryPressureMonitor"/> class.
+		/// </summary>
+		MemoryPressureMonitor() :
+			_pressureFile("/proc/pressure/memory"),
+			_sampleInterval(std::chrono::milliseconds(250)),
+			_isAvailable(true),
+			_hasSample(false),
+			_lastSampleTime(),
+			_lastValue(0)
+		{
+		}
+
+		/// <summary>
+		/// Get the percentage of time some tasks were stalled on memory over the last ten seconds
+		/// Returns false if the pressure information is not available on this system
+		/// </summary>
+		bool TryGetPressure(double& result)
+		{
+			if (!_isAvailable)
+				return false;
+
+			auto now = std::chrono::steady_clock::now();
+			if (!_hasSample || now - _lastSampleTime >= _sampleInterval)
+			{
+				if (!TrySample(_lastValue))
+				{
+					// Stop checking once we know the kernel does not support it
+					_isAvailable = false;
+					return false;
+				}
+
+				_hasSample = true;
+				_lastSampleTime = now;
+			}
+
+			result = _lastValue;
+			return true;
+		}
+
+		/// <summary>
+		/// Parse the contents of the pressure file
+		/// Format: some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+		/// </summary>
+		static bool TryParsePressure(std::istream& content, double& result)
+		{
+			auto line = std::string();
+			while (std::getline(content, line))
+			{
+				if (line.rfind("some ", 0) != 0)
+					continue;
+
+				auto averageKey = std::string_view("avg10=");
+				auto averageStart = line.find(averageKey);
+				if (averageStart == std::string::npos)
+					return false;
+
+				auto valueStart = averageStart + averageKey.size();
+				auto valueEnd = line.find(' ', valueStart);
+				auto value = line.substr(valueStart, valueEnd - valueStart);
+
+				try
+				{
+					result = std::stod(value);
+					return true;
+				}
+				catch (...)
+				{
+					return false;
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		bool TrySample(double& result)
+		{
+			try
+			{
+				if (!System::IFileSystem::Current().Exists(_pressureFile))
+					return false;
+
+				auto file = System::IFileSystem::Current().OpenRead(_pressureFile, false);
+				return TryParsePressure(file->GetInStream(), result);
+			}
+			catch (...)
+			{
+				return false;
+			}
+		}
+
+	private:
+		Path _pressureFile;
+		std::chrono::steady_clock::duration _sampleInterval;
+		bool _isAvailable;
+		bool _hasSample;
+		std::chrono::steady_clock::time_point _lastSampleTime;
+		double _lastValue;
+	};
+}
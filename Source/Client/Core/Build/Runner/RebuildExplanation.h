@@ -0,0 +1,107 @@
+﻿// <copyright file="RebuildExplanation.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build
+{
+	/// <summary>
+	/// The decisive reason a build node was executed
+	/// </summary>
+	export enum class RebuildReason
+	{
+		ForceRebuild,
+		MissingHistory,
+		ForcedByParent,
+		ClosureUnavailable,
+		MissingOutput,
+		MissingInput,
+		InputNewer,
+		ContentChanged,
+	};
+
+	/// <summary>
+	/// The reason a build node was executed along with the file or node that decided it
+	/// </summary>
+	export struct RebuildExplanation
+	{
+		RebuildReason Reason;
+		std::string Detail;
+	};
+
+	/// <summary>
+	/// Reports the reason for each executed build node and the totals for each reason
+	/// </summary>
+	export class RebuildExplanationLog
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="RebuildExplanationLog"/> class.
+		/// </summary>
+		RebuildExplanationLog() :
+			_counts()
+		{
+		}
+
+		/// <summary>
+		/// Report the reason a single node is executed
+		/// </summary>
+		void Report(const std::string& title, const RebuildExplanation& explanation)
+		{
+			auto message = "Explain: " + title + ": " + std::string(ToString(explanation.Reason));
+			if (!explanation.Detail.empty())
+				message += " [" + explanation.Detail + "]";
+
+			Log::HighPriority(message);
+			_counts[explanation.Reason]++;
+		}
+
+		/// <summary>
+		/// Report the number of executed nodes for each reason
+		/// </summary>
+		void ReportSummary() const
+		{
+			uint64_t total = 0;
+			for (auto& [reason, count] : _counts)
+				total += count;
+
+			Log::HighPriority("Explain: " + std::to_string(total) + " operations executed");
+			for (auto& [reason, count] : _counts)
+			{
+				Log::HighPriority("  " + std::string(ToString(reason)) + ": " + std::to_string(count));
+			}
+		}
+
+		/// <summary>
+		/// Gets the readable name for a rebuild reason
+		/// </summary>
+		static std::string_view ToString(RebuildReason reason)
+		{
+			switch (reason)
+			{
+				case RebuildReason::ForceRebuild:
+					return "Forced rebuild";
+				case RebuildReason::MissingHistory:
+					return "Missing build history";
+				case RebuildReason::ForcedByParent:
+					return "Forced by parent";
+				case RebuildReason::ClosureUnavailable:
+					return "Include closure unavailable";
+				case RebuildReason::MissingOutput:
+					return "Missing output";
+				case RebuildReason::MissingInput:
+					return "Missing input";
+				case RebuildReason::InputNewer:
+					return "Input newer than output";
+				case RebuildReason::ContentChanged:
+					return "Generated content changed";
+				default:
+					throw std::runtime_error("Unknown rebuild reason.");
+			}
+		}
+
+	private:
+		std::map<RebuildReason, uint64_t> _counts;
+	};
+}
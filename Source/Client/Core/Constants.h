@@ -28,6 +28,11 @@ namespace Soup
 		/// </summary>
 		static constexpr std::string_view RecipeFileName = "Recipe.toml";
 
+		/// <summary>
+		/// Gets the compiled Recipe snapshot file name
+		/// </summary>
+		static constexpr std::string_view RecipeSnapshotFileName = "Recipe.bin";
+
 		/// <summary>
 		/// Gets the generated build file name
 		/// </summary>
@@ -1,21 +1,56 @@
 ﻿module;
 
+#include <algorithm>
 #include <any>
 #include <array>
+#include <cctype>
 #include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <ctime>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <optional>
+#include <random>
 #include <set>
+#include <span>
 #include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#ifdef _WIN32
+#include <Windows.h>
+#ifdef min
+#undef min
+#endif
+#ifdef max
+#undef max
+#endif
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+#endif
+
 export module SoupCore;
 
 import Opal;
@@ -29,21 +64,38 @@ import toml11;
 
 using namespace Opal;
 
+#include "Utils/ContentHash.h"
 #include "Utils/Helpers.h"
 #include "Utils/HandledException.h"
+#include "Utils/PackageTraceListener.h"
 
 #include "Api/SoupApi.h"
 
+#include "Build/Runner/BuildExecutionPlan.h"
 #include "Build/Runner/BuildHistory.h"
 #include "Build/Runner/BuildHistoryChecker.h"
 #include "Build/Runner/BuildHistoryJson.h"
 #include "Build/Runner/BuildHistoryManager.h"
+#include "Build/Runner/BuildResourceLimits.h"
+#include "Build/Runner/BuildResourceScheduler.h"
 #include "Build/Runner/BuildRunner.h"
+#include "Build/Runner/BuiltInOperationRunner.h"
+#include "Build/Runner/IJobServer.h"
+#include "Build/Runner/JobServer.h"
+#include "Build/Runner/JobServerFlags.h"
+#include "Build/Runner/MemoryPressureMonitor.h"
+#include "Build/Runner/RebuildExplanation.h"
 
 #include "Config/LocalUserConfigExtensions.h"
 
+#include "Package/BuildExtensionRegistry.h"
+#include "Package/ExtensionFingerprint.h"
+#include "Package/PackageBuildScheduler.h"
+#include "Package/PackageGraph.h"
 #include "Package/PackageManager.h"
 #include "Package/Recipe.h"
+#include "Package/RecipeBinary.h"
+#include "Package/RecipeCache.h"
 #include "Package/RecipeBuildManager.h"
 #include "Package/RecipeExtensions.h"
 #include "Package/RecipeJson.h"
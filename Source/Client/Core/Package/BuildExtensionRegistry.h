@@ -0,0 +1,305 @@
+﻿// <copyright file="BuildExtensionRegistry.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime
+{
+	/// <summary>
+	/// The process wide set of loaded build extension libraries
+	/// Each library is loaded once and its registration function is reused for every
+	/// package build. A library is only reloaded when the content of the binary changes.
+	/// Note: Libraries are loaded from a copy named by the hash of their content, the
+	/// system loader returns the already loaded module when the same path is loaded again
+	/// and Windows locks a loaded library, which would block rebuilding the original.
+	/// </summary>
+	export class BuildExtensionRegistry
+	{
+	public:
+		/// <summary>
+		/// The function exported by each build extension to register its tasks
+		/// </summary>
+		using RegisterBuildExtensionFunction = int(*)(IBuildSystem&);
+
+		/// <summary>
+		/// The optional function exported by a build extension to learn the host interface version
+		/// </summary>
+		using SetBuildInterfaceVersionFunction = void(*)(uint32_t);
+
+		/// <summary>
+		/// Load the library at the provided path and find its registration function
+		/// </summary>
+		using LoadLibraryFunction = std::function<RegisterBuildExtensionFunction(const Path&)>;
+
+	private:
+		/// <summary>
+		/// A single loaded build extension library
+		/// </summary>
+		struct LoadedExtension
+		{
+			std::time_t LastWriteTime;
+			uint64_t ContentHash;
+			RegisterBuildExtensionFunction Function;
+		};
+
+	public:
+		/// <summary>
+		/// Gets the registry shared by the entire process
+		/// </summary>
+		static BuildExtensionRegistry& Current()
+		{
+			static auto registry = BuildExtensionRegistry();
+			return registry;
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildExtensionRegistry"/> class.
+		/// </summary>
+		BuildExtensionRegistry() :
+			BuildExtensionRegistry(nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildExtensionRegistry"/> class
+		/// with a custom library loader.
+		/// </summary>
+		BuildExtensionRegistry(LoadLibraryFunction loadLibrary) :
+			_loadLibrary(std::move(loadLibrary)),
+			_mutex(),
+			_extensions(),
+			_loadedCopies(),
+			_libraries()
+		{
+		}
+
+		/// <summary>
+		/// Check if the file is a content addressed copy of the library, named <stem>.<hexhash><extension>
+		/// </summary>
+		static bool IsContentCopy(const Path& libraryPath, const Path& file)
+		{
+			auto prefix = libraryPath.GetFileStem() + ".";
+			auto extension = std::string(libraryPath.GetFileExtension());
+			auto fileName = std::string(file.GetFileName());
+			if (fileName.size() <= prefix.size() + extension.size() ||
+				fileName.compare(0, prefix.size(), prefix) != 0 ||
+				fileName.compare(fileName.size() - extension.size(), extension.size(), extension) != 0)
+			{
+				return false;
+			}
+
+			auto hash = std::string_view(fileName).substr(
+				prefix.size(),
+				fileName.size() - prefix.size() - extension.size());
+			return hash.size() <= 16 &&
+				std::all_of(hash.begin(), hash.end(), [](char value) { return std::isxdigit(static_cast<unsigned char>(value)) != 0; });
+		}
+
+		/// <summary>
+		/// Get the registration function for the extension library, loading the library the
+		/// first time it is requested
+		/// Note: Safe to call from concurrent package builds
+		/// </summary>
+		RegisterBuildExtensionFunction GetRegisterFunction(const Path& libraryPath)
+		{
+			// Libraries resolved through the system search path cannot be checked for changes
+			auto key = libraryPath.ToString();
+			bool canCheckChanges = System::IFileSystem::Current().Exists(libraryPath);
+			std::time_t lastWriteTime = 0;
+			if (canCheckChanges)
+				lastWriteTime = System::IFileSystem::Current().GetLastWriteTime(libraryPath);
+
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			auto findResult = _extensions.find(key);
+			if (findResult != _extensions.end())
+			{
+				auto& extension = findResult->second;
+				if (!canCheckChanges || extension.LastWriteTime == lastWriteTime)
+					return extension.Function;
+
+				// The binary was written, only reload it when the content changed
+				auto content = ReadContent(libraryPath);
+				auto contentHash = GetContentHash(content);
+				if (contentHash == extension.ContentHash)
+				{
+					extension.LastWriteTime = lastWriteTime;
+					return extension.Function;
+				}
+
+				// Note: Tasks registered by the previous library may still be in use
+				Log::Diag("Build Extension changed: " + key);
+				_extensions.erase(findResult);
+				return Load(key, libraryPath, lastWriteTime, content, contentHash);
+			}
+
+			if (!canCheckChanges)
+				return Load(key, libraryPath, lastWriteTime, std::string(), 0);
+
+			auto content = ReadContent(libraryPath);
+			return Load(key, libraryPath, lastWriteTime, content, GetContentHash(content));
+		}
+
+	private:
+		/// <summary>
+		/// Load the library, through a copy named by its content hash when the content is known
+		/// </summary>
+		RegisterBuildExtensionFunction Load(
+			const std::string& key,
+			const Path& libraryPath,
+			std::time_t lastWriteTime,
+			const std::string& content,
+			uint64_t contentHash)
+		{
+			auto loadPath = libraryPath;
+			if (contentHash != 0)
+			{
+				loadPath = EnsureContentCopy(libraryPath, content, contentHash);
+				_loadedCopies.insert(loadPath.ToString());
+				PruneContentCopies(libraryPath);
+			}
+
+			Log::Diag("Loading Build Extension: " + loadPath.ToString());
+			auto function = _loadLibrary != nullptr ?
+				_loadLibrary(loadPath) :
+				LoadDynamicLibrary(loadPath);
+			_extensions.emplace(
+				key,
+				LoadedExtension({
+					lastWriteTime,
+					contentHash,
+					function,
+				}));
+
+			return function;
+		}
+
+		/// <summary>
+		/// Load the library with the system loader and keep it loaded until the process exits
+		/// Note: Tasks registered by a replaced library may still be in use
+		/// </summary>
+		RegisterBuildExtensionFunction LoadDynamicLibrary(const Path& libraryPath)
+		{
+			auto library = System::DynamicLibraryManager::LoadDynamicLibrary(libraryPath.ToString().c_str());
+			auto function = (RegisterBuildExtensionFunction)library.GetFunction(
+				"RegisterBuildExtension");
+
+			// Report the interface version to extensions that know to ask for it,
+			// older extensions only use the version 1 interfaces
+			auto setInterfaceVersion = TryGetFunction<SetBuildInterfaceVersionFunction>(
+				library,
+				"SetBuildInterfaceVersion");
+			if (setInterfaceVersion != nullptr)
+				setInterfaceVersion(BuildInterfaceVersion);
+
+			_libraries.push_back(std::move(library));
+			return function;
+		}
+
+		/// <summary>
+		/// Find an optional exported function
+		/// </summary>
+		template<typename T>
+		static T TryGetFunction(System::Library& library, const char* name)
+		{
+			try
+			{
+				return (T)library.GetFunction(name);
+			}
+			catch (const std::exception&)
+			{
+				return nullptr;
+			}
+		}
+
+		/// <summary>
+		/// Get the content addressed copy of the library, writing it the first time the content is seen
+		/// Note: The copy stays next to the original so its dependent libraries are still found. It is
+		/// written under a unique temporary name and renamed into place so a concurrent build never
+		/// loads a partially written copy.
+		/// </summary>
+		static Path EnsureContentCopy(const Path& libraryPath, const std::string& content, uint64_t contentHash)
+		{
+			auto copyName = std::stringstream();
+			copyName << libraryPath.GetFileStem() << "." << std::hex << contentHash << libraryPath.GetFileExtension();
+			auto copyPath = libraryPath.GetParent() + Path(copyName.str());
+			if (System::IFileSystem::Current().Exists(copyPath))
+				return copyPath;
+
+			auto temporaryName = std::stringstream();
+			temporaryName << copyName.str() << "." << std::hex << std::random_device()() << ".tmp";
+			auto temporaryPath = libraryPath.GetParent() + Path(temporaryName.str());
+			auto file = System::IFileSystem::Current().OpenWrite(temporaryPath, true);
+			file->GetOutStream() << content;
+			file->Close();
+
+			try
+			{
+				System::IFileSystem::Current().Rename(temporaryPath, copyPath);
+			}
+			catch (const std::exception&)
+			{
+				// Another build may have moved the same content into place first
+				System::IFileSystem::Current().DeleteFile2(temporaryPath);
+				if (!System::IFileSystem::Current().Exists(copyPath))
+					throw;
+			}
+
+			return copyPath;
+		}
+
+		/// <summary>
+		/// Delete the copies of previous versions of the library that this process has not loaded
+		/// Note: A copy that is still loaded by another process cannot be deleted and is left for a later build
+		/// </summary>
+		void PruneContentCopies(const Path& libraryPath)
+		{
+			for (auto& child : System::IFileSystem::Current().GetDirectoryChildren(libraryPath.GetParent()))
+			{
+				if (child.IsDirectory ||
+					!IsContentCopy(libraryPath, child.Path) ||
+					_loadedCopies.contains(child.Path.ToString()))
+				{
+					continue;
+				}
+
+				try
+				{
+					Log::Diag("Delete stale Build Extension copy: " + child.Path.ToString());
+					System::IFileSystem::Current().DeleteFile2(child.Path);
+				}
+				catch (const std::exception& ex)
+				{
+					Log::Diag(std::string("Failed to delete stale Build Extension copy: ") + ex.what());
+				}
+			}
+		}
+
+		static std::string ReadContent(const Path& libraryPath)
+		{
+			auto file = System::IFileSystem::Current().OpenRead(libraryPath, true);
+			auto content = std::stringstream();
+			content << file->GetInStream().rdbuf();
+			return content.str();
+		}
+
+		/// <summary>
+		/// Hash the content of the binary
+		/// </summary>
+		static uint64_t GetContentHash(const std::string& content)
+		{
+			auto result = ContentHash();
+			result.Add(content);
+			return result.GetValue();
+		}
+
+	private:
+		LoadLibraryFunction _loadLibrary;
+		std::mutex _mutex;
+		std::map<std::string, LoadedExtension> _extensions;
+		std::set<std::string> _loadedCopies;
+
+		// Keep every loaded library open until the process exits
+		std::vector<System::Library> _libraries;
+	};
+}
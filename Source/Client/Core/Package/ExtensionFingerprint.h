@@ -0,0 +1,132 @@
+﻿// <copyright file="ExtensionFingerprint.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "Recipe.h"
+#include "Build/Runner/BuildHistoryManager.h"
+
+namespace Soup::Build::Runtime
+{
+	/// <summary>
+	/// The fingerprint of everything that goes into a build extension binary, used to skip
+	/// rebuilding extension packages that have not changed since their binary was built
+	/// </summary>
+	export class ExtensionFingerprint
+	{
+	private:
+		static constexpr std::string_view FingerprintFileName = "ExtensionFingerprint.txt";
+
+	public:
+		/// <summary>
+		/// Get the fingerprint file for the provided target directory
+		/// </summary>
+		static Path GetFingerprintFile(const Path& targetDirectory)
+		{
+			return targetDirectory +
+				Path(Constants::ProjectGenerateFolderName) +
+				Path(FingerprintFileName);
+		}
+
+		/// <summary>
+		/// Compute the fingerprint for a single package from its recipe, its sources along with
+		/// the include closure from the previous build, the compiler, the flavor and the
+		/// fingerprints of all of its dependencies
+		/// </summary>
+		static uint64_t Compute(
+			const Path& packageRoot,
+			const Path& targetDirectory,
+			Recipe& recipe,
+			std::string_view compiler,
+			std::string_view flavor,
+			const std::vector<uint64_t>& dependencyFingerprints)
+		{
+			auto result = ContentHash();
+			result.Add(compiler);
+			result.Add(flavor);
+
+			auto recipeFile = packageRoot + Path(Constants::RecipeFileName);
+			if (System::IFileSystem::Current().Exists(recipeFile))
+			{
+				auto file = System::IFileSystem::Current().OpenRead(recipeFile, true);
+				result.AddStream(file->GetInStream());
+			}
+
+			// Sort the files to keep the fingerprint independent of the history order
+			auto files = std::set<std::string>();
+			if (recipe.HasSource())
+			{
+				auto history = BuildHistory();
+				bool hasHistory = BuildHistoryManager::TryLoadState(targetDirectory, history);
+				for (auto& source : recipe.GetSource())
+				{
+					files.insert((packageRoot + Path(source)).ToString());
+
+					// Unity compiled sources are recorded under their absolute path
+					auto historyFile = Path();
+					auto closure = std::vector<Path>();
+					if (hasHistory &&
+						history.TryFindSourceFile(packageRoot, Path(source), historyFile) &&
+						history.TryBuildIncludeClosure(historyFile, closure))
+					{
+						for (auto& include : closure)
+						{
+							if (include.HasRoot())
+								files.insert(include.ToString());
+							else
+								files.insert((packageRoot + include).ToString());
+						}
+					}
+				}
+			}
+
+			for (auto& file : files)
+			{
+				result.Add(file);
+				auto path = Path(file);
+				if (System::IFileSystem::Current().Exists(path))
+					result.Add(static_cast<uint64_t>(System::IFileSystem::Current().GetLastWriteTime(path)));
+				else
+					result.Add(std::string_view("Missing"));
+			}
+
+			for (auto dependencyFingerprint : dependencyFingerprints)
+			{
+				result.Add(dependencyFingerprint);
+			}
+
+			return result.GetValue();
+		}
+
+		/// <summary>
+		/// Load the fingerprint that was saved after the last successful build
+		/// </summary>
+		static bool TryLoad(const Path& targetDirectory, uint64_t& result)
+		{
+			auto fingerprintFile = GetFingerprintFile(targetDirectory);
+			if (!System::IFileSystem::Current().Exists(fingerprintFile))
+				return false;
+
+			auto file = System::IFileSystem::Current().OpenRead(fingerprintFile, false);
+			auto& stream = file->GetInStream();
+			stream >> std::hex >> result;
+			return !stream.fail();
+		}
+
+		/// <summary>
+		/// Save the fingerprint after a successful build
+		/// </summary>
+		static void Save(const Path& targetDirectory, uint64_t fingerprint)
+		{
+			auto generateFolder = targetDirectory +
+				Path(Constants::ProjectGenerateFolderName);
+			if (!System::IFileSystem::Current().Exists(generateFolder))
+			{
+				System::IFileSystem::Current().CreateDirectory2(generateFolder);
+			}
+
+			auto file = System::IFileSystem::Current().OpenWrite(GetFingerprintFile(targetDirectory), false);
+			file->GetOutStream() << std::hex << fingerprint;
+		}
+	};
+}
@@ -0,0 +1,170 @@
+﻿// <copyright file="PackageBuildScheduler.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Build::Runtime
+{
+	/// <summary>
+	/// Runs the builds for a graph of packages in dependency order, building
+	/// packages that do not depend on each other concurrently
+	/// </summary>
+	export class PackageBuildScheduler
+	{
+	private:
+		/// <summary>
+		/// A package build that finished on a worker thread
+		/// </summary>
+		struct CompletedPackage
+		{
+			int Id;
+			std::exception_ptr Exception;
+		};
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PackageBuildScheduler"/> class.
+		/// </summary>
+		PackageBuildScheduler(uint64_t maxParallelism) :
+			_maxParallelism(std::max<uint64_t>(1, maxParallelism)),
+			_packages()
+		{
+		}
+
+		/// <summary>
+		/// Register a package along with the packages that must be built before it
+		/// </summary>
+		void AddPackage(int id, std::vector<int> dependencies)
+		{
+			if (!_packages.emplace(id, std::move(dependencies)).second)
+				throw std::runtime_error("PackageBuildScheduler: Package was already added.");
+		}
+
+		/// <summary>
+		/// Build all of the registered packages
+		/// Note: The prepare callback runs on the calling thread right before a package is
+		/// started, after all of its dependencies have completed. The build callback runs on a
+		/// worker thread. Ready packages start in ascending id order so a single job follows
+		/// the same order as the sequential build.
+		/// </summary>
+		template<typename TPrepare, typename TBuild>
+		void Execute(TPrepare&& prepare, TBuild&& build)
+		{
+			// Count the remaining dependencies for each package
+			auto remainingCounts = std::map<int, size_t>();
+			auto dependents = std::map<int, std::vector<int>>();
+			auto readyPackages = std::set<int>();
+			for (auto& [id, dependencies] : _packages)
+			{
+				for (auto dependency : dependencies)
+				{
+					if (!_packages.contains(dependency))
+						throw std::runtime_error("PackageBuildScheduler: Missing dependency package.");
+
+					dependents[dependency].push_back(id);
+				}
+
+				remainingCounts.emplace(id, dependencies.size());
+				if (dependencies.empty())
+					readyPackages.insert(id);
+			}
+
+			auto runningPackages = std::map<int, std::thread>();
+			auto completedPackages = std::deque<CompletedPackage>();
+			auto completedMutex = std::mutex();
+			auto completedCondition = std::condition_variable();
+			auto failure = std::exception_ptr();
+			size_t builtCount = 0;
+
+			while ((failure == nullptr && !readyPackages.empty()) || !runningPackages.empty())
+			{
+				// Start as many ready packages as the parallelism allows
+				// Note: Stop starting new work after the first failure
+				while (failure == nullptr &&
+					!readyPackages.empty() &&
+					runningPackages.size() < _maxParallelism)
+				{
+					auto id = *readyPackages.begin();
+					readyPackages.erase(readyPackages.begin());
+
+					try
+					{
+						prepare(id);
+					}
+					catch (...)
+					{
+						failure = std::current_exception();
+						break;
+					}
+
+					runningPackages.emplace(
+						id,
+						std::thread([id, &build, &completedPackages, &completedMutex, &completedCondition]()
+						{
+							auto completedPackage = CompletedPackage({ id, nullptr });
+							try
+							{
+								build(id);
+							}
+							catch (...)
+							{
+								completedPackage.Exception = std::current_exception();
+							}
+
+							{
+								auto lock = std::lock_guard<std::mutex>(completedMutex);
+								completedPackages.push_back(std::move(completedPackage));
+							}
+
+							completedCondition.notify_one();
+						}));
+				}
+
+				if (runningPackages.empty())
+					break;
+
+				// Wait for at least one package to complete
+				auto completed = std::deque<CompletedPackage>();
+				{
+					auto lock = std::unique_lock<std::mutex>(completedMutex);
+					completedCondition.wait(lock, [&completedPackages]() { return !completedPackages.empty(); });
+					std::swap(completed, completedPackages);
+				}
+
+				for (auto& completedPackage : completed)
+				{
+					auto runningPackage = runningPackages.find(completedPackage.Id);
+					runningPackage->second.join();
+					runningPackages.erase(runningPackage);
+
+					if (completedPackage.Exception != nullptr)
+					{
+						// Keep the first failure and let the remaining work finish
+						if (failure == nullptr)
+							failure = completedPackage.Exception;
+						continue;
+					}
+
+					// Notify the dependent packages that this package is complete
+					builtCount++;
+					for (auto dependent : dependents[completedPackage.Id])
+					{
+						if (--remainingCounts[dependent] == 0)
+							readyPackages.insert(dependent);
+					}
+				}
+			}
+
+			if (failure != nullptr)
+				std::rethrow_exception(failure);
+
+			if (builtCount != _packages.size())
+				throw std::runtime_error("PackageBuildScheduler: The package graph must be acyclic.");
+		}
+
+	private:
+		uint64_t _maxParallelism;
+		std::map<int, std::vector<int>> _packages;
+	};
+}
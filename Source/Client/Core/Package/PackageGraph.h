@@ -0,0 +1,306 @@
+﻿// <copyright file="PackageGraph.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "RecipeCache.h"
+#include "RecipeExtensions.h"
+
+namespace Soup
+{
+	/// <summary>
+	/// A single unique package in the package graph
+	/// </summary>
+	export class PackageGraphNode
+	{
+	public:
+		/// <summary>
+		/// Gets or sets the resolved package directory
+		/// </summary>
+		Path WorkingDirectory;
+
+		/// <summary>
+		/// Gets or sets the loaded package recipe
+		/// </summary>
+		Recipe PackageRecipe;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether the package was first reached through
+		/// a dev dependency and is built with the system compiler
+		/// </summary>
+		bool IsSystemBuild;
+
+		/// <summary>
+		/// Gets or sets the ids of the runtime dependencies in declaration order
+		/// </summary>
+		std::vector<int> Dependencies;
+
+		/// <summary>
+		/// Gets or sets the ids of the dev dependencies in declaration order
+		/// </summary>
+		std::vector<int> DevDependencies;
+	};
+
+	/// <summary>
+	/// The package graph that resolves every unique package once, no matter how many
+	/// packages reference it
+	/// Note: Package ids are a topological index, every dependency has a lower id than the
+	/// packages that reference it and the root package has the highest id
+	/// </summary>
+	export class PackageGraph
+	{
+	public:
+		/// <summary>
+		/// Resolve the directory for a package reference relative to the referencing package
+		/// </summary>
+		using ResolvePackagePath = std::function<Path(const Path&, const PackageReference&)>;
+
+		/// <summary>
+		/// Load the package graph for the root recipe and all of its transitive dependencies
+		/// </summary>
+		static PackageGraph Load(
+			const Path& workingDirectory,
+			Recipe recipe,
+			RecipeCache& recipeCache,
+			const ResolvePackagePath& resolvePackagePath)
+		{
+			auto result = PackageGraph();
+			auto rootParentSet = std::set<std::string>();
+			bool isSystemBuild = false;
+			result._rootId = result.LoadPackage(
+				workingDirectory,
+				std::move(recipe),
+				isSystemBuild,
+				rootParentSet,
+				recipeCache,
+				resolvePackagePath);
+
+			return result;
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PackageGraph"/> class.
+		/// </summary>
+		PackageGraph() :
+			_rootId(0),
+			_packages(),
+			_packageNames(),
+			_packagePaths()
+		{
+		}
+
+		/// <summary>
+		/// Gets the id of the root package
+		/// </summary>
+		int GetRootId() const
+		{
+			return _rootId;
+		}
+
+		/// <summary>
+		/// Gets all packages ordered by id
+		/// </summary>
+		std::map<int, PackageGraphNode>& GetPackages()
+		{
+			return _packages;
+		}
+
+		const std::map<int, PackageGraphNode>& GetPackages() const
+		{
+			return _packages;
+		}
+
+		/// <summary>
+		/// Gets a single package
+		/// </summary>
+		PackageGraphNode& GetPackage(int id)
+		{
+			auto findResult = _packages.find(id);
+			if (findResult == _packages.end())
+				throw std::runtime_error("PackageGraph: Unknown package id.");
+
+			return findResult->second;
+		}
+
+		const PackageGraphNode& GetPackage(int id) const
+		{
+			auto findResult = _packages.find(id);
+			if (findResult == _packages.end())
+				throw std::runtime_error("PackageGraph: Unknown package id.");
+
+			return findResult->second;
+		}
+
+		/// <summary>
+		/// Find the package with the provided name
+		/// </summary>
+		bool TryFindPackage(const std::string& name, int& id) const
+		{
+			auto findResult = _packageNames.find(name);
+			if (findResult == _packageNames.end())
+				return false;
+
+			id = findResult->second;
+			return true;
+		}
+
+	private:
+		/// <summary>
+		/// Load the dependencies for the provided recipe recursively and add each unique package to the graph
+		/// Returns the id of the package
+		/// Note: Ids are assigned after all dependencies to match the sequential build order
+		/// </summary>
+		int LoadPackage(
+			const Path& workingDirectory,
+			Recipe recipe,
+			bool isSystemBuild,
+			const std::set<std::string>& parentSet,
+			RecipeCache& recipeCache,
+			const ResolvePackagePath& resolvePackagePath)
+		{
+			// Each package is only loaded once
+			// TODO: Verify unique names
+			auto findPackage = _packageNames.find(recipe.GetName());
+			if (findPackage != _packageNames.end())
+			{
+				Log::Diag("Recipe already loaded: " + recipe.GetName());
+				return findPackage->second;
+			}
+
+			// Add current package to the parent set when loading child dependencies
+			auto activeParentSet = parentSet;
+			activeParentSet.insert(std::string(recipe.GetName()));
+
+			auto dependencyIds = std::vector<int>();
+			if (recipe.HasDependencies())
+			{
+				for (auto& dependency : recipe.GetDependencies())
+				{
+					auto dependencyId = LoadDependency(
+						workingDirectory,
+						recipe,
+						dependency,
+						false,
+						isSystemBuild,
+						activeParentSet,
+						recipeCache,
+						resolvePackagePath);
+					dependencyIds.push_back(dependencyId);
+				}
+			}
+
+			auto devDependencyIds = std::vector<int>();
+			if (recipe.HasDevDependencies())
+			{
+				for (auto& dependency : recipe.GetDevDependencies())
+				{
+					// Note: Dev dependencies are built with the system compiler
+					auto dependencyId = LoadDependency(
+						workingDirectory,
+						recipe,
+						dependency,
+						true,
+						true,
+						activeParentSet,
+						recipeCache,
+						resolvePackagePath);
+					devDependencyIds.push_back(dependencyId);
+				}
+			}
+
+			// Add the package after all of its dependencies
+			int id = static_cast<int>(_packages.size()) + 1;
+			auto name = std::string(recipe.GetName());
+			_packagePaths.emplace(workingDirectory.ToString(), id);
+			_packageNames.emplace(name, id);
+			_packages.emplace(
+				id,
+				PackageGraphNode({
+					workingDirectory,
+					std::move(recipe),
+					isSystemBuild,
+					std::move(dependencyIds),
+					std::move(devDependencyIds),
+				}));
+
+			return id;
+		}
+
+		/// <summary>
+		/// Resolve and load a single dependency
+		/// Note: A package that was already loaded from the same directory is not loaded again
+		/// </summary>
+		int LoadDependency(
+			const Path& workingDirectory,
+			Recipe& recipe,
+			const PackageReference& dependency,
+			bool isDevDependency,
+			bool isSystemBuild,
+			const std::set<std::string>& parentSet,
+			RecipeCache& recipeCache,
+			const ResolvePackagePath& resolvePackagePath)
+		{
+			auto packagePath = resolvePackagePath(workingDirectory, dependency);
+			auto findPackage = _packagePaths.find(packagePath.ToString());
+			if (findPackage != _packagePaths.end())
+			{
+				return findPackage->second;
+			}
+
+			// Load this package recipe
+			auto packageRecipePath = packagePath + Path(Constants::RecipeFileName);
+			Recipe dependencyRecipe = {};
+			if (!recipeCache.TryLoad(packagePath, dependencyRecipe))
+			{
+				if (isDevDependency)
+				{
+					Log::Error("Failed to load the extension package: " + packageRecipePath.ToString());
+					throw std::runtime_error("PackageGraph: Failed to load dependency.");
+				}
+				else if (dependency.IsLocal())
+				{
+					Log::Error("The dependency Recipe does not exist: " + packageRecipePath.ToString());
+					Log::HighPriority("Make sure the path is correct and try again");
+				}
+				else
+				{
+					Log::Error("The Recipe version has not been installed: " + dependency.ToString());
+					Log::HighPriority("Run `install` and try again");
+				}
+
+				// Nothing we can do, exit
+				throw HandledException();
+			}
+
+			// Ensure we do not have any circular dependencies
+			if (parentSet.contains(dependencyRecipe.GetName()))
+			{
+				if (isDevDependency)
+				{
+					Log::Error("Found circular dev dependency: " + recipe.GetName() + " -> " + dependencyRecipe.GetName());
+					throw std::runtime_error("PackageGraph: Circular dev dependency.");
+				}
+				else
+				{
+					Log::Error("Found circular dependency: " + recipe.GetName() + " -> " + dependencyRecipe.GetName());
+					throw std::runtime_error("PackageGraph: Circular dependency.");
+				}
+			}
+
+			// Load all recursive dependencies
+			return LoadPackage(
+				packagePath,
+				std::move(dependencyRecipe),
+				isSystemBuild,
+				parentSet,
+				recipeCache,
+				resolvePackagePath);
+		}
+
+	private:
+		int _rootId;
+		std::map<int, PackageGraphNode> _packages;
+		std::map<std::string, int> _packageNames;
+		std::map<std::string, int> _packagePaths;
+	};
+}
@@ -1,8 +1,9 @@
-﻿// <copyright file="PackageManager.h" company="Soup">
+// <copyright file="PackageManager.h" company="Soup">
 // Copyright (c) Soup. All rights reserved.
 // </copyright>
 
 #pragma once
+#include "PackageGraph.h"
 #include "RecipeExtensions.h"
 #include "Api/SoupApi.h"
 #include "Auth/SoupAuth.h"
@@ -41,10 +42,14 @@ namespace Soup
 
 			try
 			{
+				auto stagedPackages = std::vector<PackageReference>();
 				InstallRecursiveDependencies(
 					workingDirectory,
 					packageStore,
-					stagingPath);
+					stagingPath,
+					stagedPackages);
+
+				MoveStagedPackages(stagedPackages, packageStore, stagingPath);
 
 				// Cleanup the working directory
 				Log::Info("Deleting staging directory");
@@ -117,11 +122,22 @@ namespace Soup
 					targetPackageReference = PackageReference(packageModel.GetName(), latestVersion);
 				}
 
-				EnsurePackageDownloaded(
+				auto stagedPackages = std::vector<PackageReference>();
+				auto packageDirectory = EnsurePackageDownloaded(
 					targetPackageReference.GetName(),
 					targetPackageReference.GetVersion(),
 					packageStore,
-					stagingPath);
+					stagingPath,
+					stagedPackages);
+
+				// Install transitive dependencies
+				InstallRecursiveDependencies(
+					packageDirectory,
+					packageStore,
+					stagingPath,
+					stagedPackages);
+
+				MoveStagedPackages(stagedPackages, packageStore, stagingPath);
 
 				// Cleanup the working directory
 				Log::Info("Deleting staging directory");
@@ -380,13 +396,16 @@ namespace Soup
 		}
 
 		/// <summary>
-		/// Ensure a package version is downloaded
+		/// Ensure a package version is downloaded and return the directory that contains it
+		/// Note: A downloaded package stays in the staging directory until all of the transitive
+		/// dependencies have been installed
 		/// </summary>
-		static void EnsurePackageDownloaded(
+		static Path EnsurePackageDownloaded(
 			const std::string packageName,
 			SemanticVersion packageVersion,
 			const Path& packagesDirectory,
-			const Path& stagingDirectory)
+			const Path& stagingDirectory,
+			std::vector<PackageReference>& stagedPackages)
 		{
 			Log::HighPriority("Install Package: " + packageName + "@" + packageVersion.ToString());
 
@@ -423,11 +442,27 @@ namespace Soup
 					archive.ExtractAll(stagingVersionFolder.ToString(), callback);
 				}
 
-				// Install transitive dependencies
-				InstallRecursiveDependencies(
-					stagingVersionFolder,
-					packagesDirectory,
-					stagingDirectory);
+				stagedPackages.push_back(PackageReference(packageName, packageVersion));
+				return stagingVersionFolder;
+			}
+
+			return packageVersionFolder;
+		}
+
+		/// <summary>
+		/// Move the downloaded packages from the staging directory into the package store
+		/// </summary>
+		static void MoveStagedPackages(
+			const std::vector<PackageReference>& stagedPackages,
+			const Path& packagesDirectory,
+			const Path& stagingDirectory)
+		{
+			// Note: Dependencies are staged after the packages that reference them, move them first
+			for (auto package = stagedPackages.rbegin(); package != stagedPackages.rend(); ++package)
+			{
+				auto packageRootFolder = packagesDirectory + Path(package->GetName());
+				auto packageVersionFolder = packageRootFolder + Path(package->GetVersion().ToString());
+				auto stagingVersionFolder = stagingDirectory + Path(package->GetName()) + Path(package->GetVersion().ToString());
 
 				// Ensure the package root folder exists
 				if (!System::IFileSystem::Current().Exists(packageRootFolder))
@@ -442,12 +477,14 @@ namespace Soup
 		}
 
 		/// <summary>
-		/// Recursively install all dependencies and transitive dependencies
+		/// Install all dependencies and transitive dependencies
+		/// Note: The package graph visits each unique package once, no matter how many packages reference it
 		/// </summary>
 		static void InstallRecursiveDependencies(
 			const Path& recipeDirectory,
 			const Path& packagesDirectory,
-			const Path& stagingDirectory)
+			const Path& stagingDirectory,
+			std::vector<PackageReference>& stagedPackages)
 		{
 			auto recipePath =
 				recipeDirectory +
@@ -457,56 +494,30 @@ namespace Soup
 			{
 				throw std::runtime_error("Could not load the recipe file.");
 			}
-	
-			if (recipe.HasDependencies())
-			{
-				for (auto& dependency : recipe.GetDependencies())
-				{
-					// If local then check children for external package references
-					// Otherwise install the external package reference and its dependencies
-					if (dependency.IsLocal())
-					{
-						auto dependencyPath = recipeDirectory + dependency.GetPath();
-						InstallRecursiveDependencies(
-							dependencyPath,
-							packagesDirectory,
-							stagingDirectory);
-					}
-					else
-					{
-						EnsurePackageDownloaded(
-							dependency.GetName(),
-							dependency.GetVersion(),
-							packagesDirectory,
-							stagingDirectory);
-					}
-				}
-			}
 
-			if (recipe.HasDevDependencies())
-			{
-				for (auto& dependency : recipe.GetDevDependencies())
+			// If local then check children for external package references
+			// Otherwise install the external package reference before loading its dependencies
+			auto recipeCache = RecipeCache(false);
+			PackageGraph::Load(
+				recipeDirectory,
+				std::move(recipe),
+				recipeCache,
+				[&packagesDirectory, &stagingDirectory, &stagedPackages](const Path& workingDirectory, const PackageReference& dependency)
 				{
-					// If local then check children for external package references
-					// Otherwise install the external package reference and its dependencies
 					if (dependency.IsLocal())
 					{
-						auto dependencyPath = recipeDirectory + dependency.GetPath();
-						InstallRecursiveDependencies(
-							dependencyPath,
-							packagesDirectory,
-							stagingDirectory);
+						return RecipeExtensions::GetPackageReferencePath(workingDirectory, dependency);
 					}
 					else
 					{
-						EnsurePackageDownloaded(
+						return EnsurePackageDownloaded(
 							dependency.GetName(),
 							dependency.GetVersion(),
 							packagesDirectory,
-							stagingDirectory);
+							stagingDirectory,
+							stagedPackages);
 					}
-				}
-			}
+				});
 		}
 
 		/// <summary>
@@ -24,6 +24,8 @@ namespace Soup
 		static constexpr const char* Property_Source = "Source";
 		static constexpr const char* Property_IncludePaths = "IncludePaths";
 		static constexpr const char* Property_Defines = "Defines";
+		static constexpr const char* Property_UnityBuild = "UnityBuild";
+		static constexpr const char* Property_PrecompiledHeader = "PrecompiledHeader";
 
 	public:
 		/// <summary>
@@ -370,6 +372,48 @@ namespace Soup
 			EnsureValue(Property_Defines).SetValueList(std::move(stringValues));
 		}
 
+		/// <summary>
+		/// Gets or sets the unity build value
+		/// </summary>
+		bool HasUnityBuild()
+		{
+			return HasValue(Property_UnityBuild);
+		}
+
+		bool GetUnityBuild()
+		{
+			if (!HasUnityBuild())
+				throw std::runtime_error("No unity build.");
+
+			return GetValue(Property_UnityBuild).AsBoolean();
+		}
+
+		void SetUnityBuild(bool value)
+		{
+			EnsureValue(Property_UnityBuild).SetValueBoolean(value);
+		}
+
+		/// <summary>
+		/// Gets or sets the precompiled header value
+		/// </summary>
+		bool HasPrecompiledHeader()
+		{
+			return HasValue(Property_PrecompiledHeader);
+		}
+
+		std::string_view GetPrecompiledHeader()
+		{
+			if (!HasPrecompiledHeader())
+				throw std::runtime_error("No precompiled header.");
+
+			return GetValue(Property_PrecompiledHeader).AsString();
+		}
+
+		void SetPrecompiledHeader(std::string_view value)
+		{
+			EnsureValue(Property_PrecompiledHeader).SetValueString(std::string(value));
+		}
+
 		/// <summary>
 		/// Raw access
 		/// </summary>
@@ -0,0 +1,258 @@
+﻿// <copyright file="RecipeBinary.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "Recipe.h"
+
+namespace Soup
+{
+	/// <summary>
+	/// The recipe binary serialize manager used for the compiled recipe snapshots
+	/// Note: Comments are not stored, the snapshot is only used for read only access
+	/// </summary>
+	export class RecipeBinary
+	{
+	private:
+		static constexpr std::array<char, 4> FileType = { 'B', 'R', 'C', 'P' };
+		static constexpr uint32_t FileVersion = 2;
+
+	public:
+		/// <summary>
+		/// Load from stream
+		/// Returns false if the snapshot was compiled from different source recipe content
+		/// </summary>
+		static bool TryDeserialize(
+			std::istream& stream,
+			uint64_t sourceContentHash,
+			Recipe& result)
+		{
+			auto fileType = std::array<char, 4>();
+			stream.read(fileType.data(), fileType.size());
+			if (!stream || fileType != FileType)
+				return false;
+
+			if (ReadUInt32(stream) != FileVersion)
+				return false;
+
+			if (ReadUInt64(stream) != sourceContentHash)
+				return false;
+
+			auto table = RecipeTable();
+			Read(stream, table);
+			result = Recipe(std::move(table));
+			return true;
+		}
+
+		/// <summary>
+		/// Save the recipe to the stream along with the content hash of the source recipe file
+		/// </summary>
+		static void Serialize(
+			Recipe& recipe,
+			uint64_t sourceContentHash,
+			std::ostream& stream)
+		{
+			stream.write(FileType.data(), FileType.size());
+			WriteUInt32(stream, FileVersion);
+			WriteUInt64(stream, sourceContentHash);
+			Write(stream, recipe.GetTable());
+		}
+
+	private:
+		static void Read(std::istream& stream, RecipeValue& value)
+		{
+			auto type = static_cast<RecipeValueType>(ReadUInt32(stream));
+			switch (type)
+			{
+				case RecipeValueType::Empty:
+				{
+					// Leave empty
+					break;
+				}
+				case RecipeValueType::Table:
+				{
+					auto table = RecipeTable();
+					Read(stream, table);
+					value.SetValueTable(std::move(table));
+					break;
+				}
+				case RecipeValueType::List:
+				{
+					auto list = RecipeList();
+					Read(stream, list);
+					value.SetValueList(std::move(list));
+					break;
+				}
+				case RecipeValueType::String:
+				{
+					value.SetValueString(ReadString(stream));
+					break;
+				}
+				case RecipeValueType::Integer:
+				{
+					value.SetValueInteger(ReadInt64(stream));
+					break;
+				}
+				case RecipeValueType::Float:
+				{
+					double floatValue = 0;
+					stream.read(reinterpret_cast<char*>(&floatValue), sizeof(floatValue));
+					if (!stream)
+						throw std::runtime_error("Unexpected end of recipe snapshot.");
+
+					value.SetValueFloat(floatValue);
+					break;
+				}
+				case RecipeValueType::Boolean:
+				{
+					value.SetValueBoolean(ReadUInt32(stream) != 0);
+					break;
+				}
+				default:
+				{
+					throw std::runtime_error("Unknown recipe snapshot value type.");
+				}
+			}
+		}
+
+		static void Read(std::istream& stream, RecipeTable& table)
+		{
+			auto count = ReadUInt32(stream);
+			table.reserve(count);
+			for (uint32_t i = 0; i < count; i++)
+			{
+				auto key = ReadString(stream);
+				auto value = RecipeValue();
+				Read(stream, value);
+				table.emplace(std::move(key), std::move(value));
+			}
+		}
+
+		static void Read(std::istream& stream, RecipeList& list)
+		{
+			auto count = ReadUInt32(stream);
+			list.reserve(count);
+			for (uint32_t i = 0; i < count; i++)
+			{
+				auto value = RecipeValue();
+				Read(stream, value);
+				list.push_back(std::move(value));
+			}
+		}
+
+		static void Write(std::ostream& stream, const RecipeValue& value)
+		{
+			auto type = value.GetType();
+			WriteUInt32(stream, static_cast<uint32_t>(type));
+			switch (type)
+			{
+				case RecipeValueType::Empty:
+					break;
+				case RecipeValueType::Table:
+					Write(stream, value.AsTable());
+					break;
+				case RecipeValueType::List:
+					Write(stream, value.AsList());
+					break;
+				case RecipeValueType::String:
+					WriteString(stream, value.AsString());
+					break;
+				case RecipeValueType::Integer:
+					WriteInt64(stream, value.AsInteger());
+					break;
+				case RecipeValueType::Float:
+				{
+					auto floatValue = value.AsFloat();
+					stream.write(reinterpret_cast<const char*>(&floatValue), sizeof(floatValue));
+					break;
+				}
+				case RecipeValueType::Boolean:
+					WriteUInt32(stream, value.AsBoolean() ? 1 : 0);
+					break;
+				default:
+					throw std::runtime_error("Unknown value type.");
+			}
+		}
+
+		static void Write(std::ostream& stream, const RecipeTable& table)
+		{
+			WriteUInt32(stream, static_cast<uint32_t>(table.size()));
+			for (auto& value : table)
+			{
+				WriteString(stream, value.first);
+				Write(stream, value.second);
+			}
+		}
+
+		static void Write(std::ostream& stream, const RecipeList& list)
+		{
+			WriteUInt32(stream, static_cast<uint32_t>(list.size()));
+			for (auto& value : list)
+			{
+				Write(stream, value);
+			}
+		}
+
+		static uint32_t ReadUInt32(std::istream& stream)
+		{
+			uint32_t result = 0;
+			stream.read(reinterpret_cast<char*>(&result), sizeof(result));
+			if (!stream)
+				throw std::runtime_error("Unexpected end of recipe snapshot.");
+
+			return result;
+		}
+
+		static int64_t ReadInt64(std::istream& stream)
+		{
+			int64_t result = 0;
+			stream.read(reinterpret_cast<char*>(&result), sizeof(result));
+			if (!stream)
+				throw std::runtime_error("Unexpected end of recipe snapshot.");
+
+			return result;
+		}
+
+		static uint64_t ReadUInt64(std::istream& stream)
+		{
+			uint64_t result = 0;
+			stream.read(reinterpret_cast<char*>(&result), sizeof(result));
+			if (!stream)
+				throw std::runtime_error("Unexpected end of recipe snapshot.");
+
+			return result;
+		}
+
+		static std::string ReadString(std::istream& stream)
+		{
+			auto size = ReadUInt32(stream);
+			auto result = std::string(size, '\0');
+			stream.read(result.data(), size);
+			if (!stream)
+				throw std::runtime_error("Unexpected end of recipe snapshot.");
+
+			return result;
+		}
+
+		static void WriteUInt32(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		static void WriteInt64(std::ostream& stream, int64_t value)
+		{
+			stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		static void WriteUInt64(std::ostream& stream, uint64_t value)
+		{
+			stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		static void WriteString(std::ostream& stream, const std::string& value)
+		{
+			WriteUInt32(stream, static_cast<uint32_t>(value.size()));
+			stream.write(value.data(), value.size());
+		}
+	};
+}
@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "Build/Runner/BuildResourceLimits.h"
 
 namespace Soup
 {
@@ -55,6 +56,27 @@ namespace Soup
 		/// </summary>
 		bool ForceRebuild;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to report why each build operation runs
+		/// </summary>
+		bool Explain;
+
+		/// <summary>
+		/// Gets or sets the resource limits used when executing the build nodes
+		/// </summary>
+		Build::BuildResourceLimits ResourceLimits;
+
+		/// <summary>
+		/// Gets or sets the maximum number of package build graphs that are generated at the same time
+		/// </summary>
+		uint64_t MaxPackageParallelism;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to reuse the compiled recipe snapshots
+		/// instead of parsing each dependency recipe
+		/// </summary>
+		bool UseRecipeSnapshots;
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -66,7 +88,11 @@ namespace Soup
 				PlatformLibraryPaths == rhs.PlatformLibraryPaths &&
 				PlatformPreprocessorDefinitions == rhs.PlatformPreprocessorDefinitions &&
 				PlatformLibraries == rhs.PlatformLibraries &&
-				ForceRebuild == rhs.ForceRebuild;
+				ForceRebuild == rhs.ForceRebuild &&
+				Explain == rhs.Explain &&
+				ResourceLimits == rhs.ResourceLimits &&
+				MaxPackageParallelism == rhs.MaxPackageParallelism &&
+				UseRecipeSnapshots == rhs.UseRecipeSnapshots;
 		}
 
 		bool operator !=(const RecipeBuildArguments& rhs) const
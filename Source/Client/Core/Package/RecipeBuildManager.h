@@ -1,10 +1,15 @@
-﻿// <copyright file="RecipeBuildManager.h" company="Soup">
+// <copyright file="RecipeBuildManager.h" company="Soup">
 // Copyright (c) Soup. All rights reserved.
 // </copyright>
 
 #pragma once
+#include "BuildExtensionRegistry.h"
+#include "ExtensionFingerprint.h"
+#include "PackageBuildScheduler.h"
+#include "PackageGraph.h"
 #include "RecipeBuildArguments.h"
 #include "RecipeExtensions.h"
+#include "RecipeValueView.h"
 #include "Build/Runner/BuildRunner.h"
 
 namespace Soup::Build::Runtime
@@ -35,266 +40,333 @@ namespace Soup::Build::Runtime
 			Recipe& recipe,
 			const RecipeBuildArguments& arguments)
 		{
-			// Clear the build set so we check all dependencies
-			_buildSet.clear();
-
-			// Enable log event ids to track individual builds
-			int projectId = 1;
-			bool isSystemBuild = false;
-			Log::EnsureListener().SetShowEventId(true);
-
-			// TODO: A scoped listener cleanup would be nice
-			try
+			// Load the full package graph before building anything
+			// Note: The dependency recipes are only read, so use the read only cache
+			auto recipeCache = RecipeCache(arguments.UseRecipeSnapshots);
+			_packageGraph = PackageGraph::Load(
+				workingDirectory,
+				recipe,
+				recipeCache,
+				[this](const Path& packageDirectory, const PackageReference& reference)
+				{
+					return GetPackageReferencePath(packageDirectory, reference);
+				});
+
+			// Skip the extension packages that have not changed since their binary was built
+			auto fingerprints = std::map<int, uint64_t>();
+			auto extensionPackages = std::set<int>();
+			auto requiredPackages = GetRequiredPackages(arguments, fingerprints, extensionPackages);
+
+			// Create the initial build state for each unique package
+			// Note: The recipe is exposed through a read only view that shares the recipe values,
+			// the package graph owns the recipes and outlives the build states
+			_packageStates.clear();
+			for (auto& [id, package] : _packageGraph.GetPackages())
 			{
-				auto rootParentSet = std::set<std::string>();
-				auto rootState = BuildState(ConvertToBuildState(recipe.GetTable()));
-				projectId = BuildRecipeAndDependencies(
-					projectId,
-					workingDirectory,
-					recipe,
-					arguments,
-					isSystemBuild,
-					rootParentSet,
-					rootState);
+				if (!requiredPackages.contains(id))
+					continue;
 
-				Log::EnsureListener().SetShowEventId(false);
+				auto recipeState = std::make_shared<RecipeValueView>(package.PackageRecipe.GetTable());
+				_packageStates.emplace(id, BuildState(std::move(recipeState)));
 			}
-			catch(...)
+
+			// Generate the build graphs for all packages and execute them as a single graph
+			// Note: A package can only generate its graph after the extension libraries from its
+			// dev dependencies have been built, so the packages are split into stages
+			// Note: Every stage reports to the same explanation log so the totals cover the whole build
+			auto explanationLog = RebuildExplanationLog();
+			for (auto& stage : GetBuildStages(requiredPackages))
 			{
-				Log::EnsureListener().SetShowEventId(false);
-				throw;
+				GenerateBuildGraphs(stage, arguments);
+
+				if (!arguments.SkipRun)
+				{
+					ExecuteBuildGraph(
+						workingDirectory,
+						stage,
+						arguments,
+						arguments.Explain ? &explanationLog : nullptr);
+					SaveExtensionFingerprints(stage, arguments, fingerprints, extensionPackages);
+				}
+
+				// Only the parent state of a completed package is needed by downstream packages
+				for (auto id : stage)
+				{
+					_packageStates.at(id).CompactBuildNodes();
+				}
 			}
+
+			if (arguments.Explain && !arguments.SkipRun)
+				explanationLog.ReportSummary();
 		}
 
 	private:
 		/// <summary>
-		/// Convert the recipe internal representation to initial build state
+		/// Find the packages that must be built, starting from the root package
+		/// Note: An extension package whose fingerprint matches the one saved with its binary
+		/// is skipped along with all of the packages only it depends on
 		/// </summary>
-		ValueTable ConvertToBuildState(const RecipeTable& table)
+		std::set<int> GetRequiredPackages(
+			const RecipeBuildArguments& arguments,
+			std::map<int, uint64_t>& fingerprints,
+			std::set<int>& extensionPackages)
 		{
-			auto result = ValueTable();
-			for (auto& value : table)
+			auto result = std::set<int>();
+			auto skippedPackages = std::set<int>();
+			auto pendingPackages = std::vector<int>({ _packageGraph.GetRootId() });
+			while (!pendingPackages.empty())
 			{
-				auto buildValue = ConvertToBuildState(value.second);
-				result.SetValue(value.first, std::move(buildValue));
+				auto id = pendingPackages.back();
+				pendingPackages.pop_back();
+				if (!result.insert(id).second)
+					continue;
+
+				auto& package = _packageGraph.GetPackage(id);
+				pendingPackages.insert(
+					pendingPackages.end(),
+					package.Dependencies.begin(),
+					package.Dependencies.end());
+
+				for (auto dependencyId : package.DevDependencies)
+				{
+					extensionPackages.insert(dependencyId);
+					if (result.contains(dependencyId) || skippedPackages.contains(dependencyId))
+						continue;
+
+					if (!arguments.ForceRebuild && IsExtensionUpToDate(dependencyId, arguments, fingerprints))
+					{
+						Log::Info("Extension up to date: " + _packageGraph.GetPackage(dependencyId).PackageRecipe.GetName());
+						skippedPackages.insert(dependencyId);
+						continue;
+					}
+
+					pendingPackages.push_back(dependencyId);
+				}
 			}
 
 			return result;
 		}
 
 		/// <summary>
-		/// Convert the recipe internal representation to initial build state
+		/// Check if the extension binary was built from the current fingerprint
 		/// </summary>
-		ValueList ConvertToBuildState(const RecipeList& list)
+		bool IsExtensionUpToDate(
+			int id,
+			const RecipeBuildArguments& arguments,
+			std::map<int, uint64_t>& fingerprints)
 		{
-			auto result = ValueList();
-			for (auto& value : list)
-			{
-				auto buildValue = ConvertToBuildState(value);
-				result.GetValues().push_back(std::move(buildValue));
-			}
-
-			return result;
+			auto& package = _packageGraph.GetPackage(id);
+			auto binaryDirectory = RecipeExtensions::GetBinaryDirectory(_systemCompiler, arguments.Flavor);
+			auto libraryPath = package.WorkingDirectory +
+				binaryDirectory +
+				Path(package.PackageRecipe.GetName() + ".dll");
+			if (!System::IFileSystem::Current().Exists(libraryPath))
+				return false;
+
+			auto objectDirectory = RecipeExtensions::GetObjectDirectory(_systemCompiler, arguments.Flavor);
+			uint64_t savedFingerprint = 0;
+			if (!ExtensionFingerprint::TryLoad(package.WorkingDirectory + objectDirectory, savedFingerprint))
+				return false;
+
+			return savedFingerprint == GetFingerprint(id, arguments, fingerprints);
 		}
 
 		/// <summary>
-		/// Convert the recipe internal representation to initial build state
+		/// Get the fingerprint for a package, which includes the fingerprints of all of its dependencies
 		/// </summary>
-		Value ConvertToBuildState(const RecipeValue& value)
+		uint64_t GetFingerprint(
+			int id,
+			const RecipeBuildArguments& arguments,
+			std::map<int, uint64_t>& fingerprints)
 		{
-			switch (value.GetType())
-			{
-				case RecipeValueType::Empty:
-					return Value();
-				case RecipeValueType::Table:
-					return Value(ConvertToBuildState(value.AsTable()));
-				case RecipeValueType::List:
-					return Value(ConvertToBuildState(value.AsList()));
-				case RecipeValueType::String:
-					return Value(value.AsString());
-				case RecipeValueType::Integer:
-					return Value(value.AsInteger());
-				case RecipeValueType::Float:
-					return Value(value.AsFloat());
-				case RecipeValueType::Boolean:
-					return Value(value.AsBoolean());
-				default:
-					throw std::runtime_error("Unknown value type.");
-			}
+			auto findResult = fingerprints.find(id);
+			if (findResult != fingerprints.end())
+				return findResult->second;
+
+			// Dependencies always have a lower id than the package, so the recursion ends
+			auto& package = _packageGraph.GetPackage(id);
+			auto dependencyFingerprints = std::vector<uint64_t>();
+			for (auto dependencyId : package.Dependencies)
+				dependencyFingerprints.push_back(GetFingerprint(dependencyId, arguments, fingerprints));
+			for (auto dependencyId : package.DevDependencies)
+				dependencyFingerprints.push_back(GetFingerprint(dependencyId, arguments, fingerprints));
+
+			auto objectDirectory = RecipeExtensions::GetObjectDirectory(_systemCompiler, arguments.Flavor);
+			auto fingerprint = ExtensionFingerprint::Compute(
+				package.WorkingDirectory,
+				package.WorkingDirectory + objectDirectory,
+				package.PackageRecipe,
+				_systemCompiler,
+				arguments.Flavor,
+				dependencyFingerprints);
+			fingerprints.emplace(id, fingerprint);
+			return fingerprint;
 		}
 
 		/// <summary>
-		/// Build the dependencies for the provided recipe recursively
+		/// Save the fingerprint for each extension package that was built in the stage
+		/// Note: The fingerprints are computed again to pick up the include history of this build
 		/// </summary>
-		int BuildRecipeAndDependencies(
-			int projectId,
-			const Path& workingDirectory,
-			Recipe& recipe,
+		void SaveExtensionFingerprints(
+			const std::vector<int>& stage,
 			const RecipeBuildArguments& arguments,
-			bool isSystemBuild,
-			const std::set<std::string>& parentSet,
-			BuildState& parentState)
+			std::map<int, uint64_t>& fingerprints,
+			const std::set<int>& extensionPackages)
 		{
-			// Add current package to the parent set when building child dependencies
-			auto activeParentSet = parentSet;
-			activeParentSet.insert(std::string(recipe.GetName()));
+			for (auto id : stage)
+				fingerprints.erase(id);
 
-			// Start a new active state that is initialized to the recipe itself
-			auto activeState = BuildState(ConvertToBuildState(recipe.GetTable()));
+			auto objectDirectory = RecipeExtensions::GetObjectDirectory(_systemCompiler, arguments.Flavor);
+			for (auto id : stage)
+			{
+				if (extensionPackages.contains(id))
+				{
+					auto& package = _packageGraph.GetPackage(id);
+					ExtensionFingerprint::Save(
+						package.WorkingDirectory + objectDirectory,
+						GetFingerprint(id, arguments, fingerprints));
+				}
+			}
+		}
 
-			if (recipe.HasDependencies())
+		/// <summary>
+		/// Split the packages into the stages that must be executed in order
+		/// Note: A package is placed in the first stage after all of its dev dependencies
+		/// and in the same stage or later than its runtime dependencies
+		/// </summary>
+		std::vector<std::vector<int>> GetBuildStages(const std::set<int>& requiredPackages) const
+		{
+			auto packageStages = std::map<int, size_t>();
+			auto stages = std::vector<std::vector<int>>();
+			for (auto& [id, package] : _packageGraph.GetPackages())
 			{
-				for (auto dependency : recipe.GetDependencies())
+				if (!requiredPackages.contains(id))
+					continue;
+
+				// Dependencies always have a lower id than the package
+				// Note: Skipped extension packages are already built and do not delay the package
+				size_t stage = 0;
+				for (auto dependencyId : package.Dependencies)
+					stage = std::max(stage, packageStages.at(dependencyId));
+				for (auto dependencyId : package.DevDependencies)
 				{
-					// Load this package recipe
-					auto packagePath = GetPackageReferencePath(workingDirectory, dependency);
-					auto packageRecipePath = packagePath + Path(Constants::RecipeFileName);
-					Recipe dependencyRecipe = {};
-					if (!RecipeExtensions::TryLoadFromFile(packageRecipePath, dependencyRecipe))
-					{
-						if (dependency.IsLocal())
-						{
-							Log::Error("The dependency Recipe does not exist: " + packageRecipePath.ToString());
-							Log::HighPriority("Make sure the path is correct and try again");
-						}
-						else
-						{
-							Log::Error("The Recipe version has not been installed: " + dependency.ToString());
-							Log::HighPriority("Run `install` and try again");
-						}
-
-						// Nothing we can do, exit
-						throw HandledException();
-					}
+					auto findResult = packageStages.find(dependencyId);
+					if (findResult != packageStages.end())
+						stage = std::max(stage, findResult->second + 1);
+				}
 
-					// Ensure we do not have any circular dependencies
-					if (activeParentSet.contains(dependencyRecipe.GetName()))
-					{
-						Log::Error("Found circular dependency: " + recipe.GetName() + " -> " + dependencyRecipe.GetName());
-						throw std::runtime_error("BuildRecipeAndDependencies: Circular dependency.");
-					}
+				packageStages.emplace(id, stage);
+				if (stages.size() <= stage)
+					stages.resize(stage + 1);
+				stages[stage].push_back(id);
+			}
 
-					// Build all recursive dependencies
-					projectId = BuildRecipeAndDependencies(
-						projectId,
-						packagePath,
-						dependencyRecipe,
-						arguments,
-						isSystemBuild,
-						activeParentSet,
-						activeState);
+			return stages;
+		}
+
+		/// <summary>
+		/// Generate the build graphs for all packages in a stage
+		/// Note: No build operations run while generating the graphs, so independent packages
+		/// generate concurrently without sharing the job budget
+		/// </summary>
+		void GenerateBuildGraphs(
+			const std::vector<int>& stage,
+			const RecipeBuildArguments& arguments)
+		{
+			auto stagePackages = std::set<int>(stage.begin(), stage.end());
+			auto scheduler = PackageBuildScheduler(arguments.MaxPackageParallelism);
+			for (auto id : stage)
+			{
+				// Only wait for dependencies in the same stage, all earlier stages are complete
+				auto dependencies = std::vector<int>();
+				for (auto dependencyId : _packageGraph.GetPackage(id).Dependencies)
+				{
+					if (stagePackages.contains(dependencyId))
+						dependencies.push_back(dependencyId);
 				}
+
+				scheduler.AddPackage(id, std::move(dependencies));
 			}
 
-			if (recipe.HasDevDependencies())
-			{
-				for (auto dependency : recipe.GetDevDependencies())
+			scheduler.Execute(
+				[this](int id)
 				{
-					// Load this package recipe
-					auto packagePath = GetPackageReferencePath(workingDirectory, dependency);
-					auto packageRecipePath = packagePath + Path(Constants::RecipeFileName);
-					Recipe dependencyRecipe = {};
-					if (!RecipeExtensions::TryLoadFromFile(packageRecipePath, dependencyRecipe))
+					// Move the shared state from each dependency into the package state
+					// Note: Merge on the calling thread in declaration order to keep the result deterministic
+					// Dev dependencies are not merged, they are not exposed past the package
+					auto& state = _packageStates.at(id);
+					for (auto dependencyId : _packageGraph.GetPackage(id).Dependencies)
 					{
-						Log::Error("Failed to load the extension package: " + packageRecipePath.ToString());
-						throw std::runtime_error("BuildRecipeAndDependencies: Failed to load dependency.");
+						state.CombineChildState(_packageStates.at(dependencyId));
 					}
+				},
+				[this, &arguments](int id)
+				{
+					BuildRecipe(id, arguments);
 
-					// Ensure we do not have any circular dependencies
-					if (activeParentSet.contains(dependencyRecipe.GetName()))
-					{
-						Log::Error("Found circular dev dependency: " + recipe.GetName() + " -> " + dependencyRecipe.GetName());
-						throw std::runtime_error("BuildRecipeAndDependencies: Circular dev dependency.");
-					}
+					// The active state is fully captured in the build nodes and the parent state
+					_packageStates.at(id).CompactActiveState();
+				});
+		}
 
-					// Build all recursive dependencies
-					// Note: Ignore all shared dependencies. They are not exposed past dev dependencies.
-					auto ignoredBuildState = BuildState(ConvertToBuildState(dependencyRecipe.GetTable()));
-					projectId = BuildRecipeAndDependencies(
-						projectId,
-						packagePath,
-						dependencyRecipe,
-						arguments,
-						true,
-						activeParentSet,
-						ignoredBuildState);
-				}
+		/// <summary>
+		/// Execute the build graphs for all packages in a stage as a single graph
+		/// Note: A node that consumes a file from another package only waits on the node that
+		/// produces it instead of the entire upstream package
+		/// </summary>
+		void ExecuteBuildGraph(
+			const Path& workingDirectory,
+			const std::vector<int>& stage,
+			const RecipeBuildArguments& arguments,
+			RebuildExplanationLog* explanationLog)
+		{
+			auto objectDirectory = RecipeExtensions::GetObjectDirectory(_systemCompiler, arguments.Flavor);
+			auto runner = BuildRunner(workingDirectory, arguments.ResourceLimits, explanationLog);
+			for (auto id : stage)
+			{
+				auto& package = _packageGraph.GetPackage(id);
+				runner.AddPackage(
+					_packageStates.at(id).GetBuildNodes(),
+					package.WorkingDirectory + objectDirectory,
+					arguments.ForceRebuild);
 			}
 
-			// Build the root recipe
-			projectId = BuildRecipe(
-				projectId,
-				workingDirectory,
-				recipe,
-				arguments,
-				isSystemBuild,
-				activeState,
-				parentState);
-
-			// Return the updated project id after building all dependencies
-			return projectId;
+			runner.Execute();
 		}
 
 		/// <summary>
 		/// The core build that will either invoke the recipe builder directly
-		/// or compile it into an executable and invoke it.
+		/// or compile it into an executable and invoke it to generate the package build graph.
+		/// Note: Runs on a package build worker thread
 		/// </summary>
-		int BuildRecipe(
+		void BuildRecipe(
 			int projectId,
-			const Path& workingDirectory,
-			Recipe& recipe,
-			const RecipeBuildArguments& arguments,
-			bool isSystemBuild,
-			BuildState& activeState,
-			BuildState& parentState)
+			const RecipeBuildArguments& arguments)
 		{
 			// TODO: RAII for active id
 			try
 			{
-				Log::SetActiveId(projectId);
+				PackageTraceListener::SetActiveId(projectId);
 				Log::Diag("Running InProcess Build");
 
-				auto findBuildState = _buildSet.find(recipe.GetName());
-				if (findBuildState != _buildSet.end())
-				{
-					Log::Diag("Recipe already built: " + recipe.GetName());
-
-					// Move the parent state from active into the parents active state :)
-					parentState.CombineChildState(findBuildState->second);
-				}
-				else
-				{
-					// Run the required builds in process
-					// This will break the circular requirments for the core build libraries
-					RunInProcessBuild(
-						projectId,
-						workingDirectory,
-						recipe,
-						arguments,
-						isSystemBuild,
-						activeState);
-
-					// Move the parent state from active into the parents active state :)
-					parentState.CombineChildState(activeState);
-
-					// Keep track of the packages we have already built
-					// TODO: Verify unique names
-					_buildSet.emplace(recipe.GetName(), std::move(activeState));
-
-					// Move to the next build project id
-					projectId++;
-				}
-
+				// Run the required builds in process
+				// This will break the circular requirments for the core build libraries
+				auto& package = _packageGraph.GetPackage(projectId);
+				RunInProcessBuild(
+					projectId,
+					package.WorkingDirectory,
+					package.PackageRecipe,
+					arguments,
+					package.IsSystemBuild,
+					_packageStates.at(projectId));
 
-				Log::SetActiveId(0);
+				PackageTraceListener::SetActiveId(0);
 			}
 			catch(...)
 			{
-				Log::SetActiveId(0);
+				PackageTraceListener::SetActiveId(0);
 				throw;
 			}
-
-			return projectId;
 		}
 
 		void RunInProcessBuild(
@@ -305,83 +377,129 @@ namespace Soup::Build::Runtime
 			bool isSystemBuild,
 			BuildState& state)
 		{
-			// Ensure the external build extension libraries outlive all usage in the build system
-			auto activeExtensionLibraries = std::vector<System::Library>();
+			// Create a new build system for the requested build
+			auto buildSystem = BuildSystem();
+			auto activeState = Extensions::ValueTableWrapper(state.GetActiveState());
+
+			// Select the correct compiler to use
+			std::string activeCompiler = "";
+			if (isSystemBuild)
+			{
+				Log::HighPriority("System Build '" + recipe.GetName() + "'");
+				activeCompiler = _systemCompiler;
+			}
+			else
+			{
+				Log::HighPriority("Build '" + recipe.GetName() + "'");
+				activeCompiler = _runtimeCompiler;
+			}
 
+			auto binaryDirectory = RecipeExtensions::GetBinaryDirectory(_systemCompiler, arguments.Flavor);
+			auto objectDirectory = RecipeExtensions::GetObjectDirectory(_systemCompiler, arguments.Flavor);
+
+			// Set the input properties
+			activeState.EnsureValue("PackageRoot").SetValueString(packageRoot.ToString());
+			activeState.EnsureValue("ForceRebuild").SetValueBoolean(arguments.ForceRebuild); // TOOD: Remove?
+			activeState.EnsureValue("BuildFlavor").SetValueString(arguments.Flavor);
+			activeState.EnsureValue("CompilerName").SetValueString(activeCompiler);
+			activeState.EnsureValue("BinaryDirectory").SetValueString(binaryDirectory.ToString());
+			activeState.EnsureValue("ObjectDirectory").SetValueString(objectDirectory.ToString());
+			activeState.EnsureValue("PlatformLibraries").SetValueStringList(arguments.PlatformLibraries);
+			activeState.EnsureValue("PlatformIncludePaths").SetValueStringList(arguments.PlatformIncludePaths);
+			activeState.EnsureValue("PlatformLibraryPaths").SetValueStringList(arguments.PlatformLibraryPaths);
+			activeState.EnsureValue("PlatformPreprocessorDefinitions").SetValueStringList(arguments.PlatformPreprocessorDefinitions);
+			activeState.EnsureValue("MaxParallelism").SetValueInteger(
+				static_cast<int64_t>(arguments.ResourceLimits.MaxParallelism));
+
+			// Unity builds and the automatic precompiled header are planned
+			// from the include history of the previous build
+			bool useUnityBuild = recipe.HasUnityBuild() && recipe.GetUnityBuild();
+			bool useAutoPrecompiledHeader = recipe.HasPrecompiledHeader() && recipe.GetPrecompiledHeader() == "Auto";
+			if ((useUnityBuild || useAutoPrecompiledHeader) && recipe.HasSource())
 			{
-				// Create a new build system for the requested build
-				auto buildSystem = BuildSystem();
-				auto activeState = Extensions::ValueTableWrapper(state.GetActiveState());
+				SetIncludeHistory(
+					packageRoot,
+					packageRoot + objectDirectory,
+					recipe.GetSource(),
+					activeState);
+			}
 
-				// Select the correct compiler to use
-				std::string activeCompiler = "";
-				if (isSystemBuild)
-				{
-					Log::HighPriority("System Build '" + recipe.GetName() + "'");
-					activeCompiler = _systemCompiler;
-				}
-				else
-				{
-					Log::HighPriority("Build '" + recipe.GetName() + "'");
-					activeCompiler = _runtimeCompiler;
-				}
+			// Run all build extensions
+			// Note: The extension libraries are loaded once and stay open for the whole process
+
+			// Run the RecipeBuild extension to inject core build tasks
+			auto recipeBuildExtensionPath = Path("RecipeBuildExtension.dll");
+			RunBuildExtension(recipeBuildExtensionPath, buildSystem);
+
+			// Run all build extensions
+			// Note: Use the recipes already loaded in the package graph to find the extension libraries
+			for (auto dependencyId : _packageGraph.GetPackage(projectId).DevDependencies)
+			{
+				auto& dependency = _packageGraph.GetPackage(dependencyId);
+				auto libraryPath = dependency.WorkingDirectory +
+					binaryDirectory +
+					Path(dependency.PackageRecipe.GetName() + ".dll");
+
+				RunBuildExtension(libraryPath, buildSystem);
+			}
+
+			// Run the build to generate the build nodes
+			// Note: The nodes are executed along with all other packages in the stage
+			buildSystem.Execute(state);
+		}
 
-				auto binaryDirectory = RecipeExtensions::GetBinaryDirectory(_systemCompiler, arguments.Flavor);
-				auto objectDirectory = RecipeExtensions::GetObjectDirectory(_systemCompiler, arguments.Flavor);
-
-				// Set the input properties
-				activeState.EnsureValue("PackageRoot").SetValueString(packageRoot.ToString());
-				activeState.EnsureValue("ForceRebuild").SetValueBoolean(arguments.ForceRebuild); // TOOD: Remove?
-				activeState.EnsureValue("BuildFlavor").SetValueString(arguments.Flavor);
-				activeState.EnsureValue("CompilerName").SetValueString(activeCompiler);
-				activeState.EnsureValue("BinaryDirectory").SetValueString(binaryDirectory.ToString());
-				activeState.EnsureValue("ObjectDirectory").SetValueString(objectDirectory.ToString());
-				activeState.EnsureValue("PlatformLibraries").SetValueStringList(arguments.PlatformLibraries);
-				activeState.EnsureValue("PlatformIncludePaths").SetValueStringList(arguments.PlatformIncludePaths);
-				activeState.EnsureValue("PlatformLibraryPaths").SetValueStringList(arguments.PlatformLibraryPaths);
-				activeState.EnsureValue("PlatformPreprocessorDefinitions").SetValueStringList(arguments.PlatformPreprocessorDefinitions);
-
-				// Run all build extensions
-				// Note: Keep the extension libraries open while running the build system
-				// to ensure their memory is kept alive
-
-				// Run the RecipeBuild extension to inject core build tasks
-				auto recipeBuildExtensionPath = Path("RecipeBuildExtension.dll");
-				auto recipeBuildLibrary = RunBuildExtension(recipeBuildExtensionPath, buildSystem);
-				activeExtensionLibraries.push_back(std::move(recipeBuildLibrary));
-
-				// Run all build extensions
-				if (recipe.HasDevDependencies())
+		/// <summary>
+		/// Provide the include closure and direct includes for each source file along with the
+		/// set of files edited since the last build
+		/// </summary>
+		void SetIncludeHistory(
+			const Path& packageRoot,
+			const Path& targetDirectory,
+			const std::vector<std::string>& sourceFiles,
+			Extensions::ValueTableWrapper& activeState)
+		{
+			auto history = BuildHistory();
+			if (!BuildHistoryManager::TryLoadState(targetDirectory, history))
+			{
+				Log::Diag("No include history available");
+				return;
+			}
+
+			auto historyWriteTime = System::IFileSystem::Current().GetLastWriteTime(
+				BuildHistoryManager::GetStateFile(targetDirectory));
+
+			auto sourceIncludes = activeState.EnsureValue("SourceIncludes").EnsureTable();
+			auto sourceDirectIncludes = activeState.EnsureValue("SourceDirectIncludes").EnsureTable();
+			auto recentlyEditedFiles = std::vector<std::string>();
+			for (auto& source : sourceFiles)
+			{
+				// Results are always keyed by the relative source path the planner uses
+				auto sourceFile = Path(source);
+				auto historyFile = Path();
+				if (history.TryFindSourceFile(packageRoot, sourceFile, historyFile))
 				{
-					for (auto dependency : recipe.GetDevDependencies())
+					auto closure = std::vector<Path>();
+					if (history.TryBuildIncludeClosure(historyFile, closure))
 					{
-						auto packagePath = RecipeExtensions::GetPackageReferencePath(packageRoot, dependency);
-						auto libraryPath = RecipeExtensions::GetRecipeOutputPath(
-							packagePath,
-							binaryDirectory,
-							std::string("dll"));
-						
-						auto library = RunBuildExtension(libraryPath, buildSystem);
-						activeExtensionLibraries.push_back(std::move(library));
+						sourceIncludes.EnsureValue(sourceFile.ToString()).SetValuePathList(closure);
 					}
-				}
-
-				// Run the build
-				buildSystem.Execute(state);
 
-				// Find the output object directory so we can use it in the runner
-				auto buildTable = activeState.GetValue("Build").AsTable();
+					auto includes = std::vector<Path>();
+					if (history.TryGetIncludes(historyFile, includes))
+					{
+						sourceDirectIncludes.EnsureValue(sourceFile.ToString()).SetValuePathList(includes);
+					}
+				}
 
-				if (!arguments.SkipRun)
+				auto sourcePath = packageRoot + Path(source);
+				if (System::IFileSystem::Current().Exists(sourcePath) &&
+					System::IFileSystem::Current().GetLastWriteTime(sourcePath) > historyWriteTime)
 				{
-					// Execute the build nodes
-					auto runner = BuildRunner(packageRoot);
-					runner.Execute(
-						state.GetBuildNodes(),
-						objectDirectory,
-						arguments.ForceRebuild);
+					recentlyEditedFiles.push_back(source);
 				}
 			}
+
+			activeState.EnsureValue("RecentlyEditedFiles").SetValueStringList(recentlyEditedFiles);
 		}
 
 		Path GetPackageReferencePath(const Path& workingDirectory, const PackageReference& reference) const
@@ -405,17 +523,14 @@ namespace Soup::Build::Runtime
 			return packagePath;
 		}
 
-		System::Library RunBuildExtension(
-			Path& libraryPath,
+		void RunBuildExtension(
+			const Path& libraryPath,
 			IBuildSystem& buildSystem)
 		{
 			try
 			{
 				Log::Diag("Running Build Extension: " + libraryPath.ToString());
-				auto library = System::DynamicLibraryManager::LoadDynamicLibrary(
-					libraryPath.ToString().c_str());
-				auto function = (int(*)(IBuildSystem&))library.GetFunction(
-					"RegisterBuildExtension");
+				auto function = BuildExtensionRegistry::Current().GetRegisterFunction(libraryPath);
 				auto result = function(buildSystem);
 				if (result != 0)
 				{
@@ -425,9 +540,6 @@ namespace Soup::Build::Runtime
 				{
 					Log::Info("Build Extension Done");
 				}
-
-				// Keep the library open to ensure the registered tasks are not lost
-				return library;
 			}
 			catch (...)
 			{
@@ -439,6 +551,7 @@ namespace Soup::Build::Runtime
 	private:
 		std::string _systemCompiler;
 		std::string _runtimeCompiler;
-		std::map<std::string, BuildState> _buildSet;
+		PackageGraph _packageGraph;
+		std::map<int, BuildState> _packageStates;
 	};
 }
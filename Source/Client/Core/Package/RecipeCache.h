@@ -0,0 +1,200 @@
+﻿// <copyright file="RecipeCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "RecipeBinary.h"
+#include "RecipeToml.h"
+
+namespace Soup
+{
+	/// <summary>
+	/// The read only recipe cache that loads each package recipe once while the file is unchanged
+	/// and optionally keeps a compiled snapshot of the recipe next to the package build state
+	/// Note: Recipes loaded through the cache do not have comments and must not be saved
+	/// </summary>
+	export class RecipeCache
+	{
+	private:
+		/// <summary>
+		/// A loaded recipe along with the write time of the file it was loaded from
+		/// </summary>
+		struct CacheEntry
+		{
+			std::time_t LastWriteTime;
+			Recipe Value;
+		};
+
+	public:
+		/// <summary>
+		/// Gets the location of the compiled recipe snapshot for a package
+		/// </summary>
+		static Path GetSnapshotFile(const Path& packageDirectory)
+		{
+			return packageDirectory +
+				Path(Constants::ProjectGenerateFolderName) +
+				Path(Constants::RecipeSnapshotFileName);
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="RecipeCache"/> class.
+		/// </summary>
+		RecipeCache(bool useSnapshots) :
+			_useSnapshots(useSnapshots),
+			_entries(),
+			_mutex()
+		{
+		}
+
+		/// <summary>
+		/// Attempt to load the recipe for the package in the provided directory
+		/// </summary>
+		bool TryLoad(
+			const Path& packageDirectory,
+			Recipe& result)
+		{
+			auto recipeFile = packageDirectory + Path(Constants::RecipeFileName);
+
+			// Verify the requested file exists
+			Log::Diag("Load Recipe: " + recipeFile.ToString());
+			if (!System::IFileSystem::Current().Exists(recipeFile))
+			{
+				Log::Info("Recipe file does not exist.");
+				return false;
+			}
+
+			// Reuse the loaded recipe if the file has not changed
+			auto lastWriteTime = System::IFileSystem::Current().GetLastWriteTime(recipeFile);
+			auto key = recipeFile.ToString();
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+				auto findEntry = _entries.find(key);
+				if (findEntry != _entries.end() && findEntry->second.LastWriteTime == lastWriteTime)
+				{
+					result = findEntry->second.Value;
+					return true;
+				}
+			}
+
+			if (_useSnapshots)
+			{
+				// The snapshot is only used while it was compiled from the exact same recipe content
+				auto content = std::stringstream();
+				{
+					auto file = System::IFileSystem::Current().OpenRead(recipeFile, true);
+					content << file->GetInStream().rdbuf();
+				}
+
+				auto contentHash = ContentHash();
+				contentHash.Add(content.str());
+				auto snapshotFile = GetSnapshotFile(packageDirectory);
+				if (!TryLoadSnapshot(snapshotFile, contentHash.GetValue(), result))
+				{
+					if (!TryParse(recipeFile, content, result))
+						return false;
+
+					SaveSnapshot(packageDirectory, snapshotFile, contentHash.GetValue(), result);
+				}
+			}
+			else
+			{
+				// Read the contents of the recipe file
+				auto file = System::IFileSystem::Current().OpenRead(recipeFile, true);
+				if (!TryParse(recipeFile, file->GetInStream(), result))
+					return false;
+			}
+
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+				_entries.insert_or_assign(key, CacheEntry({ lastWriteTime, result }));
+			}
+
+			return true;
+		}
+
+	private:
+		/// <summary>
+		/// Parse the recipe file contents
+		/// </summary>
+		static bool TryParse(
+			const Path& recipeFile,
+			std::istream& stream,
+			Recipe& result)
+		{
+			try
+			{
+				result = RecipeToml::DeserializeReadOnly(recipeFile, stream);
+				return true;
+			}
+			catch (std::exception& ex)
+			{
+				Log::Error(std::string("Deserialize Threw: ") + ex.what());
+				Log::Info("Failed to parse Recipe.");
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Attempt to load the compiled snapshot if it was compiled from the current recipe content
+		/// </summary>
+		bool TryLoadSnapshot(
+			const Path& snapshotFile,
+			uint64_t contentHash,
+			Recipe& result)
+		{
+			if (!System::IFileSystem::Current().Exists(snapshotFile))
+				return false;
+
+			try
+			{
+				auto file = System::IFileSystem::Current().OpenRead(snapshotFile, true);
+				if (!RecipeBinary::TryDeserialize(file->GetInStream(), contentHash, result))
+				{
+					Log::Diag("Recipe snapshot is out of date");
+					return false;
+				}
+
+				return true;
+			}
+			catch (std::exception& ex)
+			{
+				// A damaged snapshot is replaced with a fresh copy
+				Log::Diag(std::string("Failed to load recipe snapshot: ") + ex.what());
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Save the compiled snapshot for the next load
+		/// Note: The snapshot is only an optimization, failing to write it does not fail the load
+		/// </summary>
+		void SaveSnapshot(
+			const Path& packageDirectory,
+			const Path& snapshotFile,
+			uint64_t contentHash,
+			Recipe& recipe)
+		{
+			try
+			{
+				auto snapshotFolder = packageDirectory + Path(Constants::ProjectGenerateFolderName);
+				if (!System::IFileSystem::Current().Exists(snapshotFolder))
+				{
+					System::IFileSystem::Current().CreateDirectory2(snapshotFolder);
+				}
+
+				auto file = System::IFileSystem::Current().OpenWrite(snapshotFile, true);
+				RecipeBinary::Serialize(recipe, contentHash, file->GetOutStream());
+				file->Close();
+			}
+			catch (std::exception& ex)
+			{
+				Log::Diag(std::string("Failed to save recipe snapshot: ") + ex.what());
+			}
+		}
+
+	private:
+		bool _useSnapshots;
+		std::map<std::string, CacheEntry> _entries;
+		std::mutex _mutex;
+	};
+}
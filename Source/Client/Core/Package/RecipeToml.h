@@ -10,6 +10,7 @@ namespace Soup
 	using TomlValue = toml::basic_value<toml::preserve_comments>;
 	using TomlArray = std::vector<TomlValue>;
 	using TomlTable = std::unordered_map<toml::key, TomlValue>;
+	using TomlReadOnlyValue = toml::basic_value<toml::discard_comments>;
 
 	/// <summary>
 	/// The recipe Toml serialize manager
@@ -43,6 +44,32 @@ namespace Soup
 			}
 		}
 
+		/// <summary>
+		/// Load from stream without the comments for a recipe that will not be saved
+		/// </summary>
+		static Recipe DeserializeReadOnly(
+			const Path& recipeFile,
+			std::istream& stream)
+		{
+			try
+			{
+				// Read the contents of the recipe file
+				auto root = toml::parse<toml::discard_comments>(stream, recipeFile.ToString());
+				if (!root.is_table())
+					throw std::runtime_error("Recipe Toml file root must be a table.");
+
+				// Load the entire root table
+				auto table = RecipeTable();
+				Parse(table, root.as_table());
+
+				return Recipe(std::move(table));
+			}
+			catch(const toml::exception& ex)
+			{
+				throw std::runtime_error(std::string("Parsing the Recipe Toml failed: ") + ex.what());
+			}
+		}
+
 		/// <summary>
 		/// Save the recipe to the root file
 		/// </summary>
@@ -56,13 +83,17 @@ namespace Soup
 		}
 
 	private:
-		static void Parse(RecipeValue& target, const TomlValue& source)
+		template<typename TComments>
+		static void Parse(RecipeValue& target, const toml::basic_value<TComments>& source)
 		{
 			// Copy over all of the comments
-			target.GetComments().insert(
-				target.GetComments().end(),
-				source.comments().begin(),
-				source.comments().end());
+			if constexpr (std::is_same_v<TComments, toml::preserve_comments>)
+			{
+				target.GetComments().insert(
+					target.GetComments().end(),
+					source.comments().begin(),
+					source.comments().end());
+			}
 
 			switch (source.type())
 			{
@@ -119,7 +150,8 @@ namespace Soup
 			}
 		}
 
-		static void Parse(RecipeTable& target, const TomlTable& source)
+		template<typename TTable>
+		static void Parse(RecipeTable& target, const TTable& source)
 		{
 			for (auto& item : source)
 			{
@@ -129,7 +161,8 @@ namespace Soup
 			}
 		}
 
-		static void Parse(RecipeList& target, const TomlArray& source)
+		template<typename TArray>
+		static void Parse(RecipeList& target, const TArray& source)
 		{
 			target.reserve(source.size());
 			for (size_t i = 0; i < source.size(); i++)
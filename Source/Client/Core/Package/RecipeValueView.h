@@ -0,0 +1,609 @@
+﻿// <copyright file="RecipeValueView.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "RecipeValue.h"
+
+namespace Soup::Build::Runtime
+{
+	class RecipeTableView;
+	class RecipeListView;
+
+	/// <summary>
+	/// A recipe string exposed in place that takes a private copy when it is first modified
+	/// </summary>
+	class RecipeStringView : public IValuePrimitive<const char*>
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the RecipeStringView class
+		/// </summary>
+		RecipeStringView(const std::string& source) :
+			_source(source),
+			_value()
+		{
+		}
+
+		OperationResult TryGetValue(const char*& value) const noexcept override final
+		{
+			value = _value.has_value() ? _value->c_str() : _source.c_str();
+			return 0;
+		}
+
+		OperationResult TrySetValue(const char* value) noexcept override final
+		{
+			try
+			{
+				// String assign can fail
+				_value = value;
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+	private:
+		const std::string& _source;
+		std::optional<std::string> _value;
+	};
+
+	/// <summary>
+	/// A recipe number or boolean value, small enough to always hold a copy
+	/// </summary>
+	template<typename T>
+	class RecipePrimitiveView : public IValuePrimitive<T>
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the RecipePrimitiveView class
+		/// </summary>
+		RecipePrimitiveView(T value) :
+			_value(value)
+		{
+		}
+
+		OperationResult TryGetValue(T& value) const noexcept override final
+		{
+			value = _value;
+			return 0;
+		}
+
+		OperationResult TrySetValue(T value) noexcept override final
+		{
+			_value = value;
+			return 0;
+		}
+
+	private:
+		T _value;
+	};
+
+	/// <summary>
+	/// A read only view of a parsed recipe value that is exposed as build state without
+	/// converting it. The views for nested values are created on first access and a value only
+	/// takes a private copy when a task changes its type.
+	/// Note: The recipe must outlive the view and must not change while it is in use
+	/// </summary>
+	export class RecipeValueView : public IValue
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the RecipeValueView class
+		/// </summary>
+		RecipeValueView(const RecipeTable& table);
+		RecipeValueView(const RecipeValue& source);
+		RecipeValueView(Value value);
+		~RecipeValueView();
+
+		/// <summary>
+		/// Type checker methods
+		/// </summary>
+		OperationResult TryGetType(uint64_t& type) const noexcept override final;
+		OperationResult TrySetType(uint64_t type) noexcept override final;
+
+		/// <summary>
+		/// Type specific accessor methods
+		/// </summary>
+		OperationResult TryGetAsTable(IValueTable*& result) noexcept override final;
+		OperationResult TryGetAsList(IValueList*& result) noexcept override final;
+		OperationResult TryGetAsString(IValuePrimitive<const char*>*& result) noexcept override final;
+		OperationResult TryGetAsInteger(IValuePrimitive<int64_t>*& result) noexcept override final;
+		OperationResult TryGetAsFloat(IValuePrimitive<double>*& result) noexcept override final;
+		OperationResult TryGetAsBoolean(IValuePrimitive<bool>*& result) noexcept override final;
+
+	private:
+		RecipeValueType GetSourceType() const;
+
+	private:
+		const RecipeValue* _source;
+		const RecipeTable* _sourceTable;
+		std::unique_ptr<Value> _owned;
+
+		std::unique_ptr<RecipeTableView> _table;
+		std::unique_ptr<RecipeListView> _list;
+		std::unique_ptr<RecipeStringView> _string;
+		std::unique_ptr<RecipePrimitiveView<int64_t>> _integer;
+		std::unique_ptr<RecipePrimitiveView<double>> _float;
+		std::unique_ptr<RecipePrimitiveView<bool>> _boolean;
+	};
+
+	/// <summary>
+	/// A read only view of a recipe table, new values are stored next to the recipe values
+	/// </summary>
+	class RecipeTableView : public IValueTable
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the RecipeTableView class
+		/// </summary>
+		RecipeTableView(const RecipeTable& source) :
+			_source(source),
+			_views(),
+			_added()
+		{
+		}
+
+		/// <summary>
+		/// Property access methods
+		/// </summary>
+		OperationResult TryCheckHasValue(const char* name, bool& result) const noexcept override final
+		{
+			try
+			{
+				result = false;
+				if (_source.contains(name))
+				{
+					result = true;
+					return 0;
+				}
+
+				return _added.TryCheckHasValue(name, result);
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		OperationResult TryGetValue(const char* name, IValue*& result) noexcept override final
+		{
+			try
+			{
+				result = nullptr;
+				auto findView = _views.find(name);
+				if (findView != _views.end())
+				{
+					result = findView->second.get();
+					return 0;
+				}
+
+				auto findSource = _source.find(name);
+				if (findSource != _source.end())
+				{
+					auto insertResult = _views.emplace(
+						findSource->first,
+						std::make_unique<RecipeValueView>(findSource->second));
+					result = insertResult.first->second.get();
+					return 0;
+				}
+
+				return _added.TryGetValue(name, result);
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		OperationResult TryCreateValue(const char* name, IValue*& result) noexcept override final
+		{
+			try
+			{
+				result = nullptr;
+
+				// Match the build state table and fail to replace an existing value
+				if (_source.contains(name))
+					return -1;
+
+				return _added.TryCreateValue(name, result);
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+	private:
+		const RecipeTable& _source;
+		std::unordered_map<std::string, std::unique_ptr<RecipeValueView>> _views;
+		ValueTable _added;
+	};
+
+	/// <summary>
+	/// A read only view of a recipe list, the bulk string access reads the recipe in place
+	/// </summary>
+	class RecipeListView : public IValueList2
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the RecipeListView class
+		/// </summary>
+		RecipeListView(const RecipeList& source) :
+			_source(source),
+			_sourceSize(source.size()),
+			_views(source.size())
+		{
+		}
+
+		/// <summary>
+		/// Size access methods
+		/// </summary>
+		uint64_t GetSize() const noexcept override final
+		{
+			return _views.size();
+		}
+
+		OperationResult Resize(uint64_t size) noexcept override final
+		{
+			try
+			{
+				// Values past the new size are no longer backed by the recipe
+				_views.resize(size);
+				_sourceSize = std::min<size_t>(_sourceSize, size);
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		/// <summary>
+		/// Type specific accessor methods
+		/// </summary>
+		OperationResult TryGetValueAt(uint64_t index, IValue*& result) noexcept override final
+		{
+			try
+			{
+				result = nullptr;
+				auto& view = _views.at(index);
+				if (view == nullptr)
+				{
+					if (index < _sourceSize)
+						view = std::make_unique<RecipeValueView>(_source[index]);
+					else
+						view = std::make_unique<RecipeValueView>(Value());
+				}
+
+				result = view.get();
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		/// <summary>
+		/// Bulk string accessor methods
+		/// </summary>
+		OperationResult TryGetStringValues(uint64_t index, uint64_t count, const char** result) noexcept override final
+		{
+			try
+			{
+				if (index > _views.size() || count > _views.size() - index)
+					return -2;
+
+				for (uint64_t i = 0; i < count; i++)
+				{
+					auto valueIndex = index + i;
+					auto& view = _views[valueIndex];
+					if (view != nullptr)
+					{
+						IValuePrimitive<const char*>* value = nullptr;
+						if (view->TryGetAsString(value) != 0)
+							return -2;
+
+						value->TryGetValue(result[i]);
+					}
+					else if (valueIndex < _sourceSize && _source[valueIndex].GetType() == RecipeValueType::String)
+					{
+						result[i] = _source[valueIndex].AsString().c_str();
+					}
+					else
+					{
+						// Wrong type
+						return -2;
+					}
+				}
+
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+		OperationResult TryAppendStringValues(
+			uint64_t count,
+			const char* const* values,
+			const uint64_t* lengths) noexcept override final
+		{
+			try
+			{
+				_views.reserve(_views.size() + count);
+				for (uint64_t i = 0; i < count; i++)
+				{
+					_views.push_back(std::make_unique<RecipeValueView>(
+						Value(std::string(values[i], lengths[i]))));
+				}
+
+				return 0;
+			}
+			catch (...)
+			{
+				// Unknown error
+				return -1;
+			}
+		}
+
+	private:
+		const RecipeList& _source;
+		size_t _sourceSize;
+		std::vector<std::unique_ptr<RecipeValueView>> _views;
+	};
+
+	inline RecipeValueView::RecipeValueView(const RecipeTable& table) :
+		_source(nullptr),
+		_sourceTable(&table),
+		_owned(),
+		_table(),
+		_list(),
+		_string(),
+		_integer(),
+		_float(),
+		_boolean()
+	{
+	}
+
+	inline RecipeValueView::RecipeValueView(const RecipeValue& source) :
+		_source(&source),
+		_sourceTable(nullptr),
+		_owned(),
+		_table(),
+		_list(),
+		_string(),
+		_integer(),
+		_float(),
+		_boolean()
+	{
+	}
+
+	inline RecipeValueView::RecipeValueView(Value value) :
+		_source(nullptr),
+		_sourceTable(nullptr),
+		_owned(std::make_unique<Value>(std::move(value))),
+		_table(),
+		_list(),
+		_string(),
+		_integer(),
+		_float(),
+		_boolean()
+	{
+	}
+
+	inline RecipeValueView::~RecipeValueView()
+	{
+	}
+
+	inline OperationResult RecipeValueView::TryGetType(uint64_t& type) const noexcept
+	{
+		try
+		{
+			if (_owned != nullptr)
+				return _owned->TryGetType(type);
+
+			// Note: The recipe value types match the order of the build value types
+			type = static_cast<uint64_t>(GetSourceType());
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline OperationResult RecipeValueView::TrySetType(uint64_t type) noexcept
+	{
+		try
+		{
+			if (_owned != nullptr)
+				return _owned->TrySetType(type);
+
+			// Ignore requests to set to same type
+			if (type == static_cast<uint64_t>(GetSourceType()))
+				return 0;
+
+			// Stop using the recipe value once the type changes
+			auto owned = std::make_unique<Value>();
+			auto status = owned->TrySetType(type);
+			if (status != 0)
+				return status;
+
+			_owned = std::move(owned);
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline OperationResult RecipeValueView::TryGetAsTable(IValueTable*& result) noexcept
+	{
+		try
+		{
+			result = nullptr;
+			if (_owned != nullptr)
+				return _owned->TryGetAsTable(result);
+
+			if (GetSourceType() != RecipeValueType::Table)
+				return -2;
+
+			if (_table == nullptr)
+			{
+				auto& table = _sourceTable != nullptr ? *_sourceTable : _source->AsTable();
+				_table = std::make_unique<RecipeTableView>(table);
+			}
+
+			result = _table.get();
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline OperationResult RecipeValueView::TryGetAsList(IValueList*& result) noexcept
+	{
+		try
+		{
+			result = nullptr;
+			if (_owned != nullptr)
+				return _owned->TryGetAsList(result);
+
+			if (GetSourceType() != RecipeValueType::List)
+				return -2;
+
+			if (_list == nullptr)
+				_list = std::make_unique<RecipeListView>(_source->AsList());
+
+			result = _list.get();
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline OperationResult RecipeValueView::TryGetAsString(IValuePrimitive<const char*>*& result) noexcept
+	{
+		try
+		{
+			result = nullptr;
+			if (_owned != nullptr)
+				return _owned->TryGetAsString(result);
+
+			if (GetSourceType() != RecipeValueType::String)
+				return -2;
+
+			if (_string == nullptr)
+				_string = std::make_unique<RecipeStringView>(_source->AsString());
+
+			result = _string.get();
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline OperationResult RecipeValueView::TryGetAsInteger(IValuePrimitive<int64_t>*& result) noexcept
+	{
+		try
+		{
+			result = nullptr;
+			if (_owned != nullptr)
+				return _owned->TryGetAsInteger(result);
+
+			if (GetSourceType() != RecipeValueType::Integer)
+				return -2;
+
+			if (_integer == nullptr)
+				_integer = std::make_unique<RecipePrimitiveView<int64_t>>(_source->AsInteger());
+
+			result = _integer.get();
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline OperationResult RecipeValueView::TryGetAsFloat(IValuePrimitive<double>*& result) noexcept
+	{
+		try
+		{
+			result = nullptr;
+			if (_owned != nullptr)
+				return _owned->TryGetAsFloat(result);
+
+			if (GetSourceType() != RecipeValueType::Float)
+				return -2;
+
+			if (_float == nullptr)
+				_float = std::make_unique<RecipePrimitiveView<double>>(_source->AsFloat());
+
+			result = _float.get();
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline OperationResult RecipeValueView::TryGetAsBoolean(IValuePrimitive<bool>*& result) noexcept
+	{
+		try
+		{
+			result = nullptr;
+			if (_owned != nullptr)
+				return _owned->TryGetAsBoolean(result);
+
+			if (GetSourceType() != RecipeValueType::Boolean)
+				return -2;
+
+			if (_boolean == nullptr)
+				_boolean = std::make_unique<RecipePrimitiveView<bool>>(_source->AsBoolean());
+
+			result = _boolean.get();
+			return 0;
+		}
+		catch (...)
+		{
+			// Unknown error
+			return -1;
+		}
+	}
+
+	inline RecipeValueType RecipeValueView::GetSourceType() const
+	{
+		if (_sourceTable != nullptr)
+			return RecipeValueType::Table;
+		else
+			return _source->GetType();
+	}
+}
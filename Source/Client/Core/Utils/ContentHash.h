@@ -0,0 +1,87 @@
+﻿// <copyright file="ContentHash.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup
+{
+	/// <summary>
+	/// A 64 bit FNV-1a hash used to detect when content has changed
+	/// Note: Not suitable for anything that must resist collisions on purpose
+	/// </summary>
+	export class ContentHash
+	{
+	private:
+		static constexpr uint64_t OffsetBasis = 14695981039346656037ull;
+		static constexpr uint64_t Prime = 1099511628211ull;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ContentHash"/> class.
+		/// </summary>
+		ContentHash() :
+			_value(OffsetBasis)
+		{
+		}
+
+		/// <summary>
+		/// Add a string value along with its length to keep adjacent values distinct
+		/// </summary>
+		void Add(std::string_view value)
+		{
+			Add(static_cast<uint64_t>(value.size()));
+			AddBytes(value.data(), value.size());
+		}
+
+		/// <summary>
+		/// Add an integer value
+		/// </summary>
+		void Add(uint64_t value)
+		{
+			for (size_t i = 0; i < sizeof(uint64_t); i++)
+			{
+				AddByte(static_cast<unsigned char>(value >> (i * 8)));
+			}
+		}
+
+		/// <summary>
+		/// Add the remaining content of the stream
+		/// </summary>
+		void AddStream(std::istream& stream)
+		{
+			auto buffer = std::array<char, 64 * 1024>();
+			while (stream)
+			{
+				stream.read(buffer.data(), buffer.size());
+				AddBytes(buffer.data(), static_cast<size_t>(stream.gcount()));
+			}
+		}
+
+		/// <summary>
+		/// Get the current hash value
+		/// </summary>
+		uint64_t GetValue() const
+		{
+			return _value;
+		}
+
+	private:
+		void AddBytes(const char* data, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				AddByte(static_cast<unsigned char>(data[i]));
+			}
+		}
+
+		void AddByte(unsigned char value)
+		{
+			_value ^= value;
+			_value *= Prime;
+		}
+
+	private:
+		uint64_t _value;
+	};
+}
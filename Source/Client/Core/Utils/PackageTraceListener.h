@@ -0,0 +1,79 @@
+﻿// <copyright file="PackageTraceListener.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup
+{
+	/// <summary>
+	/// A console trace listener that can be shared by package builds running on different threads
+	/// Note: The event id is tracked per thread so each line is tagged with the package the
+	/// calling thread is building, and each line is written at once so output never interleaves
+	/// </summary>
+	export class PackageTraceListener : public TraceListener
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PackageTraceListener"/> class.
+		/// </summary>
+		PackageTraceListener(
+			std::string name,
+			std::shared_ptr<IEventFilter> filter,
+			bool showEventType) :
+			TraceListener(std::move(name), std::move(filter), showEventType, false),
+			_writeMutex()
+		{
+		}
+
+		/// <summary>
+		/// Set the package id for events logged from the calling thread
+		/// Note: Zero clears the id
+		/// </summary>
+		static void SetActiveId(int value)
+		{
+			s_activeId = value;
+		}
+
+		/// <summary>
+		/// Get the package id for events logged from the calling thread
+		/// </summary>
+		static int GetActiveId()
+		{
+			return s_activeId;
+		}
+
+	protected:
+		/// <summary>
+		/// Buffer the partial line for the calling thread
+		/// </summary>
+		void Write(std::string_view message) override final
+		{
+			s_currentLine.append(message);
+		}
+
+		/// <summary>
+		/// Write the complete line for the calling thread
+		/// </summary>
+		void WriteLine(std::string_view message) override final
+		{
+			s_currentLine.append(message);
+
+			{
+				auto lock = std::lock_guard<std::mutex>(_writeMutex);
+				if (s_activeId != 0)
+					std::cout << s_activeId << "> ";
+
+				std::cout << s_currentLine << std::endl;
+			}
+
+			s_currentLine.clear();
+		}
+
+	private:
+		inline static thread_local int s_activeId = 0;
+		inline static thread_local std::string s_currentLine;
+
+		std::mutex _writeMutex;
+	};
+}
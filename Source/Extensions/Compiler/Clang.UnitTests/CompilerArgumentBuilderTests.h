@@ -320,6 +320,93 @@ namespace Soup::Compiler::Clang::UnitTests
 			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
 		}
 
+		[[Fact]]
+		void SingleArgument_SplitDebugInformation()
+		{
+			CompileArguments arguments = {};
+			arguments.SourceFile = Path("File.cpp");
+			arguments.TargetFile = Path("obj/File.obj");
+			arguments.Standard = LanguageStandard::CPP17;
+			arguments.Optimize = OptimizationLevel::None;
+			arguments.GenerateSourceDebugInfo = true;
+			arguments.SplitDebugInfo = true;
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"-nostdinc",
+				"-Wno-unknown-attributes",
+				"-Xclang",
+				"-flto-visibility-public-std",
+				"-g",
+				"-gdwarf",
+				"-gsplit-dwarf",
+				"-std=c++17",
+				"-c",
+				"File.cpp",
+				"-o",
+				"obj/File.obj",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("File.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("obj/File.obj"),
+				Path("obj/File.dwo"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void SingleArgument_ThinLTO()
+		{
+			CompileArguments arguments = {};
+			arguments.SourceFile = Path("File.cpp");
+			arguments.TargetFile = Path("File.o");
+			arguments.Standard = LanguageStandard::CPP17;
+			arguments.Optimize = OptimizationLevel::Speed;
+			arguments.ThinLTO = true;
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"-nostdinc",
+				"-Wno-unknown-attributes",
+				"-Xclang",
+				"-flto-visibility-public-std",
+				"-std=c++17",
+				"-O3",
+				"-flto=thin",
+				"-c",
+				"File.cpp",
+				"-o",
+				"File.o",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("File.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("File.o"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
 		[[Fact]]
 		void SingleArgument_IncludePaths()
 		{
@@ -451,6 +538,83 @@ namespace Soup::Compiler::Clang::UnitTests
 			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
 		}
 
+		[[Fact]]
+		void SingleArgument_ResponseFile()
+		{
+			CompileArguments arguments = {};
+			arguments.SourceFile = Path("File.cpp");
+			arguments.TargetFile = Path("File.o");
+			arguments.IncludeDirectories = std::vector<Path>({
+				Path("Folder/"),
+			});
+			arguments.PreprocessorDefinitions = std::vector<std::string>({
+				"DEBUG",
+			});
+			arguments.IncludeModules = std::vector<Path>({
+				Path("Module.pcm"),
+			});
+			arguments.ResponseFile = Path("obj/args.rsp");
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"-nostdinc",
+				"-Wno-unknown-attributes",
+				"-Xclang",
+				"-flto-visibility-public-std",
+				"-std=c++11",
+				"@obj/args.rsp",
+				"-c",
+				"File.cpp",
+				"-o",
+				"File.o",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("obj/args.rsp"),
+				Path("Module.pcm"),
+				Path("File.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("File.o"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void ResponseFileArguments()
+		{
+			CompileArguments arguments = {};
+			arguments.IncludeDirectories = std::vector<Path>({
+				Path("C:/Files/SDK/"),
+				Path("Folder/"),
+			});
+			arguments.PreprocessorDefinitions = std::vector<std::string>({
+				"DEBUG",
+			});
+			arguments.IncludeModules = std::vector<Path>({
+				Path("Module.pcm"),
+			});
+
+			auto actualArguments = ArgumentBuilder::BuildResponseFileArguments(arguments);
+
+			auto expectedArguments = std::vector<std::string>({
+				"-isystem \"C:/Files/SDK/\"",
+				"-I\"Folder/\"",
+				"-DDEBUG",
+				"-fmodule-file=\"Module.pcm\"",
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+		}
+
 		[[Fact]]
 		void SingleArgument_ExportModule_SingleSource()
 		{
@@ -484,6 +648,88 @@ namespace Soup::Compiler::Clang::UnitTests
 				Path("module.pcm"),
 			});
 
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+		[[Fact]]
+		void SingleArgument_PrecompiledHeader_Create()
+		{
+			CompileArguments arguments = {};
+			arguments.SourceFile = Path("pch.h");
+			arguments.TargetFile = Path("obj/PrecompiledHeader.obj");
+			arguments.PrecompiledHeader = PrecompiledHeaderMode::Create;
+			arguments.PrecompiledHeaderFile = Path("pch.h");
+			arguments.PrecompiledHeaderTarget = Path("obj/PrecompiledHeader.pch");
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"-nostdinc",
+				"-Wno-unknown-attributes",
+				"-Xclang",
+				"-flto-visibility-public-std",
+				"-std=c++11",
+				"-x",
+				"c++-header",
+				"pch.h",
+				"-o",
+				"obj/PrecompiledHeader.pch",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("pch.h"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("obj/PrecompiledHeader.pch"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void SingleArgument_PrecompiledHeader_Use()
+		{
+			CompileArguments arguments = {};
+			arguments.SourceFile = Path("File.cpp");
+			arguments.TargetFile = Path("obj/File.obj");
+			arguments.PrecompiledHeader = PrecompiledHeaderMode::Use;
+			arguments.PrecompiledHeaderFile = Path("pch.h");
+			arguments.PrecompiledHeaderTarget = Path("obj/PrecompiledHeader.pch");
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"-nostdinc",
+				"-Wno-unknown-attributes",
+				"-Xclang",
+				"-flto-visibility-public-std",
+				"-std=c++11",
+				"-include-pch \"obj/PrecompiledHeader.pch\"",
+				"-c",
+				"File.cpp",
+				"-o",
+				"obj/File.obj",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("obj/PrecompiledHeader.pch"),
+				Path("File.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("obj/File.obj"),
+			});
+
 			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
 			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
 			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
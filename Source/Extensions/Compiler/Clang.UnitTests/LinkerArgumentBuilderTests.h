@@ -158,5 +158,116 @@ namespace Soup::Compiler::Clang::UnitTests
 			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
 			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
 		}
+
+		[[Fact]]
+		void Executable_SplitDebugInformation()
+		{
+			LinkArguments arguments = {};
+			arguments.TargetType = LinkTarget::Executable;
+			arguments.TargetFile = Path("out/Something.exe");
+			arguments.GenerateSourceDebugInfo = true;
+			arguments.SplitDebugInfo = true;
+			arguments.ObjectFiles = std::vector<Path>({
+				Path("File.mock.o"),
+			});
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildLinkerArguments(arguments, actualInput, actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"/nologo",
+				"/debug:dwarf",
+				"/subsystem:console",
+				"/machine:X64",
+				"/out:\"out/Something.exe\"",
+				"File.mock.o",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("File.mock.o"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("out/Something.exe"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void Executable_ThinLTO()
+		{
+			LinkArguments arguments = {};
+			arguments.TargetType = LinkTarget::Executable;
+			arguments.TargetFile = Path("out/Something.exe");
+			arguments.ThinLTO = true;
+			arguments.ThinLTOCacheDirectory = Path("obj/ThinLTOCache/");
+			arguments.ThinLTOCachePolicy = "prune_after=168h";
+			arguments.ThinLTOJobs = 4;
+			arguments.ObjectFiles = std::vector<Path>({
+				Path("File.mock.o"),
+			});
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildLinkerArguments(arguments, actualInput, actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"/nologo",
+				"/subsystem:console",
+				"/machine:X64",
+				"/out:\"out/Something.exe\"",
+				"File.mock.o",
+				"/lldltocache:\"obj/ThinLTOCache/\"",
+				"/lldltocachepolicy:prune_after=168h",
+				"/opt:lldltojobs=4",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("File.mock.o"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("out/Something.exe"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void DebugPackage()
+		{
+			LinkArguments arguments = {};
+			arguments.TargetType = LinkTarget::Executable;
+			arguments.TargetFile = Path("out/Something.exe");
+			arguments.DebugPackageFile = Path("out/Something.dwp");
+			arguments.ObjectFiles = std::vector<Path>({
+				Path("obj/File1.obj"),
+				Path("obj/File2.obj"),
+			});
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildDebugPackageArguments(arguments, actualInput, actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"obj/File1.dwo",
+				"obj/File2.dwo",
+				"-o",
+				"out/Something.dwp",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("obj/File1.dwo"),
+				Path("obj/File2.dwo"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("out/Something.dwp"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
 	};
 }
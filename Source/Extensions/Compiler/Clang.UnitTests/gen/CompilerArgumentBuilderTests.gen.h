@@ -18,10 +18,16 @@ TestState RunCompilerArgumentBuilderTests()
 	state += SoupTest::RunTest(className, "SingleArgument_OptimizationLevel(Soup::OptimizationLevel::Size, \"-Oz\")", [&testClass]() { testClass->SingleArgument_OptimizationLevel(Soup::Compiler::OptimizationLevel::Size, "-Oz"); });
 	state += SoupTest::RunTest(className, "SingleArgument_OptimizationLevel(Soup::OptimizationLevel::Speed, \"-O3\")", [&testClass]() { testClass->SingleArgument_OptimizationLevel(Soup::Compiler::OptimizationLevel::Speed, "-O3"); });
 	state += SoupTest::RunTest(className, "SingleArgument_GenerateDebugInformation", [&testClass]() { testClass->SingleArgument_GenerateDebugInformation(); });
+	state += SoupTest::RunTest(className, "SingleArgument_SplitDebugInformation", [&testClass]() { testClass->SingleArgument_SplitDebugInformation(); });
+	state += SoupTest::RunTest(className, "SingleArgument_ThinLTO", [&testClass]() { testClass->SingleArgument_ThinLTO(); });
 	state += SoupTest::RunTest(className, "SingleArgument_IncludePaths", [&testClass]() { testClass->SingleArgument_IncludePaths(); });
 	state += SoupTest::RunTest(className, "SingleArgument_PreprocessorDefinitions", [&testClass]() { testClass->SingleArgument_PreprocessorDefinitions(); });
 	state += SoupTest::RunTest(className, "SingleArgument_Modules", [&testClass]() { testClass->SingleArgument_Modules(); });
+	state += SoupTest::RunTest(className, "SingleArgument_ResponseFile", [&testClass]() { testClass->SingleArgument_ResponseFile(); });
+	state += SoupTest::RunTest(className, "ResponseFileArguments", [&testClass]() { testClass->ResponseFileArguments(); });
 	state += SoupTest::RunTest(className, "SingleArgument_ExportModule_SingleSource", [&testClass]() { testClass->SingleArgument_ExportModule_SingleSource(); });
+	state += SoupTest::RunTest(className, "SingleArgument_PrecompiledHeader_Create", [&testClass]() { testClass->SingleArgument_PrecompiledHeader_Create(); });
+	state += SoupTest::RunTest(className, "SingleArgument_PrecompiledHeader_Use", [&testClass]() { testClass->SingleArgument_PrecompiledHeader_Use(); });
 
 	return state;
 }
\ No newline at end of file
@@ -11,6 +11,9 @@ TestState RunLinkerArgumentBuilderTests()
 	state += SoupTest::RunTest(className, "StaticLibrary", [&testClass]() { testClass->StaticLibrary(); });
 	state += SoupTest::RunTest(className, "DynamicLibrary", [&testClass]() { testClass->DynamicLibrary(); });
 	state += SoupTest::RunTest(className, "Executable", [&testClass]() { testClass->Executable(); });
+	state += SoupTest::RunTest(className, "Executable_SplitDebugInformation", [&testClass]() { testClass->Executable_SplitDebugInformation(); });
+	state += SoupTest::RunTest(className, "Executable_ThinLTO", [&testClass]() { testClass->Executable_ThinLTO(); });
+	state += SoupTest::RunTest(className, "DebugPackage", [&testClass]() { testClass->DebugPackage(); });
 
 	return state;
 }
\ No newline at end of file
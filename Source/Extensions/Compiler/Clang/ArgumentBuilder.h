@@ -12,6 +12,9 @@ namespace Soup::Compiler::Clang
 	/// </summary>
 	export class ArgumentBuilder
 	{
+	private:
+		static constexpr std::string_view SplitDebugInfoFileExtension = "dwo";
+
 	public:
 		static std::vector<std::string> BuildCompilerArguments(
 			const CompileArguments& args,
@@ -54,6 +57,14 @@ namespace Soup::Compiler::Clang
 			if (args.GenerateSourceDebugInfo)
 			{
 				commandArgs.push_back("-g");
+
+				// Leave only a skeleton in the object file so the linker does not have to move
+				// the full debug information, the remainder is written next to the object file
+				if (IsSplitDebugInfo(args))
+				{
+					commandArgs.push_back("-gdwarf");
+					commandArgs.push_back("-gsplit-dwarf");
+				}
 			}
 
 			// Set the language standard
@@ -91,29 +102,22 @@ namespace Soup::Compiler::Clang
 					throw std::runtime_error("Unknown optimization level.");
 			}
 
-			// Set the include paths
-			for (auto directory : args.IncludeDirectories)
+			// Emit summaries with the bitcode so the link can optimize the modules in parallel
+			if (args.ThinLTO)
 			{
-				// TODO: May want to have flag for system rooted includes
-				auto argument = std::string();
-				if (directory.HasRoot())
-				{
-					// Treat the include as a system path to not produce warnings
-					argument = "-isystem \"" + directory.ToString() + "\"";
-				}
-				else
-				{
-					argument = "-I\"" + directory.ToString() + "\"";
-				}
-				
-				commandArgs.push_back(std::move(argument));
+				commandArgs.push_back("-flto=thin");
 			}
 
-			// Set the preprocessor definitions
-			for (auto& definition : args.PreprocessorDefinitions)
+			// Set the include paths and preprocessor definitions
+			// Note: The shared response file replaces the arguments that are the same for every file
+			if (args.ResponseFile.IsEmpty())
 			{
-				auto argument = "-D" + definition;
-				commandArgs.push_back(std::move(argument));
+				AddIncludeArguments(commandArgs, args);
+			}
+			else
+			{
+				inputFiles.push_back(args.ResponseFile);
+				commandArgs.push_back("@" + args.ResponseFile.ToString());
 			}
 
 			// Enable experimental features for C++ 20
@@ -134,11 +138,28 @@ namespace Soup::Compiler::Clang
 			for (auto& moduleFile : args.IncludeModules)
 			{
 				inputFiles.push_back(moduleFile);
-				auto argument = "-fmodule-file=\"" + moduleFile.ToString() + "\"";
+			}
+
+			if (args.ResponseFile.IsEmpty())
+			{
+				AddModuleArguments(commandArgs, args);
+			}
+
+			// Reference the shared precompiled header
+			if (args.PrecompiledHeader == PrecompiledHeaderMode::Use)
+			{
+				inputFiles.push_back(args.PrecompiledHeaderTarget);
+				auto argument = "-include-pch \"" + args.PrecompiledHeaderTarget.ToString() + "\"";
 				commandArgs.push_back(std::move(argument));
 			}
 
-			if (args.ExportModule)
+			if (args.PrecompiledHeader == PrecompiledHeaderMode::Create)
+			{
+				// Compile the source file as a header to generate the precompiled header
+				commandArgs.push_back("-x");
+				commandArgs.push_back("c++-header");
+			}
+			else if (args.ExportModule)
 			{
 				commandArgs.push_back("--precompile");
 
@@ -157,13 +178,74 @@ namespace Soup::Compiler::Clang
 			commandArgs.push_back(args.SourceFile.ToString());
 
 			// Add the target file as output
-			outputFiles.push_back(args.TargetFile);
+			// Note: Clang generates the precompiled header with no object file
+			const auto& targetFile = args.PrecompiledHeader == PrecompiledHeaderMode::Create ?
+				args.PrecompiledHeaderTarget :
+				args.TargetFile;
+			outputFiles.push_back(targetFile);
+			commandArgs.push_back("-o");
+			commandArgs.push_back(targetFile.ToString());
+
+			if (IsSplitDebugInfo(args))
+			{
+				outputFiles.push_back(GetSplitDebugInfoFile(targetFile));
+			}
+
+			return commandArgs;
+		}
+
+		/// <summary>
+		/// Build the include paths, preprocessor definitions and module references that are
+		/// written once to a shared response file for all source files in a package
+		/// </summary>
+		static std::vector<std::string> BuildResponseFileArguments(const CompileArguments& args)
+		{
+			auto commandArgs = std::vector<std::string>();
+			AddIncludeArguments(commandArgs, args);
+			AddModuleArguments(commandArgs, args);
+			return commandArgs;
+		}
+
+		/// <summary>
+		/// Build the arguments to combine the split debug information of the object files into a single package
+		/// </summary>
+		static std::vector<std::string> BuildDebugPackageArguments(
+			const LinkArguments& args,
+			std::vector<Path>& inputFiles,
+			std::vector<Path>& outputFiles)
+		{
+			// Verify the input
+			if (args.DebugPackageFile.GetFileName().empty())
+				throw std::runtime_error("Debug package file cannot be empty.");
+
+			auto commandArgs = std::vector<std::string>();
+
+			// Add the split debug information for each object file as input
+			for (auto& file : args.ObjectFiles)
+			{
+				auto debugInfoFile = GetSplitDebugInfoFile(file);
+				inputFiles.push_back(debugInfoFile);
+				commandArgs.push_back(debugInfoFile.ToString());
+			}
+
+			// Add the package file as output
+			outputFiles.push_back(args.DebugPackageFile);
 			commandArgs.push_back("-o");
-			commandArgs.push_back(args.TargetFile.ToString());
+			commandArgs.push_back(args.DebugPackageFile.ToString());
 
 			return commandArgs;
 		}
 
+		/// <summary>
+		/// Get the file that holds the split debug information for an object file
+		/// </summary>
+		static Path GetSplitDebugInfoFile(const Path& objectFile)
+		{
+			auto result = objectFile;
+			result.SetFileExtension(SplitDebugInfoFileExtension);
+			return result;
+		}
+
 		static std::vector<std::string> BuildLinkerArguments(
 			const LinkArguments& args,
 			std::vector<Path>& inputFiles,
@@ -215,6 +297,12 @@ namespace Soup::Compiler::Clang
 						args,
 						inputFiles,
 						outputFiles);
+
+					if (args.ThinLTO)
+					{
+						AddThinLTOArguments(args, commandArgs);
+					}
+
 					break;
 				}
 				default:
@@ -225,5 +313,82 @@ namespace Soup::Compiler::Clang
 
 			return commandArgs;
 		}
+
+	private:
+		/// <summary>
+		/// Add the lld-link arguments for incremental link time optimization
+		/// Note: Unchanged modules are reused from the cache across builds
+		/// </summary>
+		static void AddThinLTOArguments(
+			const LinkArguments& args,
+			std::vector<std::string>& commandArgs)
+		{
+			if (!args.ThinLTOCacheDirectory.IsEmpty())
+			{
+				commandArgs.push_back("/lldltocache:\"" + args.ThinLTOCacheDirectory.ToString() + "\"");
+
+				if (!args.ThinLTOCachePolicy.empty())
+				{
+					commandArgs.push_back("/lldltocachepolicy:" + args.ThinLTOCachePolicy);
+				}
+			}
+
+			if (args.ThinLTOJobs > 0)
+			{
+				commandArgs.push_back("/opt:lldltojobs=" + std::to_string(args.ThinLTOJobs));
+			}
+		}
+
+		static void AddIncludeArguments(
+			std::vector<std::string>& commandArgs,
+			const CompileArguments& args)
+		{
+			// Set the include paths
+			for (auto directory : args.IncludeDirectories)
+			{
+				// TODO: May want to have flag for system rooted includes
+				auto argument = std::string();
+				if (directory.HasRoot())
+				{
+					// Treat the include as a system path to not produce warnings
+					argument = "-isystem \"" + directory.ToString() + "\"";
+				}
+				else
+				{
+					argument = "-I\"" + directory.ToString() + "\"";
+				}
+				
+				commandArgs.push_back(std::move(argument));
+			}
+
+			// Set the preprocessor definitions
+			for (auto& definition : args.PreprocessorDefinitions)
+			{
+				auto argument = "-D" + definition;
+				commandArgs.push_back(std::move(argument));
+			}
+		}
+
+		static void AddModuleArguments(
+			std::vector<std::string>& commandArgs,
+			const CompileArguments& args)
+		{
+			for (auto& moduleFile : args.IncludeModules)
+			{
+				auto argument = "-fmodule-file=\"" + moduleFile.ToString() + "\"";
+				commandArgs.push_back(std::move(argument));
+			}
+		}
+
+		/// <summary>
+		/// Split debug information only applies when generating an object file
+		/// </summary>
+		static bool IsSplitDebugInfo(const CompileArguments& args)
+		{
+			return args.GenerateSourceDebugInfo &&
+				args.SplitDebugInfo &&
+				!args.ExportModule &&
+				args.PrecompiledHeader != PrecompiledHeaderMode::Create;
+		}
 	};
 }
@@ -16,6 +16,7 @@ namespace Soup::Compiler::Clang
 		static constexpr std::string_view CompilerExecutable = "clang++.exe";
 		static constexpr std::string_view ArchiverExecutable = "llvm-ar.exe";
 		static constexpr std::string_view MSVCLinkerExecutable = "lld-link.exe";
+		static constexpr std::string_view DebugPackageExecutable = "llvm-dwp.exe";
 
 	public:
 		Compiler(Path toolPath) :
@@ -65,6 +66,38 @@ namespace Soup::Compiler::Clang
 			return "dll";
 		}
 
+		/// <summary>
+		/// Gets the precompiled header file extension for the compiler
+		/// </summary>
+		std::string_view GetPrecompiledHeaderFileExtension() const override final
+		{
+			return "pch";
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the precompiled header object must be linked
+		/// </summary>
+		bool IsPrecompiledHeaderObjectLinked() const override final
+		{
+			return false;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler supports split debug information
+		/// </summary>
+		bool SupportsSplitDebugInfo() const override final
+		{
+			return true;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler supports incremental link time optimization
+		/// </summary>
+		bool SupportsThinLTO() const override final
+		{
+			return true;
+		}
+
 		/// <summary>
 		/// Compile
 		/// </summary>
@@ -84,6 +117,45 @@ namespace Soup::Compiler::Clang
 			}
 		}
 
+		/// <summary>
+		/// Gets a value indicating whether the compiler can compile multiple source files at once
+		/// Note: Clang cannot name individual object files for multiple inputs
+		/// </summary>
+		bool SupportsBatchCompile() const override final
+		{
+			return false;
+		}
+
+		/// <summary>
+		/// Compile a batch of source files
+		/// </summary>
+		Build::Extensions::GraphNodeWrapper CreateBatchCompileNode(
+			Build::Extensions::BuildStateWrapper& state,
+			const CompileArguments& args,
+			const std::vector<Path>& sourceFiles,
+			const Path& targetDirectory,
+			uint32_t threadCount) const override final
+		{
+			throw std::runtime_error("Batch compile is not supported.");
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler can read arguments from a response file
+		/// </summary>
+		bool SupportsResponseFiles() const override final
+		{
+			return true;
+		}
+
+		/// <summary>
+		/// Build the arguments that are written once to the shared response file
+		/// </summary>
+		std::vector<std::string> CreateResponseFileArguments(
+			const CompileArguments& args) const override final
+		{
+			return ArgumentBuilder::BuildResponseFileArguments(args);
+		}
+
 		/// <summary>
 		/// Link
 		/// </summary>
@@ -118,11 +190,42 @@ namespace Soup::Compiler::Clang
 				args.RootDirectory,
 				std::move(inputFiles),
 				std::move(outputFiles));
+			BuildUtilities::SetLinkResources(buildNode, args);
+
+			// Package the split debug information after the link
+			if (args.SplitDebugInfo && !args.DebugPackageFile.IsEmpty())
+			{
+				auto packageNode = CreateDebugPackageNode(state, args);
+				buildNode.GetChildList().Append(packageNode);
+			}
 
 			return buildNode;
 		}
 
 	private:
+		Build::Extensions::GraphNodeWrapper CreateDebugPackageNode(
+			Build::Extensions::BuildStateWrapper& state,
+			const LinkArguments& args) const
+		{
+			auto executablePath = _toolPath + Path(DebugPackageExecutable);
+
+			// Build the set of input/output files along with the arguments
+			auto inputFiles = std::vector<Path>();
+			auto outputFiles = std::vector<Path>();
+			auto commandArgs = ArgumentBuilder::BuildDebugPackageArguments(args, inputFiles, outputFiles);
+
+			auto buildNode = state.CreateNode(
+				args.DebugPackageFile.ToString(),
+				std::move(executablePath),
+				CombineArguments(commandArgs),
+				args.RootDirectory,
+				std::move(inputFiles),
+				std::move(outputFiles));
+			BuildUtilities::SetDebugPackageResources(buildNode, args);
+
+			return buildNode;
+		}
+
 		Build::Extensions::GraphNodeWrapper CompileStandard(
 			Build::Extensions::BuildStateWrapper& state,
 			const CompileArguments& args) const
@@ -141,6 +244,7 @@ namespace Soup::Compiler::Clang
 				args.RootDirectory,
 				std::move(inputFiles),
 				std::move(outputFiles));
+			BuildUtilities::SetCompileResources(buildNode, args);
 
 			return buildNode;
 		}
@@ -184,12 +288,16 @@ namespace Soup::Compiler::Clang
 				args.RootDirectory,
 				std::move(generatePrecompiledModuleInputFiles),
 				std::move(generatePrecompiledModuleOutputFiles));
+			BuildUtilities::SetCompileResources(precompiledModuleBuildNode, generatePrecompiledModuleArgs);
 
 			// Now we can compile the object file from the precompiled module
 			auto compileObjectArgs = CompileArguments();
 			compileObjectArgs.Standard = args.Standard;
 			compileObjectArgs.Optimize = args.Optimize;
 			compileObjectArgs.RootDirectory = args.RootDirectory;
+			compileObjectArgs.GenerateSourceDebugInfo = args.GenerateSourceDebugInfo;
+			compileObjectArgs.SplitDebugInfo = args.SplitDebugInfo;
+			compileObjectArgs.ThinLTO = args.ThinLTO;
 			compileObjectArgs.SourceFile = generatePrecompiledModuleArgs.TargetFile;
 			compileObjectArgs.TargetFile = args.TargetFile;
 
@@ -209,9 +317,10 @@ namespace Soup::Compiler::Clang
 				args.RootDirectory,
 				std::move(compileObjectInputFiles),
 				std::move(compileObjectOutputFiles));
+			BuildUtilities::SetCompileResources(compileBuildNode, compileObjectArgs);
 
 			// Ensure the compile node runs after the precompile
-			Build::Extensions::GraphNodeExtensions::AddLeafChild(precompiledModuleBuildNode, compileBuildNode);
+			precompiledModuleBuildNode.GetChildList().Append(compileBuildNode);
 
 			return precompiledModuleBuildNode;
 		}
@@ -128,8 +128,8 @@ namespace Soup::Compiler::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -140,8 +140,8 @@ namespace Soup::Compiler::UnitTests
 					})),
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -172,6 +172,155 @@ namespace Soup::Compiler::UnitTests
 				"Verify Runtime Dependencies Result");
 		}
 
+		[[Fact]]
+		void Build_Executable_ResponseFile()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the mock compiler with response file support
+			auto compiler = std::make_shared<Compiler::Mock::Compiler>(true);
+
+			// Setup the build arguments
+			auto arguments = BuildArguments();
+			arguments.TargetName = "Program";
+			arguments.TargetType = BuildTargetType::Executable;
+			arguments.LanguageStandard = LanguageStandard::CPP20;
+			arguments.WorkingDirectory = Path("C:/root/");
+			arguments.ObjectDirectory = Path("obj");
+			arguments.BinaryDirectory = Path("bin");
+			arguments.SourceFiles = std::vector<Path>({
+				Path("TestFile.cpp"),
+			});
+			arguments.OptimizationLevel = BuildOptimizationLevel::None;
+
+			auto uut = BuildEngine(compiler);
+			auto buildState = Build::Runtime::BuildState();
+			auto result = uut.Execute(Build::Extensions::BuildStateWrapper(buildState), arguments);
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Compiling source files",
+					"INFO: Generate Response File Node: obj/args.rsp",
+					"INFO: Generate Compile Node: TestFile.cpp",
+					"INFO: CoreLink",
+					"INFO: Linking target",
+					"INFO: Generate Link Node: bin/Program.exe",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// The response file holds the arguments shared by every translation unit
+			auto expectedResponseFileArguments = CompileArguments();
+			expectedResponseFileArguments.Standard = LanguageStandard::CPP20;
+			expectedResponseFileArguments.Optimize = OptimizationLevel::None;
+			expectedResponseFileArguments.RootDirectory = Path("C:/root/");
+			expectedResponseFileArguments.GenerateIncludeTree = true;
+
+			auto expectedCompileArguments = CompileArguments();
+			expectedCompileArguments.Standard = LanguageStandard::CPP20;
+			expectedCompileArguments.Optimize = OptimizationLevel::None;
+			expectedCompileArguments.RootDirectory = Path("C:/root/");
+			expectedCompileArguments.SourceFile = Path("TestFile.cpp");
+			expectedCompileArguments.TargetFile = Path("obj/TestFile.mock.obj");
+			expectedCompileArguments.GenerateIncludeTree = true;
+			expectedCompileArguments.ResponseFile = Path("obj/args.rsp");
+
+			// Verify expected compiler calls
+			Assert::AreEqual(
+				std::vector<CompileArguments>({
+					expectedResponseFileArguments,
+				}),
+				compiler->GetResponseFileRequests(),
+				"Verify response file requests match expected.");
+			Assert::AreEqual(
+				std::vector<CompileArguments>({
+					expectedCompileArguments,
+				}),
+				compiler->GetCompileRequests(),
+				"Verify compiler requests match expected.");
+
+			// Verify build state
+			auto expectedLinkNode =
+				Memory::Reference<Build::Runtime::BuildGraphNode>(
+					new Build::Runtime::BuildGraphNode(
+						"MockLink: 1",
+						"MockLinker.exe",
+						"Arguments",
+						"MockWorkingDirectory",
+						std::vector<std::string>({
+							"InputFile.in",
+						}),
+						std::vector<std::string>({
+							"OutputFile.out",
+						})));
+
+			auto expectedCompileNode =
+				Memory::Reference<Build::Runtime::BuildGraphNode>(
+					new Build::Runtime::BuildGraphNode(
+						"MockCompile: 1",
+						"MockCompiler.exe",
+						"Arguments",
+						"MockWorkingDirectory",
+						std::vector<std::string>({
+							"InputFile.in",
+						}),
+						std::vector<std::string>({
+							"OutputFile.out",
+						}),
+						std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
+							expectedLinkNode,
+						})));
+
+			auto expectedResponseFileNode =
+				Memory::Reference<Build::Runtime::BuildGraphNode>(
+					new Build::Runtime::BuildGraphNode(
+						"WriteFile [C:/root/obj/args.rsp]",
+						"soup:write",
+						"\"C:/root/obj/args.rsp\" \"Arguments\"",
+						"./",
+						std::vector<std::string>({}),
+						std::vector<std::string>({
+							"C:/root/obj/args.rsp",
+						}),
+						std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
+							expectedCompileNode,
+						})));
+
+			auto expectedBuildNodes = std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
+				new Build::Runtime::BuildGraphNode(
+					"MakeDir [C:/root/obj]",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
+					"./",
+					std::vector<std::string>({}),
+					std::vector<std::string>({
+						"C:/root/obj",
+					}),
+					std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
+						expectedResponseFileNode,
+					})),
+				new Build::Runtime::BuildGraphNode(
+					"MakeDir [C:/root/bin]",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
+					"./",
+					std::vector<std::string>({}),
+					std::vector<std::string>({
+						"C:/root/bin",
+					}),
+					std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
+						expectedResponseFileNode,
+					})),
+			});
+
+			AssertExtensions::AreEqual(
+				expectedBuildNodes,
+				result.BuildNodes);
+		}
+
 		[[Fact]]
 		void Build_Library_MultipleFiles()
 		{
@@ -344,8 +493,8 @@ namespace Soup::Compiler::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -354,8 +503,8 @@ namespace Soup::Compiler::UnitTests
 					expectedCompileNodes),
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -580,8 +729,8 @@ namespace Soup::Compiler::UnitTests
 				Memory::Reference<Build::Runtime::BuildGraphNode>(
 					new Build::Runtime::BuildGraphNode(
 						"Copy [C:/root/obj/Public.mock.bmi] -> [C:/root/bin/Library.mock.bmi]",
-						"C:/Windows/System32/cmd.exe",
-						"/C copy /Y \"C:\\root\\obj\\Public.mock.bmi\" \"C:\\root\\bin\\Library.mock.bmi\"",
+						"soup:copy",
+						"\"C:/root/obj/Public.mock.bmi\" \"C:/root/bin/Library.mock.bmi\"",
 						"./",
 						std::vector<std::string>({
 							"C:/root/obj/Public.mock.bmi",
@@ -611,8 +760,8 @@ namespace Soup::Compiler::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -623,8 +772,8 @@ namespace Soup::Compiler::UnitTests
 					})),
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -773,8 +922,8 @@ namespace Soup::Compiler::UnitTests
 				Memory::Reference<Build::Runtime::BuildGraphNode>(
 					new Build::Runtime::BuildGraphNode(
 						"Copy [C:/root/obj/Public.mock.bmi] -> [C:/root/bin/Library.mock.bmi]",
-						"C:/Windows/System32/cmd.exe",
-						"/C copy /Y \"C:\\root\\obj\\Public.mock.bmi\" \"C:\\root\\bin\\Library.mock.bmi\"",
+						"soup:copy",
+						"\"C:/root/obj/Public.mock.bmi\" \"C:/root/bin/Library.mock.bmi\"",
 						"./",
 						std::vector<std::string>({
 							"C:/root/obj/Public.mock.bmi",
@@ -806,8 +955,8 @@ namespace Soup::Compiler::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Build::Runtime::BuildGraphNode>>({
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -818,8 +967,8 @@ namespace Soup::Compiler::UnitTests
 					})),
 				new Build::Runtime::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({
@@ -0,0 +1,80 @@
+// <copyright file="PrecompiledHeaderPlannerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Compiler::UnitTests
+{
+	class PrecompiledHeaderPlannerTests
+	{
+	public:
+		[[Fact]]
+		void SelectHeaders_NoHistory_Empty()
+		{
+			auto actual = PrecompiledHeaderPlanner::SelectHeaders(
+				std::vector<Path>({
+					Path("File1.cpp"),
+				}),
+				std::map<std::string, std::vector<Path>>(),
+				std::vector<Path>({
+					Path("C:/System/"),
+				}),
+				50);
+
+			Assert::AreEqual(std::vector<Path>(), actual, "Verify the headers match the expected.");
+		}
+
+		[[Fact]]
+		void SelectHeaders_AboveThreshold()
+		{
+			auto sourceFiles = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+				Path("File3.cpp"),
+			});
+			auto sourceDirectIncludes = std::map<std::string, std::vector<Path>>({
+				{ "File1.cpp", { Path("C:/System/vector"), Path("C:/System/string"), Path("C:/Root/Local.h") } },
+				{ "File2.cpp", { Path("C:/System/string"), Path("C:/System/vector"), Path("C:/Root/Local.h") } },
+				{ "File3.cpp", { Path("C:/System/string"), Path("C:/System/map") } },
+			});
+
+			auto actual = PrecompiledHeaderPlanner::SelectHeaders(
+				sourceFiles,
+				sourceDirectIncludes,
+				std::vector<Path>({
+					Path("C:/System/"),
+				}),
+				50);
+
+			Assert::AreEqual(
+				std::vector<Path>({
+					Path("C:/System/vector"),
+					Path("C:/System/string"),
+				}),
+				actual,
+				"Verify the headers match the expected.");
+		}
+
+		[[Fact]]
+		void SelectHeaders_IgnoresSiblingDirectoryPrefix()
+		{
+			auto sourceFiles = std::vector<Path>({
+				Path("File1.cpp"),
+			});
+			auto sourceDirectIncludes = std::map<std::string, std::vector<Path>>({
+				{ "File1.cpp", { Path("C:/SystemOther/vector") } },
+			});
+
+			auto actual = PrecompiledHeaderPlanner::SelectHeaders(
+				sourceFiles,
+				sourceDirectIncludes,
+				std::vector<Path>({
+					Path("C:/System"),
+				}),
+				0);
+
+			Assert::AreEqual(std::vector<Path>(), actual, "Verify the headers match the expected.");
+		}
+	};
+}
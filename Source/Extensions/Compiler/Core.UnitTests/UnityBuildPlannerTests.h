@@ -0,0 +1,140 @@
+// <copyright file="UnityBuildPlannerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Compiler::UnitTests
+{
+	class UnityBuildPlannerTests
+	{
+	public:
+		[[Fact]]
+		void CreateBatches_SingleBatchSize_KeepsFilesSeparate()
+		{
+			auto sourceFiles = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+			});
+
+			auto actual = UnityBuildPlanner::CreateBatches(
+				sourceFiles,
+				std::map<std::string, std::vector<Path>>(),
+				std::vector<Path>(),
+				1);
+
+			Assert::AreEqual<size_t>(2, actual.size(), "Verify the batch count matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File1.cpp") }),
+				actual[0],
+				"Verify the batch matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File2.cpp") }),
+				actual[1],
+				"Verify the batch matches the expected.");
+		}
+
+		[[Fact]]
+		void CreateBatches_NoHistory_ChunksInOrder()
+		{
+			auto sourceFiles = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+				Path("File3.cpp"),
+			});
+
+			auto actual = UnityBuildPlanner::CreateBatches(
+				sourceFiles,
+				std::map<std::string, std::vector<Path>>(),
+				std::vector<Path>(),
+				2);
+
+			Assert::AreEqual<size_t>(2, actual.size(), "Verify the batch count matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File1.cpp"), Path("File2.cpp") }),
+				actual[0],
+				"Verify the batch matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File3.cpp") }),
+				actual[1],
+				"Verify the batch matches the expected.");
+		}
+
+		[[Fact]]
+		void CreateBatches_GroupsBySharedIncludes()
+		{
+			auto sourceFiles = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+				Path("File3.cpp"),
+				Path("File4.cpp"),
+			});
+			auto sourceIncludes = std::map<std::string, std::vector<Path>>({
+				{ "File1.cpp", { Path("A.h"), Path("B.h"), Path("C.h") } },
+				{ "File2.cpp", { Path("X.h"), Path("Y.h") } },
+				{ "File3.cpp", { Path("A.h"), Path("B.h") } },
+				{ "File4.cpp", { Path("X.h") } },
+			});
+
+			auto actual = UnityBuildPlanner::CreateBatches(
+				sourceFiles,
+				sourceIncludes,
+				std::vector<Path>(),
+				2);
+
+			Assert::AreEqual<size_t>(2, actual.size(), "Verify the batch count matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File1.cpp"), Path("File3.cpp") }),
+				actual[0],
+				"Verify the batch matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File2.cpp"), Path("File4.cpp") }),
+				actual[1],
+				"Verify the batch matches the expected.");
+		}
+
+		[[Fact]]
+		void CreateBatches_ExcludedFilesCompiledAlone()
+		{
+			auto sourceFiles = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+				Path("File3.cpp"),
+			});
+
+			auto actual = UnityBuildPlanner::CreateBatches(
+				sourceFiles,
+				std::map<std::string, std::vector<Path>>(),
+				std::vector<Path>({
+					Path("File2.cpp"),
+				}),
+				4);
+
+			Assert::AreEqual<size_t>(2, actual.size(), "Verify the batch count matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File2.cpp") }),
+				actual[0],
+				"Verify the batch matches the expected.");
+			Assert::AreEqual(
+				std::vector<Path>({ Path("File1.cpp"), Path("File3.cpp") }),
+				actual[1],
+				"Verify the batch matches the expected.");
+		}
+
+		[[Fact]]
+		void GetUnityFileName_StableForBatch()
+		{
+			auto batch = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+			});
+
+			auto first = UnityBuildPlanner::GetUnityFileName(batch);
+			auto second = UnityBuildPlanner::GetUnityFileName(batch);
+			Assert::AreEqual(first, second, "Verify the name is stable.");
+
+			auto other = UnityBuildPlanner::GetUnityFileName(std::vector<Path>({ Path("File1.cpp") }));
+			Assert::AreNotEqual(first, other, "Verify a different batch has a different name.");
+		}
+	};
+}
@@ -1,5 +1,6 @@
 #include <any>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <optional>
 #include <sstream>
@@ -17,6 +18,8 @@ using namespace Opal::System;
 using namespace SoupTest;
 
 #include "BuildEngineTests.gen.h"
+#include "PrecompiledHeaderPlannerTests.gen.h"
+#include "UnityBuildPlannerTests.gen.h"
 
 int main()
 {
@@ -25,6 +28,8 @@ int main()
 	TestState state = { 0, 0 };
 
 	state += RunBuildEngineTests();
+	state += RunPrecompiledHeaderPlannerTests();
+	state += RunUnityBuildPlannerTests();
 
 	std::cout << state.PassCount << " PASSED." << std::endl;
 	std::cout << state.FailCount << " FAILED." << std::endl;
@@ -0,0 +1,14 @@
+#pragma once
+#include "PrecompiledHeaderPlannerTests.h"
+
+TestState RunPrecompiledHeaderPlannerTests() 
+ {
+	auto className = "PrecompiledHeaderPlannerTests";
+	auto testClass = std::make_shared<Soup::Compiler::UnitTests::PrecompiledHeaderPlannerTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "SelectHeaders_NoHistory_Empty", [&testClass]() { testClass->SelectHeaders_NoHistory_Empty(); });
+	state += SoupTest::RunTest(className, "SelectHeaders_AboveThreshold", [&testClass]() { testClass->SelectHeaders_AboveThreshold(); });
+	state += SoupTest::RunTest(className, "SelectHeaders_IgnoresSiblingDirectoryPrefix", [&testClass]() { testClass->SelectHeaders_IgnoresSiblingDirectoryPrefix(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "UnityBuildPlannerTests.h"
+
+TestState RunUnityBuildPlannerTests() 
+ {
+	auto className = "UnityBuildPlannerTests";
+	auto testClass = std::make_shared<Soup::Compiler::UnitTests::UnityBuildPlannerTests>();
+	TestState state = { 0, 0 };
+	state += SoupTest::RunTest(className, "CreateBatches_SingleBatchSize_KeepsFilesSeparate", [&testClass]() { testClass->CreateBatches_SingleBatchSize_KeepsFilesSeparate(); });
+	state += SoupTest::RunTest(className, "CreateBatches_NoHistory_ChunksInOrder", [&testClass]() { testClass->CreateBatches_NoHistory_ChunksInOrder(); });
+	state += SoupTest::RunTest(className, "CreateBatches_GroupsBySharedIncludes", [&testClass]() { testClass->CreateBatches_GroupsBySharedIncludes(); });
+	state += SoupTest::RunTest(className, "CreateBatches_ExcludedFilesCompiledAlone", [&testClass]() { testClass->CreateBatches_ExcludedFilesCompiledAlone(); });
+	state += SoupTest::RunTest(className, "GetUnityFileName_StableForBatch", [&testClass]() { testClass->GetUnityFileName_StableForBatch(); });
+
+	return state;
+}
\ No newline at end of file
@@ -183,6 +183,101 @@ namespace Soup::Compiler
 		/// </summary>
 		bool GenerateSourceDebugInfo;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to keep the source debug information
+		/// out of the object files when supported by the compiler
+		/// </summary>
+		bool EnableSplitDebugInfo;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to combine the split debug information
+		/// into a single package next to the linked target
+		/// </summary>
+		bool EnableDebugPackage;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to perform incremental link time optimization
+		/// when supported by the compiler
+		/// </summary>
+		bool EnableThinLTO;
+
+		/// <summary>
+		/// Gets or sets the policy used to prune the persistent link time optimization cache
+		/// </summary>
+		std::string ThinLTOCachePolicy;
+
+		/// <summary>
+		/// Gets or sets the maximum number of link time optimization backend jobs for a single link
+		/// Note: Zero lets the linker decide
+		/// </summary>
+		uint32_t ThinLTOJobs;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to combine the source files into unity translation units
+		/// </summary>
+		bool EnableUnityBuild;
+
+		/// <summary>
+		/// Gets or sets the maximum number of source files in a single unity translation unit
+		/// </summary>
+		uint32_t UnityBatchSize;
+
+		/// <summary>
+		/// Gets or sets the known include closure for each source file from the previous build
+		/// Note: Used to group files that share the most headers
+		/// </summary>
+		std::map<std::string, std::vector<Path>> SourceIncludes;
+
+		/// <summary>
+		/// Gets or sets the source files that were edited since the previous build
+		/// Note: These are compiled on their own to keep incremental builds cheap
+		/// </summary>
+		std::vector<Path> RecentlyEditedFiles;
+
+		/// <summary>
+		/// Gets or sets the header file that is precompiled for all source files
+		/// </summary>
+		Path PrecompiledHeaderFile;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to generate the precompiled header
+		/// from the system headers that are shared by most source files
+		/// </summary>
+		bool EnableAutoPrecompiledHeader;
+
+		/// <summary>
+		/// Gets or sets the percentage of source files that must include a system header
+		/// for it to be added to the automatic precompiled header
+		/// </summary>
+		uint32_t PrecompiledHeaderThreshold;
+
+		/// <summary>
+		/// Gets or sets the include directories that contain system headers
+		/// </summary>
+		std::vector<Path> SystemIncludeDirectories;
+
+		/// <summary>
+		/// Gets or sets the headers directly included by each source file in the previous build
+		/// </summary>
+		std::map<std::string, std::vector<Path>> SourceDirectIncludes;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to compile source files that share
+		/// the same arguments in a single compiler invocation when supported
+		/// </summary>
+		bool EnableBatchCompile;
+
+		/// <summary>
+		/// Gets or sets the maximum number of source files in a single compiler invocation
+		/// </summary>
+		uint32_t BatchCompileSize;
+
+		/// <summary>
+		/// Gets or sets the maximum number of threads a single batched invocation may use
+		/// Note: Zero uses one thread per source file
+		/// </summary>
+		uint32_t BatchCompileThreadCount;
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -202,7 +297,24 @@ namespace Soup::Compiler
 				LibraryPaths == rhs.LibraryPaths &&
 				PreprocessorDefinitions == rhs.PreprocessorDefinitions &&
 				OptimizationLevel == rhs.OptimizationLevel &&
-				GenerateSourceDebugInfo == rhs.GenerateSourceDebugInfo;
+				GenerateSourceDebugInfo == rhs.GenerateSourceDebugInfo &&
+				EnableSplitDebugInfo == rhs.EnableSplitDebugInfo &&
+				EnableDebugPackage == rhs.EnableDebugPackage &&
+				EnableThinLTO == rhs.EnableThinLTO &&
+				ThinLTOCachePolicy == rhs.ThinLTOCachePolicy &&
+				ThinLTOJobs == rhs.ThinLTOJobs &&
+				EnableUnityBuild == rhs.EnableUnityBuild &&
+				UnityBatchSize == rhs.UnityBatchSize &&
+				SourceIncludes == rhs.SourceIncludes &&
+				RecentlyEditedFiles == rhs.RecentlyEditedFiles &&
+				PrecompiledHeaderFile == rhs.PrecompiledHeaderFile &&
+				EnableAutoPrecompiledHeader == rhs.EnableAutoPrecompiledHeader &&
+				PrecompiledHeaderThreshold == rhs.PrecompiledHeaderThreshold &&
+				SystemIncludeDirectories == rhs.SystemIncludeDirectories &&
+				SourceDirectIncludes == rhs.SourceDirectIncludes &&
+				EnableBatchCompile == rhs.EnableBatchCompile &&
+				BatchCompileSize == rhs.BatchCompileSize &&
+				BatchCompileThreadCount == rhs.BatchCompileThreadCount;
 		}
 
 		bool operator !=(const BuildArguments& rhs) const
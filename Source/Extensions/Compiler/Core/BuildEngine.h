@@ -7,6 +7,8 @@
 #include "BuildResult.h"
 #include "BuildUtilities.h"
 #include "ICompiler.h"
+#include "PrecompiledHeaderPlanner.h"
+#include "UnityBuildPlanner.h"
 
 namespace Soup::Compiler
 {
@@ -15,6 +17,11 @@ namespace Soup::Compiler
 	/// </summary>
 	export class BuildEngine
 	{
+	private:
+		static constexpr std::string_view PrecompiledHeaderName = "PrecompiledHeader";
+		static constexpr std::string_view DebugPackageFileExtension = "dwp";
+		static constexpr std::string_view ThinLTOCacheDirectoryName = "ThinLTOCache/";
+
 	public:
 		BuildEngine(std::shared_ptr<ICompiler> compiler) :
 			_compiler(std::move(compiler))
@@ -39,22 +46,25 @@ namespace Soup::Compiler
 			}
 
 			// Ensure the output directories exists as the first step
+			auto graph = Soup::Build::Extensions::GraphBuilder();
 			auto objectDirectry = arguments.WorkingDirectory + arguments.ObjectDirectory;
 			auto binaryDirectry = arguments.WorkingDirectory + arguments.BinaryDirectory;
-			result.BuildNodes.push_back(
-				BuildUtilities::CreateCreateDirectoryNode(buildState, objectDirectry));
-			result.BuildNodes.push_back(
-				BuildUtilities::CreateCreateDirectoryNode(buildState, binaryDirectry));
+			auto createDirectoryNodes = std::vector<Soup::Build::Extensions::GraphNodeWrapper>({
+				BuildUtilities::CreateCreateDirectoryNode(buildState, objectDirectry),
+				BuildUtilities::CreateCreateDirectoryNode(buildState, binaryDirectry),
+			});
+			graph.AddPhase(createDirectoryNodes);
 
 			// Perform the core compilation of the source files
-			CoreCompile(buildState, arguments, result);
+			CoreCompile(buildState, arguments, graph, result);
 
 			// Link the final target after all of the compile graph is done
-			CoreLink(buildState, arguments, result);
+			CoreLink(buildState, arguments, graph, result);
 
 			// Copy previous runtime dependencies after linking has completed
-			CopyRuntimeDependencies(buildState, arguments, result);
+			CopyRuntimeDependencies(buildState, arguments, graph);
 
+			result.BuildNodes = graph.GetRoots();
 			return result;
 		}
 
@@ -65,6 +75,7 @@ namespace Soup::Compiler
 		void CoreCompile(
 			Soup::Build::Extensions::BuildStateWrapper& buildState,
 			const BuildArguments& arguments,
+			Soup::Build::Extensions::GraphBuilder& graph,
 			BuildResult& result)
 		{
 			auto rootCompileNodes = std::vector<Soup::Build::Extensions::GraphNodeWrapper>();
@@ -76,7 +87,7 @@ namespace Soup::Compiler
 				CompileModuleInterfaceUnit(
 					buildState,
 					arguments,
-					result);
+					graph);
 
 				// Copy the binary module interface to the binary directory after compiling
 				auto objectModuleInterfaceFile = 
@@ -92,7 +103,7 @@ namespace Soup::Compiler
 					buildState,
 					objectModuleInterfaceFile,
 					binaryOutputModuleInterfaceFile);
-				Soup::Build::Extensions::GraphNodeExtensions::AddLeafChild(result.BuildNodes, copyInterfaceNode);
+				graph.AddPhase(copyInterfaceNode);
 
 				// Add output module interface to the parent set of modules
 				// This will allow the module implementation units access as well as downstream
@@ -105,6 +116,7 @@ namespace Soup::Compiler
 				CompileSourceFiles(
 					buildState,
 					arguments,
+					graph,
 					result);
 			}
 		}
@@ -116,7 +128,7 @@ namespace Soup::Compiler
 		void CompileModuleInterfaceUnit(
 			Soup::Build::Extensions::BuildStateWrapper& buildState,
 			const BuildArguments& arguments,
-			BuildResult& result)
+			Soup::Build::Extensions::GraphBuilder& graph)
 		{
 			buildState.LogInfo("CompileModuleInterfaceUnit");
 
@@ -136,6 +148,8 @@ namespace Soup::Compiler
 			compileArguments.ExportModule = true;
 			compileArguments.PreprocessorDefinitions = arguments.PreprocessorDefinitions;
 			compileArguments.GenerateSourceDebugInfo = arguments.GenerateSourceDebugInfo;
+			compileArguments.SplitDebugInfo = UseSplitDebugInfo(arguments);
+			compileArguments.ThinLTO = UseThinLTO(arguments);
 			compileArguments.TargetFile = targetFile;
 
 			// Compile the individual translation unit
@@ -146,7 +160,7 @@ namespace Soup::Compiler
 			auto compileNode = _compiler->CreateCompileNode(buildState, compileArguments);
 
 			// Run after the module interface unit compile
-			Soup::Build::Extensions::GraphNodeExtensions::AddLeafChild(result.BuildNodes, compileNode);
+			graph.AddPhase(compileNode);
 		}
 
 		/// <summary>
@@ -155,7 +169,8 @@ namespace Soup::Compiler
 		void CompileSourceFiles(
 			Soup::Build::Extensions::BuildStateWrapper& buildState,
 			const BuildArguments& arguments,
-			BuildResult& result)
+			Soup::Build::Extensions::GraphBuilder& graph,
+			const BuildResult& result)
 		{
 			// Check if we can skip the whole dang thing
 			buildState.LogInfo("Compiling source files");
@@ -172,6 +187,8 @@ namespace Soup::Compiler
 			compileArguments.ExportModule = false;
 			compileArguments.PreprocessorDefinitions = arguments.PreprocessorDefinitions;
 			compileArguments.GenerateSourceDebugInfo = arguments.GenerateSourceDebugInfo;
+			compileArguments.SplitDebugInfo = UseSplitDebugInfo(arguments);
+			compileArguments.ThinLTO = UseThinLTO(arguments);
 
 			// Include our own interface module file
 			std::copy(
@@ -179,22 +196,184 @@ namespace Soup::Compiler
 				result.ModuleDependencies.end(),
 				std::back_inserter(compileArguments.IncludeModules)); 
 
+			// Write the arguments that are the same for every translation unit once
+			if (_compiler->SupportsResponseFiles())
+			{
+				auto responseFile = arguments.ObjectDirectory + Path("args.rsp");
+				buildState.LogInfo("Generate Response File Node: " + responseFile.ToString());
+				auto writeNode = BuildUtilities::CreateWriteFileNode(
+					buildState,
+					arguments.WorkingDirectory + responseFile,
+					_compiler->CreateResponseFileArguments(compileArguments));
+
+				// Every compile, including the precompiled header, reads the response file
+				graph.AddPhase(writeNode);
+				compileArguments.ResponseFile = responseFile;
+			}
+
+			// Compile the shared precompiled header that all translation units depend on
+			auto precompiledHeaderNodes = std::vector<Soup::Build::Extensions::GraphNodeWrapper>();
+			auto precompiledHeaderFile = Path();
+			auto generatedHeaders = std::vector<Path>();
+			if (TryGetPrecompiledHeader(arguments, precompiledHeaderFile, generatedHeaders))
+			{
+				precompiledHeaderNodes.push_back(
+					CompilePrecompiledHeader(
+						buildState,
+						arguments,
+						compileArguments,
+						precompiledHeaderFile,
+						generatedHeaders));
+
+				compileArguments.PrecompiledHeader = PrecompiledHeaderMode::Use;
+				compileArguments.PrecompiledHeaderFile = precompiledHeaderFile;
+				compileArguments.PrecompiledHeaderTarget = GetPrecompiledHeaderTarget(arguments);
+			}
+
 			// Compile the individual translation units
+			bool useBatchCompile = arguments.EnableBatchCompile && _compiler->SupportsBatchCompile();
+			auto compileBatches = GetCompileBatches(arguments);
+
+			// The batched compiler output only echoes the file name of each source file,
+			// files that share a name cannot be told apart and are compiled on their own
+			auto fileNameCounts = std::map<std::string, size_t>();
+			for (auto& batch : compileBatches)
+			{
+				if (batch.size() == 1)
+					fileNameCounts[batch[0].GetFileName()]++;
+			}
+
+			auto batchCompileFiles = std::vector<Path>();
 			auto buildNodes = std::vector<Soup::Build::Extensions::GraphNodeWrapper>();
-			for (auto& file : arguments.SourceFiles)
+			for (auto& batch : compileBatches)
+			{
+				if (batch.size() == 1 && useBatchCompile && fileNameCounts[batch[0].GetFileName()] == 1)
+				{
+					// Compile together with the other files that share the same arguments
+					batchCompileFiles.push_back(batch[0]);
+				}
+				else if (batch.size() == 1)
+				{
+					auto& file = batch[0];
+					buildState.LogInfo("Generate Compile Node: " + file.ToString());
+					compileArguments.SourceFile = file;
+					compileArguments.TargetFile = arguments.ObjectDirectory + Path(file.GetFileName());
+					compileArguments.TargetFile.SetFileExtension(_compiler->GetObjectFileExtension());
+
+					// Compile the file
+					auto node = _compiler->CreateCompileNode(buildState, compileArguments);
+					buildNodes.push_back(std::move(node));
+				}
+				else
+				{
+					// Generate the unity translation unit that includes each file in the batch
+					auto unityFile = arguments.ObjectDirectory + Path(UnityBuildPlanner::GetUnityFileName(batch));
+					auto unityLines = std::vector<std::string>();
+					for (auto& file : batch)
+					{
+						auto includeFile = file.HasRoot() ? file : arguments.WorkingDirectory + file;
+						unityLines.push_back("#include \"" + includeFile.ToString() + "\"");
+					}
+
+					auto writeNode = BuildUtilities::CreateWriteFileNode(
+						buildState,
+						arguments.WorkingDirectory + unityFile,
+						unityLines);
+
+					buildState.LogInfo("Generate Unity Compile Node: " + unityFile.ToString());
+					compileArguments.SourceFile = unityFile;
+					compileArguments.TargetFile = unityFile;
+					compileArguments.TargetFile.SetFileExtension(_compiler->GetObjectFileExtension());
+
+					// Compile the unity file after it has been generated
+					auto compileNode = _compiler->CreateCompileNode(buildState, compileArguments);
+					writeNode.GetChildList().Append(compileNode);
+					buildNodes.push_back(std::move(writeNode));
+				}
+			}
+
+			// Compile the files that share the same arguments in as few invocations as possible
+			auto batchCompileSize = std::max<size_t>(1, arguments.BatchCompileSize);
+			for (size_t offset = 0; offset < batchCompileFiles.size(); offset += batchCompileSize)
 			{
-				buildState.LogInfo("Generate Compile Node: " + file.ToString());
-				compileArguments.SourceFile = file;
-				compileArguments.TargetFile = arguments.ObjectDirectory + Path(file.GetFileName());
-				compileArguments.TargetFile.SetFileExtension(_compiler->GetObjectFileExtension());
-
-				// Compile the file
-				auto node = _compiler->CreateCompileNode(buildState, compileArguments);
-				buildNodes.push_back(std::move(node));
+				auto end = std::min(offset + batchCompileSize, batchCompileFiles.size());
+				auto sourceFiles = std::vector<Path>(
+					batchCompileFiles.begin() + offset,
+					batchCompileFiles.begin() + end);
+
+				if (sourceFiles.size() == 1)
+				{
+					auto& file = sourceFiles[0];
+					buildState.LogInfo("Generate Compile Node: " + file.ToString());
+					compileArguments.SourceFile = file;
+					compileArguments.TargetFile = arguments.ObjectDirectory + Path(file.GetFileName());
+					compileArguments.TargetFile.SetFileExtension(_compiler->GetObjectFileExtension());
+
+					auto node = _compiler->CreateCompileNode(buildState, compileArguments);
+					buildNodes.push_back(std::move(node));
+				}
+				else
+				{
+					// Use one thread per file unless the build limits the parallelism
+					auto threadCount = static_cast<uint32_t>(sourceFiles.size());
+					if (arguments.BatchCompileThreadCount > 0)
+						threadCount = std::min(threadCount, arguments.BatchCompileThreadCount);
+
+					buildState.LogInfo("Generate Batch Compile Node: " + std::to_string(sourceFiles.size()) + " files");
+					auto node = _compiler->CreateBatchCompileNode(
+						buildState,
+						compileArguments,
+						sourceFiles,
+						arguments.ObjectDirectory,
+						threadCount);
+					buildNodes.push_back(std::move(node));
+				}
 			}
 
+			// Every translation unit waits on the precompiled header
+			graph.AddPhase(precompiledHeaderNodes);
+
 			// Run the core compile next
-			Soup::Build::Extensions::GraphNodeExtensions::AddLeafChildren(result.BuildNodes, buildNodes);
+			graph.AddPhase(buildNodes);
+		}
+
+		/// <summary>
+		/// Compile the precompiled header
+		/// Note: The automatic header is generated from the selected system headers first
+		/// </summary>
+		Soup::Build::Extensions::GraphNodeWrapper CompilePrecompiledHeader(
+			Soup::Build::Extensions::BuildStateWrapper& buildState,
+			const BuildArguments& arguments,
+			const CompileArguments& compileArguments,
+			const Path& headerFile,
+			const std::vector<Path>& generatedHeaders)
+		{
+			buildState.LogInfo("Generate Precompiled Header Node: " + headerFile.ToString());
+			auto createArguments = compileArguments;
+			createArguments.PrecompiledHeader = PrecompiledHeaderMode::Create;
+			createArguments.PrecompiledHeaderFile = headerFile;
+			createArguments.PrecompiledHeaderTarget = GetPrecompiledHeaderTarget(arguments);
+			createArguments.SourceFile = headerFile;
+			createArguments.TargetFile = GetPrecompiledHeaderObject(arguments);
+
+			auto compileNode = _compiler->CreateCompileNode(buildState, createArguments);
+			if (generatedHeaders.empty())
+				return compileNode;
+
+			auto headerLines = std::vector<std::string>({
+				"// Generated precompiled header",
+			});
+			for (auto& header : generatedHeaders)
+				headerLines.push_back("#include \"" + header.ToString() + "\"");
+
+			auto writeNode = BuildUtilities::CreateWriteFileNode(
+				buildState,
+				arguments.WorkingDirectory + headerFile,
+				headerLines);
+
+			// Compile the header after it has been generated
+			writeNode.GetChildList().Append(compileNode);
+			return writeNode;
 		}
 
 		/// <summary>
@@ -203,6 +382,7 @@ namespace Soup::Compiler
 		void CoreLink(
 			Soup::Build::Extensions::BuildStateWrapper& buildState,
 			const BuildArguments& arguments,
+			Soup::Build::Extensions::GraphBuilder& graph,
 			BuildResult& result)
 		{
 			buildState.LogInfo("CoreLink");
@@ -242,6 +422,26 @@ namespace Soup::Compiler
 			linkArguments.RootDirectory = arguments.WorkingDirectory;
 			linkArguments.LibraryPaths = arguments.LibraryPaths;
 			linkArguments.GenerateSourceDebugInfo = arguments.GenerateSourceDebugInfo;
+			linkArguments.SplitDebugInfo = UseSplitDebugInfo(arguments);
+
+			// Package the split debug information for the final binaries
+			if (linkArguments.SplitDebugInfo &&
+				arguments.EnableDebugPackage &&
+				arguments.TargetType != BuildTargetType::StaticLibrary)
+			{
+				linkArguments.DebugPackageFile =
+					arguments.BinaryDirectory +
+					Path(arguments.TargetName + "." + std::string(DebugPackageFileExtension));
+			}
+
+			// Keep the link time optimization cache in the object directory so it persists across builds
+			if (UseThinLTO(arguments))
+			{
+				linkArguments.ThinLTO = true;
+				linkArguments.ThinLTOCacheDirectory = arguments.ObjectDirectory + Path(ThinLTOCacheDirectoryName);
+				linkArguments.ThinLTOCachePolicy = arguments.ThinLTOCachePolicy;
+				linkArguments.ThinLTOJobs = arguments.ThinLTOJobs;
+			}
 
 			// Only resolve link libraries if not a library ourself
 			if (arguments.TargetType != BuildTargetType::StaticLibrary)
@@ -294,9 +494,11 @@ namespace Soup::Compiler
 
 			// Build up the set of object files
 			std::vector<Path> objectFiles;
-			for (auto& sourceFile : arguments.SourceFiles)
+			for (auto& batch : GetCompileBatches(arguments))
 			{
-				auto objectFile = arguments.ObjectDirectory + Path(sourceFile.GetFileName());
+				auto objectFile = batch.size() == 1 ?
+					arguments.ObjectDirectory + Path(batch[0].GetFileName()) :
+					arguments.ObjectDirectory + Path(UnityBuildPlanner::GetUnityFileName(batch));
 				objectFile.SetFileExtension(_compiler->GetObjectFileExtension());
 				objectFiles.push_back(objectFile);
 			}
@@ -309,6 +511,16 @@ namespace Soup::Compiler
 				objectFiles.push_back(objectFile);
 			}
 
+			// Add the precompiled header object file if the compiler requires it
+			auto precompiledHeaderFile = Path();
+			auto generatedHeaders = std::vector<Path>();
+			if (_compiler->IsPrecompiledHeaderObjectLinked() &&
+				!arguments.SourceFiles.empty() &&
+				TryGetPrecompiledHeader(arguments, precompiledHeaderFile, generatedHeaders))
+			{
+				objectFiles.push_back(GetPrecompiledHeaderObject(arguments));
+			}
+
 			linkArguments.ObjectFiles = std::move(objectFiles);
 
 			// Perform the link
@@ -316,7 +528,7 @@ namespace Soup::Compiler
 			auto linkNode = _compiler->CreateLinkNode(buildState, linkArguments);
 
 			// Run the link node
-			Soup::Build::Extensions::GraphNodeExtensions::AddLeafChild(result.BuildNodes, linkNode);
+			graph.AddPhase(linkNode);
 		}
 
 		/// <summary>
@@ -325,7 +537,7 @@ namespace Soup::Compiler
 		void CopyRuntimeDependencies(
 			Soup::Build::Extensions::BuildStateWrapper& buildState,
 			const BuildArguments& arguments,
-			BuildResult& result)
+			Soup::Build::Extensions::GraphBuilder& graph)
 		{
 			if (arguments.TargetType == BuildTargetType::Executable ||
 				arguments.TargetType == BuildTargetType::DynamicLibrary)
@@ -337,11 +549,97 @@ namespace Soup::Compiler
 					auto node = BuildUtilities::CreateCopyFileNode(buildState, source, target);
 					copyNodes.push_back(node);
 				}
-				
-				if (!copyNodes.empty())
-				{
-					Soup::Build::Extensions::GraphNodeExtensions::AddLeafChildren(result.BuildNodes, copyNodes);
-				}
+
+				graph.AddPhase(copyNodes);
+			}
+		}
+
+		/// <summary>
+		/// Get the header that is precompiled for all source files
+		/// Returns false if no precompiled header is used
+		/// </summary>
+		bool TryGetPrecompiledHeader(
+			const BuildArguments& arguments,
+			Path& headerFile,
+			std::vector<Path>& generatedHeaders)
+		{
+			if (!arguments.PrecompiledHeaderFile.IsEmpty())
+			{
+				headerFile = arguments.PrecompiledHeaderFile;
+				return true;
+			}
+			else if (arguments.EnableAutoPrecompiledHeader)
+			{
+				generatedHeaders = PrecompiledHeaderPlanner::SelectHeaders(
+					arguments.SourceFiles,
+					arguments.SourceDirectIncludes,
+					arguments.SystemIncludeDirectories,
+					arguments.PrecompiledHeaderThreshold);
+				if (generatedHeaders.empty())
+					return false;
+
+				headerFile = arguments.ObjectDirectory + Path(std::string(PrecompiledHeaderName) + ".h");
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Split debug information is only used for debug builds with a compiler that supports it
+		/// </summary>
+		bool UseSplitDebugInfo(const BuildArguments& arguments)
+		{
+			return arguments.GenerateSourceDebugInfo &&
+				arguments.EnableSplitDebugInfo &&
+				_compiler->SupportsSplitDebugInfo();
+		}
+
+		/// <summary>
+		/// Link time optimization is only used for optimized builds with a compiler that supports it
+		/// </summary>
+		bool UseThinLTO(const BuildArguments& arguments)
+		{
+			return arguments.EnableThinLTO &&
+				arguments.OptimizationLevel != BuildOptimizationLevel::None &&
+				_compiler->SupportsThinLTO();
+		}
+
+		Path GetPrecompiledHeaderTarget(const BuildArguments& arguments)
+		{
+			return arguments.ObjectDirectory +
+				Path(std::string(PrecompiledHeaderName) + "." + std::string(_compiler->GetPrecompiledHeaderFileExtension()));
+		}
+
+		Path GetPrecompiledHeaderObject(const BuildArguments& arguments)
+		{
+			return arguments.ObjectDirectory +
+				Path(std::string(PrecompiledHeaderName) + "." + std::string(_compiler->GetObjectFileExtension()));
+		}
+
+		/// <summary>
+		/// Get the sets of source files that are compiled together
+		/// Note: Every file is its own batch unless unity builds are enabled
+		/// </summary>
+		std::vector<std::vector<Path>> GetCompileBatches(const BuildArguments& arguments)
+		{
+			if (arguments.EnableUnityBuild)
+			{
+				return UnityBuildPlanner::CreateBatches(
+					arguments.SourceFiles,
+					arguments.SourceIncludes,
+					arguments.RecentlyEditedFiles,
+					arguments.UnityBatchSize);
+			}
+			else
+			{
+				auto result = std::vector<std::vector<Path>>();
+				for (auto& file : arguments.SourceFiles)
+					result.push_back({ file });
+
+				return result;
 			}
 		}
 
@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "ICompiler.h"
 
 namespace Soup::Compiler
 {
@@ -11,7 +12,119 @@ namespace Soup::Compiler
 	/// </summary>
 	export class BuildUtilities
 	{
+	private:
+		/// <summary>
+		/// Rough peak memory estimates in megabytes used to weight build nodes
+		/// </summary>
+		static constexpr uint64_t CompileBaseMemoryWeight = 256;
+		static constexpr uint64_t CompileOptimizeMemoryWeight = 256;
+		static constexpr uint64_t CompileDebugInfoMemoryWeight = 128;
+		static constexpr uint64_t CompileModuleMemoryWeight = 32;
+		static constexpr uint64_t LinkBaseMemoryWeight = 512;
+		static constexpr uint64_t LinkInputMemoryWeight = 8;
+		static constexpr uint64_t LinkThinLTOJobMemoryWeight = 256;
+		static constexpr uint64_t ArchiveMemoryWeight = 128;
+		static constexpr uint64_t CopyMemoryWeight = 16;
+
 	public:
+		/// <summary>
+		/// Estimate the peak memory a single compile will require
+		/// </summary>
+		static uint64_t EstimateCompileMemoryWeight(const CompileArguments& args)
+		{
+			auto result = CompileBaseMemoryWeight;
+			if (args.Optimize != OptimizationLevel::None)
+				result += CompileOptimizeMemoryWeight;
+
+			if (args.GenerateSourceDebugInfo)
+				result += CompileDebugInfoMemoryWeight;
+
+			// Each imported module interface is loaded into the front end
+			result += CompileModuleMemoryWeight * args.IncludeModules.size();
+
+			return result;
+		}
+
+		/// <summary>
+		/// Estimate the peak memory a single link will require
+		/// </summary>
+		static uint64_t EstimateLinkMemoryWeight(const LinkArguments& args)
+		{
+			if (args.TargetType == LinkTarget::StaticLibrary)
+				return ArchiveMemoryWeight;
+
+			auto inputCount = args.ObjectFiles.size() + args.LibraryFiles.size();
+			auto result = LinkBaseMemoryWeight + LinkInputMemoryWeight * inputCount;
+
+			// Merging the debug information roughly doubles the working set
+			// Note: Split debug information stays in the separate files
+			if (args.GenerateSourceDebugInfo && !args.SplitDebugInfo)
+				result *= 2;
+
+			// Each link time optimization backend job generates code for its own modules
+			if (args.ThinLTO)
+				result += LinkThinLTOJobMemoryWeight * std::max<uint32_t>(1, args.ThinLTOJobs);
+
+			return result;
+		}
+
+		/// <summary>
+		/// Tag a compile node with its resource requirements
+		/// </summary>
+		static void SetCompileResources(
+			Soup::Build::Extensions::GraphNodeWrapper& node,
+			const CompileArguments& args)
+		{
+			node.SetResourceClass(Soup::Build::ResourceClass::Compile);
+			node.SetMemoryWeight(EstimateCompileMemoryWeight(args));
+		}
+
+		/// <summary>
+		/// Tag a batched compile node with its resource requirements
+		/// Note: Each thread runs its own compiler front end
+		/// </summary>
+		static void SetBatchCompileResources(
+			Soup::Build::Extensions::GraphNodeWrapper& node,
+			const CompileArguments& args,
+			uint32_t threadCount)
+		{
+			auto threads = std::max<uint32_t>(1, threadCount);
+			node.SetResourceClass(Soup::Build::ResourceClass::Compile);
+			node.SetMemoryWeight(EstimateCompileMemoryWeight(args) * threads);
+			node.SetThreadCount(threads);
+		}
+
+		/// <summary>
+		/// Tag a link node with its resource requirements
+		/// </summary>
+		static void SetLinkResources(
+			Soup::Build::Extensions::GraphNodeWrapper& node,
+			const LinkArguments& args)
+		{
+			if (args.TargetType == LinkTarget::StaticLibrary)
+				node.SetResourceClass(Soup::Build::ResourceClass::Archive);
+			else
+				node.SetResourceClass(Soup::Build::ResourceClass::Link);
+
+			node.SetMemoryWeight(EstimateLinkMemoryWeight(args));
+
+			// Reserve a job slot for each link time optimization backend thread
+			if (args.TargetType != LinkTarget::StaticLibrary && args.ThinLTO && args.ThinLTOJobs > 1)
+				node.SetThreadCount(args.ThinLTOJobs);
+		}
+
+		/// <summary>
+		/// Tag a debug package node with its resource requirements
+		/// Note: Packaging merges the split debug information much like a link
+		/// </summary>
+		static void SetDebugPackageResources(
+			Soup::Build::Extensions::GraphNodeWrapper& node,
+			const LinkArguments& args)
+		{
+			node.SetResourceClass(Soup::Build::ResourceClass::Link);
+			node.SetMemoryWeight(LinkBaseMemoryWeight + LinkInputMemoryWeight * args.ObjectFiles.size());
+		}
+
 		/// <summary>
 		/// Create a build node that will copy a file
 		/// </summary>
@@ -23,26 +136,50 @@ namespace Soup::Compiler
 			auto titleStream = std::stringstream();
 			titleStream << "Copy [" << source.ToString() << "] -> [" << destination.ToString() << "]";
 
-			auto program = Path("C:/Windows/System32/cmd.exe");
-			auto workingDirectory = Path("");
-			auto inputFiles = std::vector<Path>({
+			return CreateBuiltInFileNode(
+				state,
+				titleStream.str(),
+				Soup::Build::Extensions::BuiltInOperation::Copy,
 				source,
-			});
-			auto outputFiles = std::vector<Path>({
-				destination,
-			});
+				destination);
+		}
 
-			// Build the arguments
-			std::stringstream arguments;
-			arguments << "/C copy /Y \"" << source.ToAlternateString() << "\" \"" << destination.ToAlternateString() << "\"";
-
-			return state.CreateNode(
-					titleStream.str(),
-					std::move(program),
-					arguments.str(),
-					std::move(workingDirectory),
-					std::move(inputFiles),
-					std::move(outputFiles));
+		/// <summary>
+		/// Create a build node that will hard link a file
+		/// </summary>
+		static Soup::Build::Extensions::GraphNodeWrapper CreateHardLinkNode(
+			Soup::Build::Extensions::BuildStateWrapper& state,
+			const Path& source,
+			const Path& destination)
+		{
+			auto titleStream = std::stringstream();
+			titleStream << "HardLink [" << source.ToString() << "] -> [" << destination.ToString() << "]";
+
+			return CreateBuiltInFileNode(
+				state,
+				titleStream.str(),
+				Soup::Build::Extensions::BuiltInOperation::HardLink,
+				source,
+				destination);
+		}
+
+		/// <summary>
+		/// Create a build node that will symbolic link a file
+		/// </summary>
+		static Soup::Build::Extensions::GraphNodeWrapper CreateSymbolicLinkNode(
+			Soup::Build::Extensions::BuildStateWrapper& state,
+			const Path& source,
+			const Path& destination)
+		{
+			auto titleStream = std::stringstream();
+			titleStream << "SymLink [" << source.ToString() << "] -> [" << destination.ToString() << "]";
+
+			return CreateBuiltInFileNode(
+				state,
+				titleStream.str(),
+				Soup::Build::Extensions::BuiltInOperation::SymbolicLink,
+				source,
+				destination);
 		}
 
 		/// <summary>
@@ -55,7 +192,6 @@ namespace Soup::Compiler
 			auto titleStream = std::stringstream();
 			titleStream << "MakeDir [" << directory.ToString() << "]";
 
-			auto program = Path("C:/Windows/System32/cmd.exe");
 			auto workingDirectory = Path("");
 			auto inputFiles = std::vector<Path>({});
 			auto outputFiles = std::vector<Path>({
@@ -63,16 +199,101 @@ namespace Soup::Compiler
 			});
 
 			// Build the arguments
-			std::stringstream arguments;
-			arguments << "/C if not exist \"" << directory.ToString() << "\" mkdir \"" << directory.ToString() << "\"";
+			auto arguments = Soup::Build::Extensions::FormatBuiltInArguments({
+				directory.ToString(),
+			});
 
-			return state.CreateNode(
-				titleStream.str(),
-				std::move(program),
-				arguments.str(),
-				std::move(workingDirectory),
-				std::move(inputFiles),
-				std::move(outputFiles));
+			// Note: The program is set directly since it is not a valid path
+			auto node = state.CreateNode();
+			node.SetTitle(titleStream.str());
+			node.SetProgram(Soup::Build::Extensions::GetBuiltInProgram(
+				Soup::Build::Extensions::BuiltInOperation::MakeDirectory));
+			node.SetArguments(arguments);
+			node.SetWorkingDirectory(workingDirectory.ToString());
+			node.GetInputFileList().SetAll(inputFiles);
+			node.GetOutputFileList().SetAll(outputFiles);
+			node.SetResourceClass(Soup::Build::ResourceClass::Copy);
+			node.SetMemoryWeight(CopyMemoryWeight);
+
+			return node;
+		}
+
+		/// <summary>
+		/// Create a build node that will write a generated text file
+		/// </summary>
+		static Soup::Build::Extensions::GraphNodeWrapper CreateWriteFileNode(
+			Soup::Build::Extensions::BuildStateWrapper& state,
+			const Path& file,
+			const std::vector<std::string>& lines)
+		{
+			auto titleStream = std::stringstream();
+			titleStream << "WriteFile [" << file.ToString() << "]";
+
+			auto workingDirectory = Path("");
+			auto inputFiles = std::vector<Path>({});
+			auto outputFiles = std::vector<Path>({
+				file,
+			});
+
+			// Build the arguments
+			auto values = std::vector<std::string>({
+				file.ToString(),
+			});
+			values.insert(values.end(), lines.begin(), lines.end());
+			auto arguments = Soup::Build::Extensions::FormatBuiltInArguments(values);
+
+			// Note: The program is set directly since it is not a valid path
+			auto node = state.CreateNode();
+			node.SetTitle(titleStream.str());
+			node.SetProgram(Soup::Build::Extensions::GetBuiltInProgram(
+				Soup::Build::Extensions::BuiltInOperation::WriteFile));
+			node.SetArguments(arguments);
+			node.SetWorkingDirectory(workingDirectory.ToString());
+			node.GetInputFileList().SetAll(inputFiles);
+			node.GetOutputFileList().SetAll(outputFiles);
+			node.SetResourceClass(Soup::Build::ResourceClass::Copy);
+			node.SetMemoryWeight(CopyMemoryWeight);
+
+			return node;
+		}
+
+	private:
+		/// <summary>
+		/// Create a build node for a built in operation from a single source file to a destination
+		/// </summary>
+		static Soup::Build::Extensions::GraphNodeWrapper CreateBuiltInFileNode(
+			Soup::Build::Extensions::BuildStateWrapper& state,
+			const std::string& title,
+			Soup::Build::Extensions::BuiltInOperation operation,
+			const Path& source,
+			const Path& destination)
+		{
+			auto workingDirectory = Path("");
+			auto inputFiles = std::vector<Path>({
+				source,
+			});
+			auto outputFiles = std::vector<Path>({
+				destination,
+			});
+
+			// Build the arguments
+			auto arguments = Soup::Build::Extensions::FormatBuiltInArguments({
+				source.ToString(),
+				destination.ToString(),
+			});
+
+			// Note: The program is set directly since it is not a valid path
+			auto node = state.CreateNode();
+			node.SetTitle(title);
+			node.SetProgram(Soup::Build::Extensions::GetBuiltInProgram(operation));
+			node.SetArguments(arguments);
+			node.SetWorkingDirectory(workingDirectory.ToString());
+			node.GetInputFileList().SetAll(inputFiles);
+			node.GetOutputFileList().SetAll(outputFiles);
+			node.SetResourceClass(Soup::Build::ResourceClass::Copy);
+			node.SetMemoryWeight(CopyMemoryWeight);
+
+			return node;
 		}
 	};
 }
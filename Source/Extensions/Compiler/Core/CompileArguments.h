@@ -85,6 +85,42 @@ namespace Soup::Compiler
 		}
 	}
 
+	/// <summary>
+	/// The enumeration of precompiled header usage
+	/// </summary>
+	export enum class PrecompiledHeaderMode
+	{
+		/// <summary>
+		/// Do not use a precompiled header
+		/// </summary>
+		None,
+
+		/// <summary>
+		/// Create the precompiled header from the header file
+		/// </summary>
+		Create,
+
+		/// <summary>
+		/// Use an existing precompiled header
+		/// </summary>
+		Use,
+	};
+
+	std::string ToString(PrecompiledHeaderMode value)
+	{
+		switch (value)
+		{
+			case PrecompiledHeaderMode::None:
+				return "None";
+			case PrecompiledHeaderMode::Create:
+				return "Create";
+			case PrecompiledHeaderMode::Use:
+				return "Use";
+			default:
+				throw std::runtime_error("Unknown PrecompiledHeaderMode");
+		}
+	}
+
 	/// <summary>
 	/// The set of standard compiler arguments
 	/// </summary>
@@ -145,6 +181,38 @@ namespace Soup::Compiler
 		/// </summary>
 		bool GenerateSourceDebugInfo;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to write the source debug information
+		/// to a separate file next to the object file
+		/// </summary>
+		bool SplitDebugInfo;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to emit objects for incremental link time optimization
+		/// </summary>
+		bool ThinLTO;
+
+		/// <summary>
+		/// Gets or sets the precompiled header usage
+		/// </summary>
+		PrecompiledHeaderMode PrecompiledHeader;
+
+		/// <summary>
+		/// Gets or sets the header file that is precompiled
+		/// </summary>
+		Path PrecompiledHeaderFile;
+
+		/// <summary>
+		/// Gets or sets the compiled precompiled header file
+		/// </summary>
+		Path PrecompiledHeaderTarget;
+
+		/// <summary>
+		/// Gets or sets the shared response file that holds the include directories,
+		/// preprocessor definitions and module references
+		/// </summary>
+		Path ResponseFile;
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -160,7 +228,13 @@ namespace Soup::Compiler
 				IncludeModules == rhs.IncludeModules &&
 				ExportModule == rhs.ExportModule &&
 				GenerateIncludeTree == rhs.GenerateIncludeTree &&
-				GenerateSourceDebugInfo == rhs.GenerateSourceDebugInfo;
+				GenerateSourceDebugInfo == rhs.GenerateSourceDebugInfo &&
+				SplitDebugInfo == rhs.SplitDebugInfo &&
+				ThinLTO == rhs.ThinLTO &&
+				PrecompiledHeader == rhs.PrecompiledHeader &&
+				PrecompiledHeaderFile == rhs.PrecompiledHeaderFile &&
+				PrecompiledHeaderTarget == rhs.PrecompiledHeaderTarget &&
+				ResponseFile == rhs.ResponseFile;
 		}
 
 		bool operator !=(const CompileArguments& rhs) const
@@ -193,7 +267,10 @@ namespace Soup::Compiler
 
 			stringBuilder << "], " <<
 				std::to_string(ExportModule) << ", " <<
-				std::to_string(GenerateIncludeTree) << "]";
+				std::to_string(GenerateIncludeTree) << ", " <<
+				::Soup::Compiler::ToString(PrecompiledHeader) << ", " <<
+				PrecompiledHeaderFile.ToString() << ", " <<
+				PrecompiledHeaderTarget.ToString() << "]";
 
 			return stringBuilder.str();
 		}
@@ -41,6 +41,29 @@ namespace Soup::Compiler
 		/// </summary>
 		virtual std::string_view GetDynamicLibraryFileExtension() const = 0;
 
+		/// <summary>
+		/// Gets the precompiled header file extension for the compiler
+		/// </summary>
+		virtual std::string_view GetPrecompiledHeaderFileExtension() const = 0;
+
+		/// <summary>
+		/// Gets a value indicating whether the object file generated alongside
+		/// the precompiled header must be linked into the final target
+		/// </summary>
+		virtual bool IsPrecompiledHeaderObjectLinked() const = 0;
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler can write the source debug
+		/// information to separate files that are not merged by the linker
+		/// </summary>
+		virtual bool SupportsSplitDebugInfo() const = 0;
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler supports incremental link time
+		/// optimization with a persistent cache
+		/// </summary>
+		virtual bool SupportsThinLTO() const = 0;
+
 		/// <summary>
 		/// Compile
 		/// </summary>
@@ -49,6 +72,36 @@ namespace Soup::Compiler
 			Build::Extensions::BuildStateWrapper& state,
 			const CompileArguments& args) const = 0;
 
+		/// <summary>
+		/// Gets a value indicating whether the compiler can compile multiple
+		/// source files in a single invocation
+		/// </summary>
+		virtual bool SupportsBatchCompile() const = 0;
+
+		/// <summary>
+		/// Compile a batch of source files that share the same arguments
+		/// Note: The source and target file of the arguments are ignored, each source file
+		/// is compiled to an object file with the same name in the target directory
+		/// </summary>
+		virtual Build::Extensions::GraphNodeWrapper CreateBatchCompileNode(
+			Build::Extensions::BuildStateWrapper& state,
+			const CompileArguments& args,
+			const std::vector<Path>& sourceFiles,
+			const Path& targetDirectory,
+			uint32_t threadCount) const = 0;
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler can read arguments from a response file
+		/// </summary>
+		virtual bool SupportsResponseFiles() const = 0;
+
+		/// <summary>
+		/// Build the arguments that are shared by every compile in a package and are
+		/// written once to the response file
+		/// </summary>
+		virtual std::vector<std::string> CreateResponseFileArguments(
+			const CompileArguments& args) const = 0;
+
 		/// <summary>
 		/// Link
 		/// </summary>
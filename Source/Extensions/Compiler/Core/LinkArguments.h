@@ -91,6 +91,39 @@ namespace Soup::Compiler
 		/// </summary>
 		bool GenerateSourceDebugInfo;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether the object files reference their
+		/// source debug information in separate files instead of carrying it
+		/// </summary>
+		bool SplitDebugInfo;
+
+		/// <summary>
+		/// Gets or sets the package file that combines the separate debug information
+		/// Note: No package is generated when empty
+		/// </summary>
+		Path DebugPackageFile;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to perform incremental link time optimization
+		/// </summary>
+		bool ThinLTO;
+
+		/// <summary>
+		/// Gets or sets the directory that caches the link time optimized modules across builds
+		/// </summary>
+		Path ThinLTOCacheDirectory;
+
+		/// <summary>
+		/// Gets or sets the policy used to prune the link time optimization cache
+		/// </summary>
+		std::string ThinLTOCachePolicy;
+
+		/// <summary>
+		/// Gets or sets the number of parallel link time optimization backend jobs
+		/// Note: Zero lets the linker decide
+		/// </summary>
+		uint32_t ThinLTOJobs;
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -104,7 +137,13 @@ namespace Soup::Compiler
 				LibraryFiles == rhs.LibraryFiles &&
 				ExternalLibraryFiles == rhs.ExternalLibraryFiles &&
 				LibraryPaths == rhs.LibraryPaths &&
-				GenerateSourceDebugInfo == rhs.GenerateSourceDebugInfo;
+				GenerateSourceDebugInfo == rhs.GenerateSourceDebugInfo &&
+				SplitDebugInfo == rhs.SplitDebugInfo &&
+				DebugPackageFile == rhs.DebugPackageFile &&
+				ThinLTO == rhs.ThinLTO &&
+				ThinLTOCacheDirectory == rhs.ThinLTOCacheDirectory &&
+				ThinLTOCachePolicy == rhs.ThinLTOCachePolicy &&
+				ThinLTOJobs == rhs.ThinLTOJobs;
 		}
 
 		bool operator !=(const LinkArguments& rhs) const
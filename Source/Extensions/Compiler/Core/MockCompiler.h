@@ -17,7 +17,18 @@ namespace Soup::Compiler::Mock
 		/// Initializes a new instance of the <see cref='MockCompiler'/> class.
 		/// </summary>
 		Compiler() :
+			Compiler(false)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref='MockCompiler'/> class
+		/// that optionally reads the shared arguments from a response file.
+		/// </summary>
+		Compiler(bool supportsResponseFiles) :
+			_supportsResponseFiles(supportsResponseFiles),
 			_compileRequests(),
+			_responseFileRequests(),
 			_linkRequests()
 		{
 		}
@@ -30,6 +41,14 @@ namespace Soup::Compiler::Mock
 			return _compileRequests;
 		}
 
+		/// <summary>
+		/// Get the response file requests
+		/// </summary>
+		const std::vector<CompileArguments>& GetResponseFileRequests() const
+		{
+			return _responseFileRequests;
+		}
+
 		/// <summary>
 		/// Get the link requests
 		/// </summary>
@@ -80,6 +99,38 @@ namespace Soup::Compiler::Mock
 			return "mock.dll";
 		}
 
+		/// <summary>
+		/// Gets the precompiled header file extension for the compiler
+		/// </summary>
+		std::string_view GetPrecompiledHeaderFileExtension() const override final
+		{
+			return "mock.pch";
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the precompiled header object must be linked
+		/// </summary>
+		bool IsPrecompiledHeaderObjectLinked() const override final
+		{
+			return false;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler supports split debug information
+		/// </summary>
+		bool SupportsSplitDebugInfo() const override final
+		{
+			return true;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler supports incremental link time optimization
+		/// </summary>
+		bool SupportsThinLTO() const override final
+		{
+			return true;
+		}
+
 		/// <summary>
 		/// Compile
 		/// </summary>
@@ -101,6 +152,50 @@ namespace Soup::Compiler::Mock
 				}));
 		}
 
+		/// <summary>
+		/// Gets a value indicating whether the compiler can compile multiple source files at once
+		/// </summary>
+		bool SupportsBatchCompile() const override final
+		{
+			return false;
+		}
+
+		/// <summary>
+		/// Compile a batch of source files
+		/// </summary>
+		Build::Extensions::GraphNodeWrapper CreateBatchCompileNode(
+			Build::Extensions::BuildStateWrapper& state,
+			const CompileArguments& args,
+			const std::vector<Path>& sourceFiles,
+			const Path& targetDirectory,
+			uint32_t threadCount) const override final
+		{
+			throw std::runtime_error("Batch compile is not supported.");
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler can read arguments from a response file
+		/// </summary>
+		bool SupportsResponseFiles() const override final
+		{
+			return _supportsResponseFiles;
+		}
+
+		/// <summary>
+		/// Build the shared response file arguments
+		/// </summary>
+		std::vector<std::string> CreateResponseFileArguments(
+			const CompileArguments& args) const override final
+		{
+			if (!_supportsResponseFiles)
+				throw std::runtime_error("Response files are not supported.");
+
+			_responseFileRequests.push_back(args);
+			return std::vector<std::string>({
+				"Arguments",
+			});
+		}
+
 		/// <summary>
 		/// Link
 		/// </summary>
@@ -123,7 +218,9 @@ namespace Soup::Compiler::Mock
 		}
 
 	private:
+		bool _supportsResponseFiles;
 		mutable std::vector<CompileArguments> _compileRequests;
+		mutable std::vector<CompileArguments> _responseFileRequests;
 		mutable std::vector<LinkArguments> _linkRequests;
 	};
 }
@@ -1,6 +1,10 @@
 ﻿module;
 
+#include <algorithm>
+#include <iomanip>
+#include <map>
 #include <memory>
+#include <set>
 #include <stack>
 #include <stdexcept>
 #include <string>
@@ -10,6 +14,7 @@
 export module SoupCompiler;
 
 import Opal;
+import Soup.Build;
 import Soup.Build.Extensions;
 
 using namespace Opal;
@@ -20,3 +25,5 @@ using namespace Opal;
 
 #include "BuildEngine.h"
 #include "BuildUtilities.h"
+#include "PrecompiledHeaderPlanner.h"
+#include "UnityBuildPlanner.h"
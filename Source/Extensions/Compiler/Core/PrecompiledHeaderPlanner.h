@@ -0,0 +1,77 @@
+﻿// <copyright file="PrecompiledHeaderPlanner.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Compiler
+{
+	/// <summary>
+	/// Selects the system headers that are worth rolling into an automatic precompiled header
+	/// </summary>
+	export class PrecompiledHeaderPlanner
+	{
+	public:
+		/// <summary>
+		/// Select the system headers directly included by more than the threshold percentage of source files
+		/// Note: The headers are returned in the order they are first included to preserve any
+		/// ordering requirements between them
+		/// </summary>
+		static std::vector<Path> SelectHeaders(
+			const std::vector<Path>& sourceFiles,
+			const std::map<std::string, std::vector<Path>>& sourceDirectIncludes,
+			const std::vector<Path>& systemIncludeDirectories,
+			uint32_t thresholdPercent)
+		{
+			auto orderedHeaders = std::vector<Path>();
+			auto includeCounts = std::map<std::string, size_t>();
+			for (auto& file : sourceFiles)
+			{
+				auto findIncludes = sourceDirectIncludes.find(file.ToString());
+				if (findIncludes == sourceDirectIncludes.end())
+					continue;
+
+				for (auto& include : findIncludes->second)
+				{
+					if (!IsSystemHeader(include, systemIncludeDirectories))
+						continue;
+
+					auto insertResult = includeCounts.emplace(include.ToString(), 0);
+					if (insertResult.second)
+						orderedHeaders.push_back(include);
+
+					insertResult.first->second++;
+				}
+			}
+
+			auto result = std::vector<Path>();
+			for (auto& header : orderedHeaders)
+			{
+				auto count = includeCounts[header.ToString()];
+				if (count * 100 > static_cast<size_t>(thresholdPercent) * sourceFiles.size())
+					result.push_back(header);
+			}
+
+			return result;
+		}
+
+	private:
+		static bool IsSystemHeader(
+			const Path& file,
+			const std::vector<Path>& systemIncludeDirectories)
+		{
+			auto value = file.ToString();
+			for (auto& directory : systemIncludeDirectories)
+			{
+				auto prefix = directory.ToString();
+				if (!prefix.empty() && prefix.back() != '/')
+					prefix.push_back('/');
+
+				if (value.starts_with(prefix))
+					return true;
+			}
+
+			return false;
+		}
+	};
+}
@@ -0,0 +1,154 @@
+﻿// <copyright file="UnityBuildPlanner.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Compiler
+{
+	/// <summary>
+	/// Groups source files into unity (jumbo) translation units
+	/// Files that share the most headers are placed together so the combined
+	/// translation unit parses each header once for as many files as possible
+	/// </summary>
+	export class UnityBuildPlanner
+	{
+	public:
+		/// <summary>
+		/// Create the compile batches for the source files
+		/// Note: Excluded files and files that could not be grouped are returned
+		/// as a batch with a single file that must be compiled on its own
+		/// </summary>
+		static std::vector<std::vector<Path>> CreateBatches(
+			const std::vector<Path>& sourceFiles,
+			const std::map<std::string, std::vector<Path>>& sourceIncludes,
+			const std::vector<Path>& excludedFiles,
+			uint32_t batchSize)
+		{
+			auto result = std::vector<std::vector<Path>>();
+
+			auto excludedSet = std::set<std::string>();
+			for (auto& file : excludedFiles)
+				excludedSet.insert(file.ToString());
+
+			// Split the files that are kept out of the batches (recently edited) from the
+			// candidates with known includes and the candidates with no history
+			auto knownFiles = std::vector<Path>();
+			auto knownIncludes = std::vector<std::set<std::string>>();
+			auto unknownFiles = std::vector<Path>();
+			for (auto& file : sourceFiles)
+			{
+				if (batchSize <= 1 || excludedSet.contains(file.ToString()))
+				{
+					result.push_back({ file });
+					continue;
+				}
+
+				auto findIncludes = sourceIncludes.find(file.ToString());
+				if (findIncludes != sourceIncludes.end())
+				{
+					auto includes = std::set<std::string>();
+					for (auto& include : findIncludes->second)
+						includes.insert(include.ToString());
+
+					knownFiles.push_back(file);
+					knownIncludes.push_back(std::move(includes));
+				}
+				else
+				{
+					unknownFiles.push_back(file);
+				}
+			}
+
+			// Greedily grow each batch from the file with the largest include set
+			auto remaining = std::vector<size_t>();
+			for (size_t i = 0; i < knownFiles.size(); i++)
+				remaining.push_back(i);
+
+			while (!remaining.empty())
+			{
+				auto seedLocation = std::max_element(
+					remaining.begin(),
+					remaining.end(),
+					[&knownIncludes](size_t lhs, size_t rhs)
+					{
+						return knownIncludes[lhs].size() < knownIncludes[rhs].size();
+					});
+
+				auto batch = std::vector<Path>({ knownFiles[*seedLocation] });
+				auto batchIncludes = knownIncludes[*seedLocation];
+				remaining.erase(seedLocation);
+
+				while (batch.size() < batchSize && !remaining.empty())
+				{
+					// Find the file that shares the most headers with the current batch
+					auto bestLocation = remaining.begin();
+					size_t bestShared = 0;
+					for (auto current = remaining.begin(); current != remaining.end(); ++current)
+					{
+						auto shared = CountShared(batchIncludes, knownIncludes[*current]);
+						if (shared > bestShared)
+						{
+							bestLocation = current;
+							bestShared = shared;
+						}
+					}
+
+					batch.push_back(knownFiles[*bestLocation]);
+					batchIncludes.insert(knownIncludes[*bestLocation].begin(), knownIncludes[*bestLocation].end());
+					remaining.erase(bestLocation);
+				}
+
+				result.push_back(std::move(batch));
+			}
+
+			// Files with no history keep their declared order
+			for (size_t offset = 0; offset < unknownFiles.size(); offset += batchSize)
+			{
+				auto end = std::min<size_t>(offset + batchSize, unknownFiles.size());
+				result.push_back(std::vector<Path>(unknownFiles.begin() + offset, unknownFiles.begin() + end));
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Get a stable unity file name for the batch
+		/// Note: The name is derived from the contents so that a change in the
+		/// batch membership generates a new file that is compiled from scratch
+		/// </summary>
+		static std::string GetUnityFileName(const std::vector<Path>& batch)
+		{
+			// FNV-1a
+			uint64_t hash = 14695981039346656037ull;
+			for (auto& file : batch)
+			{
+				for (auto character : file.ToString())
+				{
+					hash ^= static_cast<uint8_t>(character);
+					hash *= 1099511628211ull;
+				}
+
+				hash ^= static_cast<uint8_t>(';');
+				hash *= 1099511628211ull;
+			}
+
+			auto stream = std::stringstream();
+			stream << "Unity." << std::hex << std::setw(16) << std::setfill('0') << hash << ".cpp";
+			return stream.str();
+		}
+
+	private:
+		static size_t CountShared(const std::set<std::string>& lhs, const std::set<std::string>& rhs)
+		{
+			size_t result = 0;
+			for (auto& value : rhs)
+			{
+				if (lhs.contains(value))
+					result++;
+			}
+
+			return result;
+		}
+	};
+}
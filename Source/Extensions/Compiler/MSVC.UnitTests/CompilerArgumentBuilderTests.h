@@ -507,6 +507,87 @@ namespace Soup::Compiler::MSVC::UnitTests
 			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
 		}
 
+		[[Fact]]
+		void SingleArgument_ResponseFile()
+		{
+			CompileArguments arguments = {};
+			arguments.SourceFile = Path("File.cpp");
+			arguments.TargetFile = Path("File.obj");
+			arguments.IncludeDirectories = std::vector<Path>({
+				Path("Folder/"),
+			});
+			arguments.PreprocessorDefinitions = std::vector<std::string>({
+				"DEBUG",
+			});
+			arguments.IncludeModules = std::vector<Path>({
+				Path("Module.pcm"),
+			});
+			arguments.ResponseFile = Path("obj/args.rsp");
+			auto toolsPath = Path("tools/");
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				toolsPath,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"/nologo",
+				"/Zc:__cplusplus",
+				"/std:c++11",
+				"/Od",
+				"@obj/args.rsp",
+				"/X",
+				"/RTC1",
+				"/EHsc",
+				"/MT",
+				"/bigobj",
+				"/c",
+				"File.cpp",
+				"/Fo\"File.obj\"",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("obj/args.rsp"),
+				Path("Module.pcm"),
+				Path("File.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("File.obj"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void ResponseFileArguments()
+		{
+			CompileArguments arguments = {};
+			arguments.IncludeDirectories = std::vector<Path>({
+				Path("Folder/"),
+			});
+			arguments.PreprocessorDefinitions = std::vector<std::string>({
+				"DEBUG",
+			});
+			arguments.IncludeModules = std::vector<Path>({
+				Path("Module.pcm"),
+			});
+
+			auto actualArguments = ArgumentBuilder::BuildResponseFileArguments(arguments);
+
+			auto expectedArguments = std::vector<std::string>({
+				"/I\"Folder/\"",
+				"/DDEBUG",
+				"/module:reference",
+				"\"Module.pcm\"",
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+		}
+
 		[[Fact]]
 		void SingleArgument_ExportModule_SingleSource()
 		{
@@ -553,5 +634,171 @@ namespace Soup::Compiler::MSVC::UnitTests
 			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
 			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
 		}
+		[[Fact]]
+		void SingleArgument_PrecompiledHeader_Create()
+		{
+			CompileArguments arguments = {};
+			arguments.RootDirectory = Path("C:/root/");
+			arguments.SourceFile = Path("obj/PrecompiledHeader.cpp");
+			arguments.TargetFile = Path("obj/PrecompiledHeader.obj");
+			arguments.PrecompiledHeader = PrecompiledHeaderMode::Create;
+			arguments.PrecompiledHeaderFile = Path("pch.h");
+			arguments.PrecompiledHeaderTarget = Path("obj/PrecompiledHeader.pch");
+			auto toolsPath = Path("tools/");
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				toolsPath,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"/nologo",
+				"/Zc:__cplusplus",
+				"/std:c++11",
+				"/Od",
+				"/X",
+				"/RTC1",
+				"/EHsc",
+				"/MT",
+				"/FI\"C:/root/pch.h\"",
+				"/Yc\"C:/root/pch.h\"",
+				"/Fp\"obj/PrecompiledHeader.pch\"",
+				"/bigobj",
+				"/c",
+				"obj/PrecompiledHeader.cpp",
+				"/Fo\"obj/PrecompiledHeader.obj\"",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("obj/PrecompiledHeader.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("obj/PrecompiledHeader.pch"),
+				Path("obj/PrecompiledHeader.obj"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void SingleArgument_PrecompiledHeader_Use()
+		{
+			CompileArguments arguments = {};
+			arguments.RootDirectory = Path("C:/root/");
+			arguments.SourceFile = Path("File.cpp");
+			arguments.TargetFile = Path("obj/File.obj");
+			arguments.PrecompiledHeader = PrecompiledHeaderMode::Use;
+			arguments.PrecompiledHeaderFile = Path("pch.h");
+			arguments.PrecompiledHeaderTarget = Path("obj/PrecompiledHeader.pch");
+			auto toolsPath = Path("tools/");
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildCompilerArguments(
+				arguments,
+				toolsPath,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"/nologo",
+				"/Zc:__cplusplus",
+				"/std:c++11",
+				"/Od",
+				"/X",
+				"/RTC1",
+				"/EHsc",
+				"/MT",
+				"/FI\"C:/root/pch.h\"",
+				"/Yu\"C:/root/pch.h\"",
+				"/Fp\"obj/PrecompiledHeader.pch\"",
+				"/bigobj",
+				"/c",
+				"File.cpp",
+				"/Fo\"obj/File.obj\"",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("obj/PrecompiledHeader.pch"),
+				Path("File.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("obj/File.obj"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+		[[Fact]]
+		void BatchArguments_MultipleSources()
+		{
+			CompileArguments arguments = {};
+			auto sourceFiles = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+			});
+
+			auto actualInput = std::vector<Path>();
+			auto actualOutput = std::vector<Path>();
+			auto actualArguments = ArgumentBuilder::BuildBatchCompilerArguments(
+				arguments,
+				sourceFiles,
+				Path("obj/"),
+				2,
+				actualInput,
+				actualOutput);
+
+			auto expectedArguments = std::vector<std::string>({
+				"/nologo",
+				"/Zc:__cplusplus",
+				"/std:c++11",
+				"/Od",
+				"/X",
+				"/RTC1",
+				"/EHsc",
+				"/MT",
+				"/bigobj",
+				"/MP2",
+				"/c",
+				"File1.cpp",
+				"File2.cpp",
+				"/Fo\"obj/\"",
+			});
+			auto expectedInput = std::vector<Path>({
+				Path("File1.cpp"),
+				Path("File2.cpp"),
+			});
+			auto expectedOutput = std::vector<Path>({
+				Path("obj/File1.obj"),
+				Path("obj/File2.obj"),
+			});
+
+			Assert::AreEqual(expectedArguments, actualArguments, "Verify generated arguments match expected.");
+			Assert::AreEqual(expectedInput, actualInput, "Verify generated input match expected.");
+			Assert::AreEqual(expectedOutput, actualOutput, "Verify generated output match expected.");
+		}
+
+		[[Fact]]
+		void BatchArguments_ExportModuleThrows()
+		{
+			CompileArguments arguments = {};
+			arguments.ExportModule = true;
+
+			Assert::ThrowsRuntimeError([&arguments]() {
+				auto actualInput = std::vector<Path>();
+				auto actualOutput = std::vector<Path>();
+				auto actualArguments = ArgumentBuilder::BuildBatchCompilerArguments(
+					arguments,
+					std::vector<Path>({ Path("File1.cpp") }),
+					Path("obj/"),
+					1,
+					actualInput,
+					actualOutput);
+			});
+		}
 	};
 }
@@ -21,7 +21,13 @@ TestState RunCompilerArgumentBuilderTests()
 	state += SoupTest::RunTest(className, "SingleArgument_IncludePaths", [&testClass]() { testClass->SingleArgument_IncludePaths(); });
 	state += SoupTest::RunTest(className, "SingleArgument_PreprocessorDefinitions", [&testClass]() { testClass->SingleArgument_PreprocessorDefinitions(); });
 	state += SoupTest::RunTest(className, "SingleArgument_Modules", [&testClass]() { testClass->SingleArgument_Modules(); });
+	state += SoupTest::RunTest(className, "SingleArgument_ResponseFile", [&testClass]() { testClass->SingleArgument_ResponseFile(); });
+	state += SoupTest::RunTest(className, "ResponseFileArguments", [&testClass]() { testClass->ResponseFileArguments(); });
 	state += SoupTest::RunTest(className, "SingleArgument_ExportModule_SingleSource", [&testClass]() { testClass->SingleArgument_ExportModule_SingleSource(); });
+	state += SoupTest::RunTest(className, "SingleArgument_PrecompiledHeader_Create", [&testClass]() { testClass->SingleArgument_PrecompiledHeader_Create(); });
+	state += SoupTest::RunTest(className, "SingleArgument_PrecompiledHeader_Use", [&testClass]() { testClass->SingleArgument_PrecompiledHeader_Use(); });
+	state += SoupTest::RunTest(className, "BatchArguments_MultipleSources", [&testClass]() { testClass->BatchArguments_MultipleSources(); });
+	state += SoupTest::RunTest(className, "BatchArguments_ExportModuleThrows", [&testClass]() { testClass->BatchArguments_ExportModuleThrows(); });
 
 	return state;
 }
\ No newline at end of file
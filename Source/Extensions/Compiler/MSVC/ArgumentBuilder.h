@@ -19,6 +19,7 @@ namespace Soup::Compiler::MSVC
 		static constexpr std::string_view Compiler_ArgumentFlag_GenerateDebugInformationExternal = "Zi";
 		static constexpr std::string_view Compiler_ArgumentFlag_ShowIncludes = "showIncludes";
 		static constexpr std::string_view Compiler_ArgumentFlag_CompileOnly = "c";
+		static constexpr std::string_view Compiler_ArgumentFlag_MultipleProcesses = "MP";
 		static constexpr std::string_view Compiler_ArgumentFlag_IgnoreStandardIncludePaths = "X";
 		static constexpr std::string_view Compiler_ArgumentFlag_Optimization_Disable = "Od";
 		static constexpr std::string_view Compiler_ArgumentFlag_Optimization_Speed = "Ot";
@@ -34,6 +35,10 @@ namespace Soup::Compiler::MSVC
 		static constexpr std::string_view Compiler_ArgumentParameter_ObjectFile = "Fo";
 		static constexpr std::string_view Compiler_ArgumentParameter_Include = "I";
 		static constexpr std::string_view Compiler_ArgumentParameter_PreprocessorDefine = "D";
+		static constexpr std::string_view Compiler_ArgumentParameter_ForceInclude = "FI";
+		static constexpr std::string_view Compiler_ArgumentParameter_PrecompiledHeaderCreate = "Yc";
+		static constexpr std::string_view Compiler_ArgumentParameter_PrecompiledHeaderUse = "Yu";
+		static constexpr std::string_view Compiler_ArgumentParameter_PrecompiledHeaderFile = "Fp";
 
 		static constexpr std::string_view Linker_ArgumentFlag_NoDefaultLibraries = "nodefaultlib";
 		static constexpr std::string_view Linker_ArgumentFlag_DLL = "dll";
@@ -58,132 +63,87 @@ namespace Soup::Compiler::MSVC
 			if (args.TargetFile.GetFileName().empty())
 				throw std::runtime_error("Target file cannot be empty.");
 
-			// Calculate object output file
-			auto commandArgs = std::vector<std::string>();
+			auto commandArgs = BuildSharedCompilerArguments(args, inputFiles, outputFiles);
 
-			// Disable the logo
-			AddFlag(commandArgs, ArgumentFlag_NoLogo);
+			// Only run preprocessor, compile and assemble
+			AddFlag(commandArgs, Compiler_ArgumentFlag_CompileOnly);
 
-			// Get better support for _cplusplus macro version
-			AddParameter(commandArgs, "Zc", "__cplusplus");
+			// Add the source file as input
+			inputFiles.push_back(args.SourceFile);
+			commandArgs.push_back(args.SourceFile.ToString());
 
-			// Enable Header includes if needed
-			if (args.GenerateIncludeTree)
-			{
-				AddFlag(commandArgs, Compiler_ArgumentFlag_ShowIncludes);
-			}
+			// Add the target file as outputs
+			outputFiles.push_back(args.TargetFile);
+			AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_ObjectFile, args.TargetFile.ToString());
 
-			// Generate source debug information
-			if (args.GenerateSourceDebugInfo)
-			{
-				AddFlag(commandArgs, Compiler_ArgumentFlag_GenerateDebugInformation);
-			}
+			return commandArgs;
+		}
 
-			// Set the language standard
-			switch (args.Standard)
-			{
-				case LanguageStandard::CPP11:
-					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++11");
-					break;
-				case LanguageStandard::CPP14:
-					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++14");
-					break;
-				case LanguageStandard::CPP17:
-					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++17");
-					break;
-				case LanguageStandard::CPP20:
-					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++latest");
-					AddParameter(commandArgs, Compiler_ArgumentParameter_Experimental, "module");
-					break;
-				default:
-					throw std::runtime_error("Unknown language standard.");
-			}
+		/// <summary>
+		/// Build the arguments to compile a batch of source files in a single invocation
+		/// Note: The source and target file of the shared arguments are ignored, each object
+		/// file is written to the target directory with the name of its source file
+		/// </summary>
+		static std::vector<std::string> BuildBatchCompilerArguments(
+			const CompileArguments& args,
+			const std::vector<Path>& sourceFiles,
+			const Path& targetDirectory,
+			uint32_t threadCount,
+			std::vector<Path>& inputFiles,
+			std::vector<Path>& outputFiles)
+		{
+			// Verify the input
+			if (sourceFiles.empty())
+				throw std::runtime_error("Source files cannot be empty.");
+			if (args.ExportModule)
+				throw std::runtime_error("Cannot batch compile a module interface.");
+			if (args.PrecompiledHeader == PrecompiledHeaderMode::Create)
+				throw std::runtime_error("Cannot batch compile the precompiled header.");
 
-			// Set the optimization level
-			switch (args.Optimize)
-			{
-				case OptimizationLevel::None:
-					AddFlag(commandArgs, Compiler_ArgumentFlag_Optimization_Disable);
-					break;
-				case OptimizationLevel::Speed:
-					AddFlag(commandArgs, Compiler_ArgumentFlag_Optimization_Speed);
-					break;
-				case OptimizationLevel::Size:
-					AddFlag(commandArgs, Compiler_ArgumentFlag_Optimization_Size);
-					break;
-				default:
-					throw std::runtime_error("Unknown optimization level.");
-			}
+			auto commandArgs = BuildSharedCompilerArguments(args, inputFiles, outputFiles);
 
-			// Set the include paths
-			for (auto directory : args.IncludeDirectories)
+			// Compile the files in parallel inside the single invocation
+			if (threadCount > 1)
 			{
-				AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_Include, directory.ToString());
+				AddFlagValue(commandArgs, Compiler_ArgumentFlag_MultipleProcesses, std::to_string(threadCount));
 			}
 
-			// Set the preprocessor definitions
-			for (auto& definition : args.PreprocessorDefinitions)
-			{
-				AddFlagValue(commandArgs, Compiler_ArgumentParameter_PreprocessorDefine, definition);
-			}
-
-			// Ignore Standard Include Paths to prevent pulling in accidental headers
-			AddFlag(commandArgs, Compiler_ArgumentFlag_IgnoreStandardIncludePaths);
-
-			// Enable basic runtime checks
-			AddFlag(commandArgs, Compiler_ArgumentFlag_RuntimeChecks);
-
-			// Enable c++ exceptions
-			AddFlag(commandArgs, "EHsc");
+			// Only run preprocessor, compile and assemble
+			AddFlag(commandArgs, Compiler_ArgumentFlag_CompileOnly);
 
-			// Enable multithreaded runtime static linked
-			if (args.GenerateSourceDebugInfo)
+			// Add the source files as input
+			for (auto& file : sourceFiles)
 			{
-				AddFlag(commandArgs, Compiler_ArgumentFlag_Runtime_MultithreadedStatic_Debug);
-			}
-			else
-			{
-				AddFlag(commandArgs, Compiler_ArgumentFlag_Runtime_MultithreadedStatic_Release);
+				inputFiles.push_back(file);
+				commandArgs.push_back(file.ToString());
 			}
 
-			// Add the module references as input
-			for (auto& moduleFile : args.IncludeModules)
+			// Add each object file as output
+			for (auto& file : sourceFiles)
 			{
-				inputFiles.push_back(moduleFile);
-				AddParameter(commandArgs, Compiler_ArgumentParameter_Module, "reference");
-				AddValueWithQuotes(commandArgs, moduleFile.ToString());
+				auto objectFile = targetDirectory + Path(file.GetFileName());
+				objectFile.SetFileExtension("obj");
+				outputFiles.push_back(std::move(objectFile));
 			}
 
-			if (args.ExportModule)
-			{
-				AddParameter(commandArgs, Compiler_ArgumentParameter_Module, "interface");
+			// Note: A trailing separator places each object file in the directory
+			auto targetDirectoryValue = targetDirectory.ToString();
+			if (targetDirectoryValue.empty() || targetDirectoryValue.back() != '/')
+				targetDirectoryValue.push_back('/');
+			AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_ObjectFile, targetDirectoryValue);
 
-				// Place the ifc in the output directory
-				//var outputFile = "{Path.GetFileNameWithoutExtension(sourceFile)}.{ModuleFileExtension}";
-				//commandArgs.AddRange(new string[] { "-o", outputFile });
-				
-				// Place the module interface file in the output directory
-				auto moduleInterfaceFile = args.TargetFile;
-				moduleInterfaceFile.SetFileExtension("ifc"); // TODO
-				outputFiles.push_back(moduleInterfaceFile);
-				AddParameter(commandArgs, Compiler_ArgumentParameter_Module, "output");
-				AddValueWithQuotes(commandArgs, moduleInterfaceFile.ToString());
-			}
-
-			// TODO: For now we allow exports to be large
-			AddFlag(commandArgs, "bigobj");
-
-			// Only run preprocessor, compile and assemble
-			AddFlag(commandArgs, Compiler_ArgumentFlag_CompileOnly);
-
-			// Add the source file as input
-			inputFiles.push_back(args.SourceFile);
-			commandArgs.push_back(args.SourceFile.ToString());
-
-			// Add the target file as outputs
-			outputFiles.push_back(args.TargetFile);
-			AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_ObjectFile, args.TargetFile.ToString());
+			return commandArgs;
+		}
 
+		/// <summary>
+		/// Build the include paths, preprocessor definitions and module references that are
+		/// written once to a shared response file for all source files in a package
+		/// </summary>
+		static std::vector<std::string> BuildResponseFileArguments(const CompileArguments& args)
+		{
+			auto commandArgs = std::vector<std::string>();
+			AddIncludeArguments(commandArgs, args);
+			AddModuleArguments(commandArgs, args);
 			return commandArgs;
 		}
 
@@ -210,7 +170,11 @@ namespace Soup::Compiler::MSVC
 			// Generate source debug information
 			if (args.GenerateSourceDebugInfo)
 			{
-				AddParameter(commandArgs, "debug", "full");
+				// Keep the split DWARF skeletons instead of generating a program database
+				if (args.SplitDebugInfo)
+					AddParameter(commandArgs, "debug", "dwarf");
+				else
+					AddParameter(commandArgs, "debug", "full");
 			}
 
 			// Calculate object output file
@@ -298,6 +262,187 @@ namespace Soup::Compiler::MSVC
 		}
 
 	private:
+		/// <summary>
+		/// Build the compiler arguments that do not depend on the source and target files
+		/// </summary>
+		static std::vector<std::string> BuildSharedCompilerArguments(
+			const CompileArguments& args,
+			std::vector<Path>& inputFiles,
+			std::vector<Path>& outputFiles)
+		{
+			auto commandArgs = std::vector<std::string>();
+
+			// Disable the logo
+			AddFlag(commandArgs, ArgumentFlag_NoLogo);
+
+			// Get better support for _cplusplus macro version
+			AddParameter(commandArgs, "Zc", "__cplusplus");
+
+			// Enable Header includes if needed
+			if (args.GenerateIncludeTree)
+			{
+				AddFlag(commandArgs, Compiler_ArgumentFlag_ShowIncludes);
+			}
+
+			// Generate source debug information
+			if (args.GenerateSourceDebugInfo)
+			{
+				AddFlag(commandArgs, Compiler_ArgumentFlag_GenerateDebugInformation);
+			}
+
+			// Set the language standard
+			switch (args.Standard)
+			{
+				case LanguageStandard::CPP11:
+					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++11");
+					break;
+				case LanguageStandard::CPP14:
+					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++14");
+					break;
+				case LanguageStandard::CPP17:
+					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++17");
+					break;
+				case LanguageStandard::CPP20:
+					AddParameter(commandArgs, Compiler_ArgumentParameter_Standard, "c++latest");
+					AddParameter(commandArgs, Compiler_ArgumentParameter_Experimental, "module");
+					break;
+				default:
+					throw std::runtime_error("Unknown language standard.");
+			}
+
+			// Set the optimization level
+			switch (args.Optimize)
+			{
+				case OptimizationLevel::None:
+					AddFlag(commandArgs, Compiler_ArgumentFlag_Optimization_Disable);
+					break;
+				case OptimizationLevel::Speed:
+					AddFlag(commandArgs, Compiler_ArgumentFlag_Optimization_Speed);
+					break;
+				case OptimizationLevel::Size:
+					AddFlag(commandArgs, Compiler_ArgumentFlag_Optimization_Size);
+					break;
+				default:
+					throw std::runtime_error("Unknown optimization level.");
+			}
+
+			// Set the include paths and preprocessor definitions
+			// Note: The shared response file replaces the arguments that are the same for every file
+			if (args.ResponseFile.IsEmpty())
+			{
+				AddIncludeArguments(commandArgs, args);
+			}
+			else
+			{
+				inputFiles.push_back(args.ResponseFile);
+				commandArgs.push_back("@" + args.ResponseFile.ToString());
+			}
+
+			// Ignore Standard Include Paths to prevent pulling in accidental headers
+			AddFlag(commandArgs, Compiler_ArgumentFlag_IgnoreStandardIncludePaths);
+
+			// Enable basic runtime checks
+			AddFlag(commandArgs, Compiler_ArgumentFlag_RuntimeChecks);
+
+			// Enable c++ exceptions
+			AddFlag(commandArgs, "EHsc");
+
+			// Enable multithreaded runtime static linked
+			if (args.GenerateSourceDebugInfo)
+			{
+				AddFlag(commandArgs, Compiler_ArgumentFlag_Runtime_MultithreadedStatic_Debug);
+			}
+			else
+			{
+				AddFlag(commandArgs, Compiler_ArgumentFlag_Runtime_MultithreadedStatic_Release);
+			}
+
+			// Add the module references as input
+			for (auto& moduleFile : args.IncludeModules)
+			{
+				inputFiles.push_back(moduleFile);
+			}
+
+			if (args.ResponseFile.IsEmpty())
+			{
+				AddModuleArguments(commandArgs, args);
+			}
+
+			// Force include the precompiled header so the source files do not need to reference it
+			if (args.PrecompiledHeader != PrecompiledHeaderMode::None)
+			{
+				auto headerFile = args.PrecompiledHeaderFile.HasRoot() ?
+					args.PrecompiledHeaderFile :
+					args.RootDirectory + args.PrecompiledHeaderFile;
+				AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_ForceInclude, headerFile.ToString());
+
+				if (args.PrecompiledHeader == PrecompiledHeaderMode::Create)
+				{
+					outputFiles.push_back(args.PrecompiledHeaderTarget);
+					AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_PrecompiledHeaderCreate, headerFile.ToString());
+				}
+				else
+				{
+					inputFiles.push_back(args.PrecompiledHeaderTarget);
+					AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_PrecompiledHeaderUse, headerFile.ToString());
+				}
+
+				AddFlagValueWithQuotes(
+					commandArgs,
+					Compiler_ArgumentParameter_PrecompiledHeaderFile,
+					args.PrecompiledHeaderTarget.ToString());
+			}
+
+			if (args.ExportModule)
+			{
+				AddParameter(commandArgs, Compiler_ArgumentParameter_Module, "interface");
+
+				// Place the ifc in the output directory
+				//var outputFile = "{Path.GetFileNameWithoutExtension(sourceFile)}.{ModuleFileExtension}";
+				//commandArgs.AddRange(new string[] { "-o", outputFile });
+				
+				// Place the module interface file in the output directory
+				auto moduleInterfaceFile = args.TargetFile;
+				moduleInterfaceFile.SetFileExtension("ifc"); // TODO
+				outputFiles.push_back(moduleInterfaceFile);
+				AddParameter(commandArgs, Compiler_ArgumentParameter_Module, "output");
+				AddValueWithQuotes(commandArgs, moduleInterfaceFile.ToString());
+			}
+
+			// TODO: For now we allow exports to be large
+			AddFlag(commandArgs, "bigobj");
+
+			return commandArgs;
+		}
+
+		static void AddIncludeArguments(
+			std::vector<std::string>& commandArgs,
+			const CompileArguments& args)
+		{
+			// Set the include paths
+			for (auto directory : args.IncludeDirectories)
+			{
+				AddFlagValueWithQuotes(commandArgs, Compiler_ArgumentParameter_Include, directory.ToString());
+			}
+
+			// Set the preprocessor definitions
+			for (auto& definition : args.PreprocessorDefinitions)
+			{
+				AddFlagValue(commandArgs, Compiler_ArgumentParameter_PreprocessorDefine, definition);
+			}
+		}
+
+		static void AddModuleArguments(
+			std::vector<std::string>& commandArgs,
+			const CompileArguments& args)
+		{
+			for (auto& moduleFile : args.IncludeModules)
+			{
+				AddParameter(commandArgs, Compiler_ArgumentParameter_Module, "reference");
+				AddValueWithQuotes(commandArgs, moduleFile.ToString());
+			}
+		}
+
 		static void AddValueWithQuotes(
 			std::vector<std::string>& args,
 			std::string value)
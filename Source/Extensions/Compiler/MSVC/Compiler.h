@@ -63,6 +63,41 @@ namespace Soup::Compiler::MSVC
 			return "dll";
 		}
 
+		/// <summary>
+		/// Gets the precompiled header file extension for the compiler
+		/// </summary>
+		std::string_view GetPrecompiledHeaderFileExtension() const override final
+		{
+			return "pch";
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the precompiled header object must be linked
+		/// Note: The object holds the debug information shared by all users of the header
+		/// </summary>
+		bool IsPrecompiledHeaderObjectLinked() const override final
+		{
+			return true;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler supports split debug information
+		/// Note: The program database is already kept out of the object files with /Zi
+		/// </summary>
+		bool SupportsSplitDebugInfo() const override final
+		{
+			return false;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler supports incremental link time optimization
+		/// Note: Whole program optimization cannot reuse a cache between builds
+		/// </summary>
+		bool SupportsThinLTO() const override final
+		{
+			return false;
+		}
+
 		/// <summary>
 		/// Compile
 		/// </summary>
@@ -76,12 +111,78 @@ namespace Soup::Compiler::MSVC
 			{
 				return CompileModuleInterfaceUnit(state, args);
 			}
+			else if (args.PrecompiledHeader == PrecompiledHeaderMode::Create)
+			{
+				return CompilePrecompiledHeader(state, args);
+			}
 			else
 			{
 				return CompileStandard(state, args);
 			}
 		}
 
+		/// <summary>
+		/// Gets a value indicating whether the compiler can compile multiple source files at once
+		/// </summary>
+		bool SupportsBatchCompile() const override final
+		{
+			return true;
+		}
+
+		/// <summary>
+		/// Compile a batch of source files in a single invocation
+		/// Note: The front end and the referenced module interfaces are loaded once for the batch
+		/// </summary>
+		Build::Extensions::GraphNodeWrapper CreateBatchCompileNode(
+			Build::Extensions::BuildStateWrapper& state,
+			const CompileArguments& args,
+			const std::vector<Path>& sourceFiles,
+			const Path& targetDirectory,
+			uint32_t threadCount) const override final
+		{
+			auto executablePath = _toolsPath + _compilerExecutable;
+
+			// Build the set of input/output files along with the arguments
+			auto inputFiles = std::vector<Path>();
+			auto outputFiles = std::vector<Path>();
+			auto commandArgs = ArgumentBuilder::BuildBatchCompilerArguments(
+				args,
+				sourceFiles,
+				targetDirectory,
+				threadCount,
+				inputFiles,
+				outputFiles);
+
+			auto title = sourceFiles.front().ToString() + " (+" + std::to_string(sourceFiles.size() - 1) + ")";
+			auto buildNode = state.CreateNode(
+				title,
+				std::move(executablePath),
+				CombineArguments(commandArgs),
+				args.RootDirectory,
+				std::move(inputFiles),
+				std::move(outputFiles));
+			BuildUtilities::SetBatchCompileResources(buildNode, args, threadCount);
+
+			return buildNode;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the compiler can read arguments from a response file
+		/// </summary>
+		bool SupportsResponseFiles() const override final
+		{
+			return true;
+		}
+
+		/// <summary>
+		/// Build the arguments that are written once to the shared response file
+		/// </summary>
+		std::vector<std::string> CreateResponseFileArguments(
+			const CompileArguments& args) const override final
+		{
+			return ArgumentBuilder::BuildResponseFileArguments(args);
+		}
+
 		/// <summary>
 		/// Link
 		/// </summary>
@@ -116,6 +217,7 @@ namespace Soup::Compiler::MSVC
 				args.RootDirectory,
 				std::move(inputFiles),
 				std::move(outputFiles));
+			BuildUtilities::SetLinkResources(buildNode, args);
 
 			return buildNode;
 		}
@@ -140,10 +242,36 @@ namespace Soup::Compiler::MSVC
 				args.RootDirectory,
 				std::move(inputFiles),
 				std::move(outputFiles));
+			BuildUtilities::SetCompileResources(buildNode, args);
 
 			return buildNode;
 		}
 
+		Build::Extensions::GraphNodeWrapper CompilePrecompiledHeader(
+			Build::Extensions::BuildStateWrapper& state,
+			const CompileArguments& args) const
+		{
+			// MSVC creates the precompiled header while compiling a source file, generate
+			// a source file that only pulls in the forced include of the header
+			auto sourceFile = args.TargetFile;
+			sourceFile.SetFileExtension("cpp");
+			auto writeSourceNode = BuildUtilities::CreateWriteFileNode(
+				state,
+				sourceFile.HasRoot() ? sourceFile : args.RootDirectory + sourceFile,
+				std::vector<std::string>({
+					"// Generated source for the precompiled header",
+				}));
+
+			auto compileArgs = args;
+			compileArgs.SourceFile = sourceFile;
+			auto compileNode = CompileStandard(state, compileArgs);
+
+			// Ensure the compile runs after the source file is generated
+			writeSourceNode.GetChildList().Append(compileNode);
+
+			return writeSourceNode;
+		}
+
 		Build::Extensions::GraphNodeWrapper CompileModuleInterfaceUnit(
 			Build::Extensions::BuildStateWrapper& state,
 			const CompileArguments& args) const
@@ -182,6 +310,7 @@ namespace Soup::Compiler::MSVC
 				args.RootDirectory,
 				std::move(inputFiles),
 				std::move(outputFiles));
+			BuildUtilities::SetCompileResources(buildNode, compiledModuleArgs);
 
 			return buildNode;
 		}
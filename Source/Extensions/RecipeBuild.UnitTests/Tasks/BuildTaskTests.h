@@ -148,8 +148,8 @@ namespace RecipeBuild::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Soup::Build::BuildGraphNode>>({
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -158,8 +158,8 @@ namespace RecipeBuild::UnitTests
 					})),
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -302,8 +302,8 @@ namespace RecipeBuild::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Soup::Build::BuildGraphNode>>({
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -312,8 +312,8 @@ namespace RecipeBuild::UnitTests
 					})),
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -456,8 +456,8 @@ namespace RecipeBuild::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Soup::Build::BuildGraphNode>>({
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -466,8 +466,8 @@ namespace RecipeBuild::UnitTests
 					})),
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -684,16 +684,16 @@ namespace RecipeBuild::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Soup::Build::BuildGraphNode>>({
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
 					expectedCompileNodes),
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -932,8 +932,8 @@ namespace RecipeBuild::UnitTests
 				Memory::Reference<Soup::Build::BuildGraphNode>(
 					new Soup::Build::BuildGraphNode(
 						"Copy [C:/root/obj/Public.mock.bmi] -> [C:/root/bin/Library.mock.bmi]",
-						"C:/Windows/System32/cmd.exe",
-						"/C copy /Y \"C:\\root\\obj\\Public.mock.bmi\" \"C:\\root\\bin\\Library.mock.bmi\"",
+						"soup:copy",
+						"\"C:/root/obj/Public.mock.bmi\" \"C:/root/bin/Library.mock.bmi\"",
 						"./",
 						std::vector<std::string>({
 							"C:/root/obj/Public.mock.bmi",
@@ -963,8 +963,8 @@ namespace RecipeBuild::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Soup::Build::BuildGraphNode>>({
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -973,8 +973,8 @@ namespace RecipeBuild::UnitTests
 					})),
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -1131,8 +1131,8 @@ namespace RecipeBuild::UnitTests
 				Memory::Reference<Soup::Build::BuildGraphNode>(
 					new Soup::Build::BuildGraphNode(
 						"Copy [C:/root/obj/Public.mock.bmi] -> [C:/root/bin/Library.mock.bmi]",
-						"C:/Windows/System32/cmd.exe",
-						"/C copy /Y \"C:\\root\\obj\\Public.mock.bmi\" \"C:\\root\\bin\\Library.mock.bmi\"",
+						"soup:copy",
+						"\"C:/root/obj/Public.mock.bmi\" \"C:/root/bin/Library.mock.bmi\"",
 						"./",
 						std::vector<std::string>({
 							"C:/root/obj/Public.mock.bmi",
@@ -1164,8 +1164,8 @@ namespace RecipeBuild::UnitTests
 			auto expectedBuildNodes = std::vector<Memory::Reference<Soup::Build::BuildGraphNode>>({
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/obj]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/obj\" mkdir \"C:/root/obj\"",
+					"soup:mkdir",
+					"\"C:/root/obj\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
@@ -1174,8 +1174,8 @@ namespace RecipeBuild::UnitTests
 					})),
 				new Soup::Build::BuildGraphNode(
 					"MakeDir [C:/root/bin]",
-					"C:/Windows/System32/cmd.exe",
-					"/C if not exist \"C:/root/bin\" mkdir \"C:/root/bin\"",
+					"soup:mkdir",
+					"\"C:/root/bin\"",
 					"./",
 					std::vector<std::string>({}),
 					std::vector<std::string>({}),
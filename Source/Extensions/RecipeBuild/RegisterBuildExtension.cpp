@@ -39,6 +39,12 @@ std::shared_ptr<Soup::Compiler::ICompiler> CreateMSVCCompiler(Soup::Build::Exten
 
 extern "C"
 {
+	DllExport void SetBuildInterfaceVersion(uint32_t version)
+	{
+		// Allow the wrappers to use the bulk entry points when the host has them
+		Soup::Build::Extensions::HostInterfaceVersion::Set(version);
+	}
+
 	DllExport int RegisterBuildExtension(Soup::Build::IBuildSystem& buildSystem)
 	{
 		// Setup the real services
@@ -152,6 +152,137 @@ namespace RecipeBuild
 				arguments.GenerateSourceDebugInfo = false;
 			}
 
+			// Load the split debug information settings
+			if (buildTable.HasValue("SplitDebugInfo"))
+			{
+				arguments.EnableSplitDebugInfo =
+					buildTable.GetValue("SplitDebugInfo").AsBoolean().GetValue();
+			}
+			else
+			{
+				arguments.EnableSplitDebugInfo = false;
+			}
+
+			if (buildTable.HasValue("DebugPackage"))
+			{
+				arguments.EnableDebugPackage =
+					buildTable.GetValue("DebugPackage").AsBoolean().GetValue();
+			}
+			else
+			{
+				arguments.EnableDebugPackage = false;
+			}
+
+			// Load the link time optimization settings
+			if (buildTable.HasValue("ThinLTO"))
+			{
+				arguments.EnableThinLTO =
+					buildTable.GetValue("ThinLTO").AsBoolean().GetValue();
+			}
+			else
+			{
+				arguments.EnableThinLTO = false;
+			}
+
+			if (arguments.EnableThinLTO)
+			{
+				arguments.ThinLTOCachePolicy =
+					buildTable.GetValue("ThinLTOCachePolicy").AsString().GetValue();
+				arguments.ThinLTOJobs = static_cast<uint32_t>(
+					buildTable.GetValue("ThinLTOJobs").AsInteger().GetValue());
+			}
+
+			// Load the unity build settings
+			if (buildTable.HasValue("UnityBuild"))
+			{
+				arguments.EnableUnityBuild =
+					buildTable.GetValue("UnityBuild").AsBoolean().GetValue();
+			}
+			else
+			{
+				arguments.EnableUnityBuild = false;
+			}
+
+			if (arguments.EnableUnityBuild)
+			{
+				arguments.UnityBatchSize = static_cast<uint32_t>(
+					buildTable.GetValue("UnityBatchSize").AsInteger().GetValue());
+
+				// Load the include history provided by the build host for each source file
+				if (activeState.HasValue("SourceIncludes"))
+				{
+					auto sourceIncludesTable = activeState.GetValue("SourceIncludes").AsTable();
+					for (auto& file : arguments.SourceFiles)
+					{
+						if (sourceIncludesTable.HasValue(file.ToString()))
+						{
+							arguments.SourceIncludes.emplace(
+								file.ToString(),
+								sourceIncludesTable.GetValue(file.ToString()).AsList().CopyAsPathVector());
+						}
+					}
+				}
+
+				if (activeState.HasValue("RecentlyEditedFiles"))
+				{
+					arguments.RecentlyEditedFiles =
+						activeState.GetValue("RecentlyEditedFiles").AsList().CopyAsPathVector();
+				}
+			}
+
+			// Load the batched compile settings
+			if (buildTable.HasValue("BatchCompile"))
+			{
+				arguments.EnableBatchCompile =
+					buildTable.GetValue("BatchCompile").AsBoolean().GetValue();
+			}
+			else
+			{
+				arguments.EnableBatchCompile = false;
+			}
+
+			if (arguments.EnableBatchCompile)
+			{
+				arguments.BatchCompileSize = static_cast<uint32_t>(
+					buildTable.GetValue("BatchCompileSize").AsInteger().GetValue());
+				arguments.BatchCompileThreadCount = static_cast<uint32_t>(
+					buildTable.GetValue("BatchCompileThreadCount").AsInteger().GetValue());
+			}
+
+			// Load the precompiled header settings
+			arguments.EnableAutoPrecompiledHeader = false;
+			if (buildTable.HasValue("PrecompiledHeader"))
+			{
+				auto precompiledHeader = buildTable.GetValue("PrecompiledHeader").AsString().GetValue();
+				if (precompiledHeader == "Auto")
+				{
+					arguments.EnableAutoPrecompiledHeader = true;
+					arguments.PrecompiledHeaderThreshold = static_cast<uint32_t>(
+						buildTable.GetValue("PrecompiledHeaderThreshold").AsInteger().GetValue());
+					arguments.SystemIncludeDirectories =
+						buildTable.GetValue("SystemIncludeDirectories").AsList().CopyAsPathVector();
+
+					// Load the direct includes provided by the build host for each source file
+					if (activeState.HasValue("SourceDirectIncludes"))
+					{
+						auto sourceDirectIncludesTable = activeState.GetValue("SourceDirectIncludes").AsTable();
+						for (auto& file : arguments.SourceFiles)
+						{
+							if (sourceDirectIncludesTable.HasValue(file.ToString()))
+							{
+								arguments.SourceDirectIncludes.emplace(
+									file.ToString(),
+									sourceDirectIncludesTable.GetValue(file.ToString()).AsList().CopyAsPathVector());
+							}
+						}
+					}
+				}
+				else
+				{
+					arguments.PrecompiledHeaderFile = Path(precompiledHeader);
+				}
+			}
+
 			// Load the runtime dependencies
 			if (buildTable.HasValue("RuntimeDependencies"))
 			{
@@ -11,6 +11,34 @@ namespace RecipeBuild
 	/// </summary>
 	export class RecipeBuildTask : public Memory::ReferenceCounted<Soup::Build::IBuildTask>
 	{
+	private:
+		/// <summary>
+		/// The default number of source files combined into a single unity translation unit
+		/// </summary>
+		static constexpr int64_t DefaultUnityBatchSize = 8;
+
+		/// <summary>
+		/// The recipe value that selects the automatic precompiled header
+		/// </summary>
+		static constexpr std::string_view AutoPrecompiledHeader = "Auto";
+
+		/// <summary>
+		/// The default percentage of source files that must share a system header
+		/// for it to be added to the automatic precompiled header
+		/// </summary>
+		static constexpr int64_t DefaultPrecompiledHeaderThreshold = 50;
+
+		/// <summary>
+		/// The default number of source files compiled in a single batched compiler invocation
+		/// </summary>
+		static constexpr int64_t DefaultBatchCompileSize = 8;
+
+		/// <summary>
+		/// The default pruning policy for the persistent link time optimization cache
+		/// Note: Drop entries unused for a week and keep the cache under 4 GB
+		/// </summary>
+		static constexpr std::string_view DefaultThinLTOCachePolicy = "prune_after=168h:cache_size_bytes=4g";
+
 	public:
 		RecipeBuildTask() :
 			_runBeforeList({ "Build" }),
@@ -201,6 +229,38 @@ namespace RecipeBuild
 			buildTable.EnsureValue("OptimizationLevel").SetValueInteger(static_cast<int64_t>(optimizationLevel));
 			buildTable.EnsureValue("GenerateSourceDebugInfo").SetValueBoolean(generateSourceDebugInfo);
 
+			// Check for the opt in split debug information, only used by the debug flavor
+			if (generateSourceDebugInfo &&
+				recipeTable.HasValue("SplitDebugInfo") &&
+				recipeTable.GetValue("SplitDebugInfo").AsBoolean().GetValue())
+			{
+				bool debugPackage = false;
+				if (recipeTable.HasValue("DebugPackage"))
+					debugPackage = recipeTable.GetValue("DebugPackage").AsBoolean().GetValue();
+
+				buildTable.EnsureValue("SplitDebugInfo").SetValueBoolean(true);
+				buildTable.EnsureValue("DebugPackage").SetValueBoolean(debugPackage);
+			}
+
+			// Check for the opt in link time optimization, only used by the release flavor
+			if (optimizationLevel != Soup::Compiler::BuildOptimizationLevel::None &&
+				recipeTable.HasValue("ThinLTO") &&
+				recipeTable.GetValue("ThinLTO").AsBoolean().GetValue())
+			{
+				auto thinLTOCachePolicy = std::string(DefaultThinLTOCachePolicy);
+				if (recipeTable.HasValue("ThinLTOCachePolicy"))
+					thinLTOCachePolicy = recipeTable.GetValue("ThinLTOCachePolicy").AsString().GetValue();
+
+				// Do not let the backend jobs of a single link use more threads than the whole build
+				int64_t thinLTOJobs = 0;
+				if (rootTable.HasValue("MaxParallelism"))
+					thinLTOJobs = rootTable.GetValue("MaxParallelism").AsInteger().GetValue();
+
+				buildTable.EnsureValue("ThinLTO").SetValueBoolean(true);
+				buildTable.EnsureValue("ThinLTOCachePolicy").SetValueString(thinLTOCachePolicy);
+				buildTable.EnsureValue("ThinLTOJobs").SetValueInteger(thinLTOJobs);
+			}
+
 			buildTable.EnsureValue("PlatformLibraries").EnsureList().Append(platformLibraries);
 			buildTable.EnsureValue("LinkLibraries").EnsureList().Append(linkLibraries);
 			buildTable.EnsureValue("PreprocessorDefinitions").EnsureList().Append(preprocessorDefinitions);
@@ -208,6 +268,51 @@ namespace RecipeBuild
 			buildTable.EnsureValue("LibraryPaths").EnsureList().Append(libraryPaths);
 			buildTable.EnsureValue("Source").EnsureList().Append(sourceFiles);
 
+			// Check for the opt in unity build
+			if (recipeTable.HasValue("UnityBuild") && recipeTable.GetValue("UnityBuild").AsBoolean().GetValue())
+			{
+				int64_t unityBatchSize = DefaultUnityBatchSize;
+				if (recipeTable.HasValue("UnityBatchSize"))
+					unityBatchSize = recipeTable.GetValue("UnityBatchSize").AsInteger().GetValue();
+
+				buildTable.EnsureValue("UnityBuild").SetValueBoolean(true);
+				buildTable.EnsureValue("UnityBatchSize").SetValueInteger(unityBatchSize);
+			}
+
+			// Check for the opt in batched compiler invocations
+			if (recipeTable.HasValue("BatchCompile") && recipeTable.GetValue("BatchCompile").AsBoolean().GetValue())
+			{
+				int64_t batchCompileSize = DefaultBatchCompileSize;
+				if (recipeTable.HasValue("BatchCompileSize"))
+					batchCompileSize = recipeTable.GetValue("BatchCompileSize").AsInteger().GetValue();
+
+				// Do not let a single invocation use more threads than the whole build
+				int64_t batchCompileThreadCount = 0;
+				if (rootTable.HasValue("MaxParallelism"))
+					batchCompileThreadCount = rootTable.GetValue("MaxParallelism").AsInteger().GetValue();
+
+				buildTable.EnsureValue("BatchCompile").SetValueBoolean(true);
+				buildTable.EnsureValue("BatchCompileSize").SetValueInteger(batchCompileSize);
+				buildTable.EnsureValue("BatchCompileThreadCount").SetValueInteger(batchCompileThreadCount);
+			}
+
+			// Check for a precompiled header shared by all source files
+			if (recipeTable.HasValue("PrecompiledHeader"))
+			{
+				auto precompiledHeader = recipeTable.GetValue("PrecompiledHeader").AsString().GetValue();
+				buildTable.EnsureValue("PrecompiledHeader").SetValueString(precompiledHeader);
+
+				if (precompiledHeader == AutoPrecompiledHeader)
+				{
+					int64_t precompiledHeaderThreshold = DefaultPrecompiledHeaderThreshold;
+					if (recipeTable.HasValue("PrecompiledHeaderThreshold"))
+						precompiledHeaderThreshold = recipeTable.GetValue("PrecompiledHeaderThreshold").AsInteger().GetValue();
+
+					buildTable.EnsureValue("PrecompiledHeaderThreshold").SetValueInteger(precompiledHeaderThreshold);
+					buildTable.EnsureValue("SystemIncludeDirectories").SetValuePathList(platformIncludePaths);
+				}
+			}
+
 			// Convert the recipe type to the required build type
 			Soup::Compiler::BuildTargetType targetType;
 			auto recipeType = Soup::Build::Extensions::RecipeType::StaticLibrary;